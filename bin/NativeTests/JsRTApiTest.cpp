@@ -1613,4 +1613,211 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ScriptTerminationTest);
     }
+
+    void CALLBACK SamplingProfileWriteCallback(void *callbackState, const char *chunk, size_t length)
+    {
+        static_cast<std::string *>(callbackState)->append(chunk, length);
+    }
+
+    void SamplingProfilerTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const wchar_t *script = _u("function sampledFunction() { var s = 0; for (var i = 0; i < 1000; i++) { s += i; } return s; }\n")
+            _u("var start = Date.now(); while (Date.now() - start < 100) { sampledFunction(); }");
+
+        CHECK(JsStopSamplingProfiler(runtime, JsSamplingProfileFormat_CollapsedStacks, nullptr, nullptr) == JsErrorInvalidArgument);
+
+        REQUIRE(JsStartSamplingProfiler(runtime, 1) == JsNoError);
+        CHECK(JsStartSamplingProfiler(runtime, 1) == JsErrorAlreadyProfilingContext);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        std::string profile;
+        REQUIRE(JsStopSamplingProfiler(runtime, JsSamplingProfileFormat_CollapsedStacks, SamplingProfileWriteCallback, &profile) == JsNoError);
+        CHECK(profile.find("sampledFunction") != std::string::npos);
+
+        REQUIRE(JsStartSamplingProfiler(runtime, 1) == JsNoError);
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        profile.clear();
+        REQUIRE(JsStopSamplingProfiler(runtime, JsSamplingProfileFormat_CpuProfile, SamplingProfileWriteCallback, &profile) == JsNoError);
+        CHECK(profile.find("\"functionName\":\"sampledFunction\"") != std::string::npos);
+    }
+
+    TEST_CASE("ApiTest_SamplingProfilerTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SamplingProfilerTest);
+    }
+
+    void CALLBACK HeapSnapshotWriteCallback(void *callbackState, const void *chunk, size_t length)
+    {
+        static_cast<std::string *>(callbackState)->append(static_cast<const char *>(chunk), length);
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function SnapshotPoint(x) { this.x = x; }\n")
+            _u("var points = []; for (var i = 0; i < 100; i++) { points.push(new SnapshotPoint(i)); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        CHECK(JsWriteHeapSnapshot(runtime, JsHeapSnapshotFormat_Summary, nullptr, nullptr) == JsErrorNullArgument);
+
+        std::string snapshot;
+        REQUIRE(JsWriteHeapSnapshot(runtime, JsHeapSnapshotFormat_Summary, HeapSnapshotWriteCallback, &snapshot) == JsNoError);
+        REQUIRE(snapshot.size() > 8);
+        CHECK(snapshot.compare(0, 4, "CHHS") == 0);
+        CHECK(snapshot.find("SnapshotPoint") != std::string::npos);
+        CHECK(snapshot.back() == 0);
+
+        std::string graph;
+        REQUIRE(JsWriteHeapSnapshot(runtime, JsHeapSnapshotFormat_Graph, HeapSnapshotWriteCallback, &graph) == JsNoError);
+        CHECK(graph.size() > snapshot.size());
+        CHECK(graph.find("points") != std::string::npos);
+
+        // An object only the host holds on to is a root too.
+        JsValueRef pinned = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function () { function PinnedByHost() {} return new PinnedByHost(); })()"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &pinned) == JsNoError);
+        REQUIRE(JsAddRef(pinned, nullptr) == JsNoError);
+
+        std::string pinnedSnapshot;
+        REQUIRE(JsWriteHeapSnapshot(runtime, JsHeapSnapshotFormat_Summary, HeapSnapshotWriteCallback, &pinnedSnapshot) == JsNoError);
+        CHECK(pinnedSnapshot.find("PinnedByHost") != std::string::npos);
+        REQUIRE(JsRelease(pinned, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
+
+    void RuntimeStatisticsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsRuntimeStatistics statistics;
+        REQUIRE(JsResetRuntimeStatistics(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeStatistics(runtime, &statistics) == JsNoError);
+        CHECK(statistics.parseMicroseconds == 0);
+        CHECK(statistics.gcPauseCount == 0);
+        CHECK(JsGetRuntimeStatistics(runtime, nullptr) == JsErrorNullArgument);
+
+        size_t memoryUsage = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &memoryUsage) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 100000; i++) { a.push({ i: i }); } a = null;"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        REQUIRE(JsGetRuntimeStatistics(runtime, &statistics) == JsNoError);
+        CHECK(statistics.gcPauseCount > 0);
+        CHECK(statistics.peakMemoryUsage > memoryUsage);
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &memoryUsage) == JsNoError);
+        CHECK(statistics.peakMemoryUsage >= memoryUsage);
+    }
+
+    TEST_CASE("ApiTest_RuntimeStatisticsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RuntimeStatisticsTest);
+    }
+
+    void ContextMemoryTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsContextRef contextA = JS_INVALID_REFERENCE;
+        JsContextRef contextB = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&contextA) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &contextB) == JsNoError);
+
+        size_t limit = 0;
+        REQUIRE(JsGetContextMemoryLimit(contextB, &limit) == JsNoError);
+        CHECK(limit == (size_t)-1);
+        CHECK(JsGetContextMemoryUsage(contextB, nullptr) == JsErrorNullArgument);
+        CHECK(JsGetContextMemoryUsage(runtime, &limit) == JsErrorInvalidArgument);
+
+        // The first query starts the accounting, so nothing has been charged yet.
+        size_t usageA = 0;
+        size_t usageB = 0;
+        REQUIRE(JsGetContextMemoryUsage(contextA, &usageA) == JsNoError);
+        REQUIRE(JsGetContextMemoryUsage(contextB, &usageB) == JsNoError);
+        CHECK(usageA == 0);
+        CHECK(usageB == 0);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var retained = []; for (var i = 0; i < 100000; i++) { retained.push({ i: i }); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        REQUIRE(JsGetContextMemoryUsage(contextA, &usageA) == JsNoError);
+        REQUIRE(JsGetContextMemoryUsage(contextB, &usageB) == JsNoError);
+        CHECK(usageA > 1024 * 1024);
+        CHECK(usageA > usageB);
+
+        // Context B may keep what it has, but not grow by much.
+        REQUIRE(JsSetContextMemoryLimit(contextB, usageB + 256 * 1024) == JsNoError);
+        REQUIRE(JsGetContextMemoryLimit(contextB, &limit) == JsNoError);
+        CHECK(limit == usageB + 256 * 1024);
+
+        REQUIRE(JsSetCurrentContext(contextB) == JsNoError);
+        JsErrorCode error = JsRunScript(_u("var retained = []; for (var i = 0; i < 1000000; i++) { retained.push({ i: i }); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result);
+        CHECK((error == JsErrorOutOfMemory || error == JsErrorScriptException));
+        if (error == JsErrorScriptException)
+        {
+            JsValueRef exception = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        }
+
+        // Other contexts of the runtime are unaffected.
+        REQUIRE(JsSetCurrentContext(contextA) == JsNoError);
+        REQUIRE(JsRunScript(_u("var more = []; for (var i = 0; i < 100000; i++) { more.push({ i: i }); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ContextMemoryTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ContextMemoryTest);
+    }
+
+    void ContextMemoryReuseTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsContextRef contextA = JS_INVALID_REFERENCE;
+        JsContextRef contextB = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&contextA) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &contextB) == JsNoError);
+
+        // Only a context with a limit keeps its heap blocks to itself.
+        size_t usageA = 0;
+        size_t usageB = 0;
+        REQUIRE(JsSetContextMemoryLimit(contextA, (size_t)1024 * 1024 * 1024) == JsNoError);
+        REQUIRE(JsGetContextMemoryUsage(contextB, &usageB) == JsNoError);
+
+        // Context A frees every other object, leaving its blocks half empty.
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var all = []; for (var i = 0; i < 100000; i++) { all.push({ i: i }); }\n")
+            _u("var kept = []; for (var i = 0; i < all.length; i += 2) { kept.push(all[i]); } all = null;"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        REQUIRE(JsGetContextMemoryUsage(contextA, &usageA) == JsNoError);
+        REQUIRE(JsGetContextMemoryUsage(contextB, &usageB) == JsNoError);
+
+        // Context B allocates objects of the same size; what survives is B's, wherever it was put.
+        REQUIRE(JsSetCurrentContext(contextB) == JsNoError);
+        REQUIRE(JsRunScript(_u("var retained = []; for (var i = 0; i < 100000; i++) { retained.push({ i: i }); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsSetCurrentContext(contextA) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        size_t usageAAfter = 0;
+        size_t usageBAfter = 0;
+        REQUIRE(JsGetContextMemoryUsage(contextA, &usageAAfter) == JsNoError);
+        REQUIRE(JsGetContextMemoryUsage(contextB, &usageBAfter) == JsNoError);
+        CHECK(usageBAfter > usageB + 1024 * 1024);
+        CHECK(usageAAfter < usageA + 256 * 1024);
+    }
+
+    TEST_CASE("ApiTest_ContextMemoryReuseTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ContextMemoryReuseTest);
+    }
 }
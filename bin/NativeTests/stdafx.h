@@ -7,6 +7,7 @@
 #pragma warning(disable: 4127)  // constant expression for Trace/Assert
 
 #include <map>
+#include <string>
 #define IfFailedReturn(EXPR) do { hr = (EXPR); if (FAILED(hr)) { return hr; }} while(FALSE)
 #define IfFailedGoLabel(expr, label) do { hr = (expr); if (FAILED(hr)) { goto label; } } while (FALSE)
 #define IfFailGo(expr) IfFailedGoLabel(hr = (expr), Error)
@@ -39,6 +40,7 @@ if (!(exp)) \
 #define Assert(exp)             AssertMsg(exp, #exp)
 #define _JSRT_
 #include "chakracommon.h"
+#include "chakracore.h"
 #include "Core/CommonTypedefs.h"
 
 #include <FileLoadHelpers.h>
@@ -77,6 +77,9 @@ bool ChakraRTInterface::LoadChakraDll(ArgInfo* argInfo, HINSTANCE *outLibrary)
     m_jsApiHooks.pfJsrtCreateRuntime = (JsAPIHooks::JsrtCreateRuntimePtr)GetChakraCoreSymbol(library, "JsCreateRuntime");
     m_jsApiHooks.pfJsrtCreateContext = (JsAPIHooks::JsrtCreateContextPtr)GetChakraCoreSymbol(library, "JsCreateContext");
     m_jsApiHooks.pfJsrtSetRuntimeMemoryLimit = (JsAPIHooks::JsrtSetRuntimeMemoryLimitPtr)GetChakraCoreSymbol(library, "JsSetRuntimeMemoryLimit");
+    m_jsApiHooks.pfJsrtCollectGarbage = (JsAPIHooks::JsrtCollectGarbagePtr)GetChakraCoreSymbol(library, "JsCollectGarbage");
+    m_jsApiHooks.pfJsrtGetRuntimeStatistics = (JsAPIHooks::JsrtGetRuntimeStatisticsPtr)GetChakraCoreSymbol(library, "JsGetRuntimeStatistics");
+    m_jsApiHooks.pfJsrtResetRuntimeStatistics = (JsAPIHooks::JsrtResetRuntimeStatisticsPtr)GetChakraCoreSymbol(library, "JsResetRuntimeStatistics");
     m_jsApiHooks.pfJsrtSetCurrentContext = (JsAPIHooks::JsrtSetCurrentContextPtr)GetChakraCoreSymbol(library, "JsSetCurrentContext");
     m_jsApiHooks.pfJsrtGetCurrentContext = (JsAPIHooks::JsrtGetCurrentContextPtr)GetChakraCoreSymbol(library, "JsGetCurrentContext");
     m_jsApiHooks.pfJsrtDisposeRuntime = (JsAPIHooks::JsrtDisposeRuntimePtr)GetChakraCoreSymbol(library, "JsDisposeRuntime");
@@ -9,6 +9,9 @@ struct JsAPIHooks
     typedef JsErrorCode (WINAPI *JsrtCreateRuntimePtr)(JsRuntimeAttributes attributes, JsThreadServiceCallback threadService, JsRuntimeHandle *runtime);
     typedef JsErrorCode (WINAPI *JsrtCreateContextPtr)(JsRuntimeHandle runtime, JsContextRef *newContext);
     typedef JsErrorCode (WINAPI *JsrtSetRuntimeMemoryLimitPtr)(JsRuntimeHandle runtime, size_t memoryLimit);
+    typedef JsErrorCode (WINAPI *JsrtCollectGarbagePtr)(JsRuntimeHandle runtime);
+    typedef JsErrorCode (WINAPI *JsrtGetRuntimeStatisticsPtr)(JsRuntimeHandle runtime, JsRuntimeStatistics *statistics);
+    typedef JsErrorCode (WINAPI *JsrtResetRuntimeStatisticsPtr)(JsRuntimeHandle runtime);
     typedef JsErrorCode (WINAPI *JsrtSetCurrentContextPtr)(JsContextRef context);
     typedef JsErrorCode (WINAPI *JsrtGetCurrentContextPtr)(JsContextRef* context);
     typedef JsErrorCode (WINAPI *JsrtDisposeRuntimePtr)(JsRuntimeHandle runtime);
@@ -100,6 +103,9 @@ struct JsAPIHooks
     JsrtCreateRuntimePtr pfJsrtCreateRuntime;
     JsrtCreateContextPtr pfJsrtCreateContext;
     JsrtSetRuntimeMemoryLimitPtr pfJsrtSetRuntimeMemoryLimit;
+    JsrtCollectGarbagePtr pfJsrtCollectGarbage;
+    JsrtGetRuntimeStatisticsPtr pfJsrtGetRuntimeStatistics;
+    JsrtResetRuntimeStatisticsPtr pfJsrtResetRuntimeStatistics;
     JsrtSetCurrentContextPtr pfJsrtSetCurrentContext;
     JsrtGetCurrentContextPtr pfJsrtGetCurrentContext;
     JsrtDisposeRuntimePtr pfJsrtDisposeRuntime;
@@ -270,6 +276,9 @@ public:
     static JsErrorCode WINAPI JsCreateRuntime(JsRuntimeAttributes attributes, JsThreadServiceCallback threadService, JsRuntimeHandle *runtime) { return HOOK_JS_API(CreateRuntime(attributes, threadService, runtime)); }
     static JsErrorCode WINAPI JsCreateContext(JsRuntimeHandle runtime, JsContextRef *newContext) { return HOOK_JS_API(CreateContext(runtime, newContext)); }
     static JsErrorCode WINAPI JsSetRuntimeMemoryLimit(JsRuntimeHandle runtime, size_t memory) { return HOOK_JS_API(SetRuntimeMemoryLimit(runtime, memory)); }
+    static JsErrorCode WINAPI JsCollectGarbage(JsRuntimeHandle runtime) { return HOOK_JS_API(CollectGarbage(runtime)); }
+    static JsErrorCode WINAPI JsGetRuntimeStatistics(JsRuntimeHandle runtime, JsRuntimeStatistics *statistics) { return HOOK_JS_API(GetRuntimeStatistics(runtime, statistics)); }
+    static JsErrorCode WINAPI JsResetRuntimeStatistics(JsRuntimeHandle runtime) { return HOOK_JS_API(ResetRuntimeStatistics(runtime)); }
     static JsErrorCode WINAPI JsSetCurrentContext(JsContextRef context) { return HOOK_JS_API(SetCurrentContext(context)); }
     static JsErrorCode WINAPI JsGetCurrentContext(JsContextRef* context) { return HOOK_JS_API(GetCurrentContext(context)); }
     static JsErrorCode WINAPI JsDisposeRuntime(JsRuntimeHandle runtime) { return HOOK_JS_API(DisposeRuntime(runtime)); }
@@ -10,7 +10,7 @@ private:
     unsigned int m_time;
     unsigned int m_id;
 
-    static unsigned int s_messageCount;
+    static thread_local unsigned int s_messageCount;
 
     MessageBase(const MessageBase&);
 
@@ -25,176 +25,298 @@ public:
     virtual HRESULT Call(LPCSTR fileName) = 0;
 };
 
+// First in, first out queue of T in a circular buffer that grows as needed.
 template <typename T>
-class SortedList 
+class RingQueue
 {
-    template <typename T>
-    struct DListNode
-    {
-        T data;
-        DListNode<T>* prev;
-        DListNode<T>* next;
-
-    public:
-        DListNode(const T& data) :
-            data(data),
-            prev(nullptr),
-            next(nullptr)
-        { }
-    };
-
 public:
-    SortedList():
-        head(nullptr)
+    RingQueue() :
+        buffer(nullptr),
+        capacity(0),
+        head(0),
+        count(0)
     {
     }
 
-    ~SortedList()
+    ~RingQueue()
     {
-        while (head != nullptr)
-        {
-            Remove(head);
-        }
+        delete[] buffer;
     }
 
-    // Scan through the sorted list
-    // Insert before the first node that satisfies the LessThan function
-    // This function maintains the invariant that the list is always sorted
-    void Insert(const T& data)
+    void Push(const T& data)
     {
-        DListNode<T>* curr = head;
-        DListNode<T>* node = new DListNode<T>(data);
-        DListNode<T>* prev = nullptr; 
-
-        // Now, if we have to insert, we have to insert *after* some node
-        while (curr != nullptr)
+        if (count == capacity)
         {
-            if (T::LessThan(data, curr->data))
-            {
-                break;
-            }
-            prev = curr;
-            curr = curr->next;
+            Grow();
         }
+        buffer[(head + count) % capacity] = data;
+        count++;
+    }
 
-        InsertAfter(node, prev);
+    T& Front()
+    {
+        Assert(count != 0);
+        return buffer[head];
     }
 
     T Pop()
     {
-        T data = head->data;
-        Remove(head);
+        Assert(count != 0);
+        T data = buffer[head];
+        head = (head + 1) % capacity;
+        count--;
         return data;
     }
 
-    template <typename PredicateFn>
-    void Remove(PredicateFn fn)
+    T& Item(unsigned int index)
     {
-        DListNode<T>* node = head;
+        Assert(index < count);
+        return buffer[(head + index) % capacity];
+    }
 
-        while (node != nullptr)
-        {
-            if (fn(node->data))
-            {
-                Remove(node);
-                return;
-            }
-        }
+    unsigned int Count()
+    {
+        return count;
     }
 
     bool IsEmpty()
     {
-        return head == nullptr;
+        return count == 0;
     }
 
 private:
-    void Remove(DListNode<T>* node)
+    void Grow()
     {
-        if (node->prev == nullptr)
+        unsigned int newCapacity = capacity == 0 ? 64 : capacity * 2;
+        T* newBuffer = new T[newCapacity];
+        for (unsigned int i = 0; i < count; i++)
         {
-            head = node->next;
+            newBuffer[i] = buffer[(head + i) % capacity];
         }
-        else
+        delete[] buffer;
+        buffer = newBuffer;
+        capacity = newCapacity;
+        head = 0;
+    }
+
+    T* buffer;
+    unsigned int capacity;
+    unsigned int head;
+    unsigned int count;
+};
+
+// Binary min heap of T, ordered by T::LessThan.
+template <typename T>
+class BinaryHeap
+{
+public:
+    BinaryHeap() :
+        buffer(nullptr),
+        capacity(0),
+        count(0)
+    {
+    }
+
+    ~BinaryHeap()
+    {
+        delete[] buffer;
+    }
+
+    void Insert(const T& data)
+    {
+        if (count == capacity)
         {
-            node->prev->next = node->next;
+            Grow();
         }
+        buffer[count] = data;
+        SiftUp(count);
+        count++;
+    }
+
+    T& Top()
+    {
+        Assert(count != 0);
+        return buffer[0];
+    }
 
-        if (node->next != nullptr)
+    T Pop()
+    {
+        return RemoveAt(0);
+    }
+
+    T RemoveAt(unsigned int index)
+    {
+        Assert(index < count);
+        T data = buffer[index];
+        count--;
+        if (index != count)
         {
-            node->next->prev = node->prev;
+            // Put the last item in the hole; it may belong either above or below it.
+            buffer[index] = buffer[count];
+            SiftDown(index);
+            SiftUp(index);
         }
+        return data;
+    }
+
+    T& Item(unsigned int index)
+    {
+        Assert(index < count);
+        return buffer[index];
+    }
+
+    unsigned int Count()
+    {
+        return count;
+    }
 
-        delete node;
+    bool IsEmpty()
+    {
+        return count == 0;
     }
 
-    void InsertAfter(DListNode<T>* newNode, DListNode<T>* node)
+private:
+    void SiftUp(unsigned int index)
     {
-        // If the list is empty, just set head to newNode
-        if (head == nullptr)
+        T data = buffer[index];
+        while (index > 0)
         {
-            Assert(node == nullptr);
-            head = newNode;
-            return;
+            unsigned int parent = (index - 1) / 2;
+            if (!T::LessThan(data, buffer[parent]))
+            {
+                break;
+            }
+            buffer[index] = buffer[parent];
+            index = parent;
         }
+        buffer[index] = data;
+    }
 
-        // If node is null here, we must be trying to insert before head
-        if (node == nullptr)
+    void SiftDown(unsigned int index)
+    {
+        T data = buffer[index];
+        while (true)
         {
-            newNode->next = head;
-            head->prev = newNode;
-            head = newNode;
-            return;
+            unsigned int child = index * 2 + 1;
+            if (child >= count)
+            {
+                break;
+            }
+            if (child + 1 < count && T::LessThan(buffer[child + 1], buffer[child]))
+            {
+                child++;
+            }
+            if (!T::LessThan(buffer[child], data))
+            {
+                break;
+            }
+            buffer[index] = buffer[child];
+            index = child;
         }
+        buffer[index] = data;
+    }
 
-        Assert(node);
-        newNode->next = node->next;
-        newNode->prev = node;
-
-        if (node->next)
+    void Grow()
+    {
+        unsigned int newCapacity = capacity == 0 ? 64 : capacity * 2;
+        T* newBuffer = new T[newCapacity];
+        for (unsigned int i = 0; i < count; i++)
         {
-            node->next->prev = newNode;
+            newBuffer[i] = buffer[i];
         }
-
-        node->next = newNode;
+        delete[] buffer;
+        buffer = newBuffer;
+        capacity = newCapacity;
     }
 
-    DListNode<T>* head;
+    T* buffer;
+    unsigned int capacity;
+    unsigned int count;
 };
 
+//
+// Messages run in order of due time, and in the order they were queued when due at the same time.
+//
+// Messages queued without a delay (promise jobs, module and debugger messages, setTimeout with 0) are due as they are
+// queued, so they are always queued in order and go to a ring buffer: runs of them are drained back to back without
+// touching the timer heap, reading the clock or sleeping. Only timers with a delay go through the heap.
+//
 class MessageQueue
 {
     struct ListEntry
     {
         unsigned int time;
+        unsigned int sequence;
         MessageBase* message;
 
-        ListEntry(unsigned int time, MessageBase* message):
+        ListEntry() :
+            time(0),
+            sequence(0),
+            message(nullptr)
+        { }
+
+        ListEntry(unsigned int time, unsigned int sequence, MessageBase* message):
             time(time),
+            sequence(sequence),
             message(message)
         { }
 
         static bool LessThan(const ListEntry& first, const ListEntry& second)
         {
-            return first.time < second.time;
+            return first.time != second.time ? first.time < second.time : first.sequence < second.sequence;
         }
     };
 
-    SortedList<ListEntry> m_queue;
+    // Messages removed from m_ready are left in place with a null message and skipped when they reach the front.
+    RingQueue<ListEntry> m_ready;
+    BinaryHeap<ListEntry> m_timers;
+    unsigned int m_sequence;
+    unsigned int m_count;
+
+    void SkipRemoved()
+    {
+        while (!m_ready.IsEmpty() && m_ready.Front().message == nullptr)
+        {
+            m_ready.Pop();
+        }
+    }
 
 public:
+    MessageQueue() :
+        m_sequence(0),
+        m_count(0)
+    {
+    }
+
     void InsertSorted(MessageBase *message)
     {
+        bool isReady = message->GetTime() == 0;
         message->BeginTimer();
-        unsigned int time = message->GetTime();
-        m_queue.Insert(ListEntry(time, message));
+        ListEntry entry(message->GetTime(), m_sequence++, message);
+        if (isReady)
+        {
+            m_ready.Push(entry);
+        }
+        else
+        {
+            m_timers.Insert(entry);
+        }
+        m_count++;
     }
 
     MessageBase* PopAndWait()
     {
-        Assert(!m_queue.IsEmpty());
+        Assert(!IsEmpty());
+
+        SkipRemoved();
+        m_count--;
+        if (!m_ready.IsEmpty() && (m_timers.IsEmpty() || ListEntry::LessThan(m_ready.Front(), m_timers.Top())))
+        {
+            // Due when it was queued.
+            return m_ready.Pop().message;
+        }
 
-        ListEntry entry = m_queue.Pop();
-        MessageBase *tmp = entry.message;
+        MessageBase *tmp = m_timers.Pop().message;
 
         int waitTime = tmp->GetTime() - GetTickCount();
         if(waitTime > 0)
@@ -207,33 +329,47 @@ public:
 
     bool IsEmpty()
     {
-        return m_queue.IsEmpty();
+        return m_count == 0;
     }
 
     void RemoveById(unsigned int id)
     {
         // Search for the message with the correct id, and delete it. Can be updated
         // to a hash to improve speed, if necessary.
-        m_queue.Remove([id](const ListEntry& entry) 
+        for (unsigned int i = 0; i < m_timers.Count(); i++)
         {
-            MessageBase *msg = entry.message;
-            if(msg->GetId() == id)
+            if (m_timers.Item(i).message->GetId() == id)
             {
-                delete msg;
-                return true;
+                delete m_timers.RemoveAt(i).message;
+                m_count--;
+                return;
             }
+        }
 
-            return false;
-        });
+        for (unsigned int i = 0; i < m_ready.Count(); i++)
+        {
+            ListEntry& entry = m_ready.Item(i);
+            if (entry.message != nullptr && entry.message->GetId() == id)
+            {
+                delete entry.message;
+                entry.message = nullptr;
+                m_count--;
+                return;
+            }
+        }
     }
 
     void RemoveAll()
     {
-        m_queue.Remove([](const ListEntry& entry) { 
-            MessageBase* msg = entry.message;
-            delete msg;
-            return true;
-        });
+        while (!m_ready.IsEmpty())
+        {
+            delete m_ready.Pop().message;
+        }
+        while (!m_timers.IsEmpty())
+        {
+            delete m_timers.Pop().message;
+        }
+        m_count = 0;
     }
 
     HRESULT ProcessAll(LPCSTR fileName)
@@ -37,9 +37,9 @@
 #endif // FreeBSD or unix ?
 #endif // _WIN32 ?
 
-MessageQueue* WScriptJsrt::messageQueue = nullptr;
-std::map<std::string, JsModuleRecord>  WScriptJsrt::moduleRecordMap;
-DWORD_PTR WScriptJsrt::sourceContext = 0;
+thread_local MessageQueue* WScriptJsrt::messageQueue = nullptr;
+thread_local std::map<std::string, JsModuleRecord>  WScriptJsrt::moduleRecordMap;
+thread_local DWORD_PTR WScriptJsrt::sourceContext = 0;
 
 #define ERROR_MESSAGE_TO_STRING(errorCode, errorMessage, errorMessageString)        \
     JsErrorCode errorCode = JsNoError;                                              \
@@ -988,6 +988,13 @@ void WScriptJsrt::AddMessageQueue(MessageQueue *_messageQueue)
     messageQueue = _messageQueue;
 }
 
+void WScriptJsrt::RemoveMessageQueue(MessageQueue *_messageQueue)
+{
+    Assert(messageQueue == _messageQueue);
+
+    messageQueue = nullptr;
+}
+
 WScriptJsrt::CallbackMessage::CallbackMessage(unsigned int time, JsValueRef function) : MessageBase(time), m_function(function)
 {
     JsErrorCode error = ChakraRTInterface::JsAddRef(m_function, nullptr);
@@ -49,6 +49,7 @@ public:
     };
 
     static void AddMessageQueue(MessageQueue *messageQueue);
+    static void RemoveMessageQueue(MessageQueue *messageQueue);
     static void PushMessage(MessageBase *message) { messageQueue->InsertSorted(message); }
 
     static JsErrorCode FetchImportedModule(_In_ JsModuleRecord referencingModule, _In_ JsValueRef specifier, _Outptr_result_maybenull_ JsModuleRecord* dependentModuleRecord);
@@ -105,7 +106,8 @@ private:
     static JsErrorCode __stdcall LoadModuleFromString(LPCSTR fileName, LPCSTR fileContent);
     static JsErrorCode __stdcall InitializeModuleInfo(JsValueRef specifier, JsModuleRecord moduleRecord);
 
-    static MessageQueue *messageQueue;
-    static DWORD_PTR sourceContext;
-    static std::map<std::string, JsModuleRecord> moduleRecordMap;
+    // Per thread, for ch -Workers, where every thread runs a runtime of its own.
+    static thread_local MessageQueue *messageQueue;
+    static thread_local DWORD_PTR sourceContext;
+    static thread_local std::map<std::string, JsModuleRecord> moduleRecordMap;
 };
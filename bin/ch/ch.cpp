@@ -5,7 +5,7 @@
 #include "stdafx.h"
 #include "Core/AtomLockGuids.h"
 
-unsigned int MessageBase::s_messageCount = 0;
+thread_local unsigned int MessageBase::s_messageCount = 0;
 Debugger* Debugger::debugger = nullptr;
 
 #ifdef _WIN32
@@ -24,6 +24,10 @@ UINT32 snapInterval = MAXUINT32;
 UINT32 snapHistoryLength = MAXUINT32;
 UINT32 startEventCount = 1;
 
+UINT32 benchmarkIterations = 0;
+UINT32 benchmarkWarmup = 0;
+UINT32 workerCount = 0;
+
 extern "C"
 HRESULT __stdcall OnChakraCoreLoadedEntry(TestHooks& testHooks)
 {
@@ -363,6 +367,7 @@ Error:
             JsValueRef exception = JS_INVALID_REFERENCE;
             ChakraRTInterface::JsGetAndClearException(&exception);
         }
+        WScriptJsrt::RemoveMessageQueue(messageQueue);
         delete messageQueue;
     }
     return hr;
@@ -434,6 +439,281 @@ Error:
     return hr;
 }
 
+static unsigned long long GetMicroseconds()
+{
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (counter.QuadPart / frequency.QuadPart) * 1000000 + (counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+}
+
+struct BenchmarkRun
+{
+    unsigned long long totalMicroseconds;
+    JsRuntimeStatistics statistics;
+
+    unsigned long long GetExecutionMicroseconds() const
+    {
+        // Whatever isn't spent compiling or collecting; a collection in the middle of a parse is subtracted twice.
+        unsigned long long other = statistics.parseMicroseconds + statistics.byteCodeGenMicroseconds + statistics.gcPauseMicroseconds;
+        return totalMicroseconds > other ? totalMicroseconds - other : 0;
+    }
+};
+
+static int CompareBenchmarkRuns(const void *a, const void *b)
+{
+    unsigned long long aTotal = static_cast<const BenchmarkRun *>(a)->totalMicroseconds;
+    unsigned long long bTotal = static_cast<const BenchmarkRun *>(b)->totalMicroseconds;
+    return aTotal < bTotal ? -1 : (aTotal > bTotal ? 1 : 0);
+}
+
+static void PrintJsonString(const char *str)
+{
+    putchar('"');
+    for (const char *c = str; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            putchar('\\');
+        }
+        putchar(*c);
+    }
+    putchar('"');
+}
+
+static void PrintBenchmarkRun(const BenchmarkRun& run)
+{
+    printf("{\"total_us\":%llu,\"parse_us\":%llu,\"bytecodegen_us\":%llu,\"execution_us\":%llu,"
+        "\"gc_pause_us\":%llu,\"gc_pause_count\":%llu,\"peak_memory_bytes\":%llu}",
+        run.totalMicroseconds, run.statistics.parseMicroseconds, run.statistics.byteCodeGenMicroseconds,
+        run.GetExecutionMicroseconds(), run.statistics.gcPauseMicroseconds, run.statistics.gcPauseCount,
+        (unsigned long long)run.statistics.peakMemoryUsage);
+}
+
+// Runs the script benchmarkWarmup times, then benchmarkIterations times measured, each time in a new context of
+// the same runtime and after a full collection, and prints the measurements as a single line of JSON.
+HRESULT RunBenchmark(JsRuntimeHandle runtime, const char* fileName, LPCSTR fileContents, char *fullPath)
+{
+    HRESULT hr = S_OK;
+    BenchmarkRun *runs = new BenchmarkRun[benchmarkIterations];
+    BenchmarkRun median = {};
+
+    for (int i = -(int)benchmarkWarmup; i < (int)benchmarkIterations; i++)
+    {
+        IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(nullptr));
+        IfJsErrorFailLog(ChakraRTInterface::JsCollectGarbage(runtime));
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        IfJsErrorFailLog(ChakraRTInterface::JsCreateContext(runtime, &context));
+        IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(context));
+        if (!WScriptJsrt::Initialize())
+        {
+            IfFailGo(E_FAIL);
+        }
+
+        IfJsErrorFailLog(ChakraRTInterface::JsResetRuntimeStatistics(runtime));
+        unsigned long long start = GetMicroseconds();
+        IfFailGo(RunScript(fileName, fileContents, nullptr, fullPath));
+        unsigned long long total = GetMicroseconds() - start;
+
+        if (i >= 0)
+        {
+            runs[i].totalMicroseconds = total;
+            IfJsErrorFailLog(ChakraRTInterface::JsGetRuntimeStatistics(runtime, &runs[i].statistics));
+        }
+    }
+
+    // The run with the median total time, which is less noisy than the mean over a few runs.
+    if (benchmarkIterations > 0)
+    {
+        BenchmarkRun *sorted = new BenchmarkRun[benchmarkIterations];
+        memcpy(sorted, runs, benchmarkIterations * sizeof(BenchmarkRun));
+        qsort(sorted, benchmarkIterations, sizeof(BenchmarkRun), CompareBenchmarkRuns);
+        median = sorted[benchmarkIterations / 2];
+        delete[] sorted;
+    }
+
+    printf("{\"file\":");
+    PrintJsonString(fileName);
+    printf(",\"warmup\":%u,\"runs\":[", benchmarkWarmup);
+    for (UINT32 i = 0; i < benchmarkIterations; i++)
+    {
+        if (i != 0)
+        {
+            putchar(',');
+        }
+        PrintBenchmarkRun(runs[i]);
+    }
+    printf("],\"median\":");
+    PrintBenchmarkRun(median);
+    printf("}\n");
+    fflush(stdout);
+
+Error:
+    delete[] runs;
+    return hr;
+}
+
+struct Worker
+{
+    const char* fileName;
+    LPCSTR fileContents;
+    char *fullPath;
+    UINT32 iterations;
+    unsigned long long *latencies;
+    unsigned long long startTime;
+    unsigned long long endTime;
+    HRESULT hr;
+};
+
+static int CompareLatencies(const void *a, const void *b)
+{
+    unsigned long long aLatency = *static_cast<const unsigned long long *>(a);
+    unsigned long long bLatency = *static_cast<const unsigned long long *>(b);
+    return aLatency < bLatency ? -1 : (aLatency > bLatency ? 1 : 0);
+}
+
+// Nearest rank percentile of sorted latencies.
+static unsigned long long GetPercentile(const unsigned long long *latencies, UINT32 count, UINT32 percentile)
+{
+    UINT32 rank = (UINT32)(((unsigned long long)count * percentile + 99) / 100);
+    return latencies[rank > 0 ? rank - 1 : 0];
+}
+
+static DWORD WINAPI WorkerThreadProc(LPVOID lpParam)
+{
+    Worker *worker = static_cast<Worker *>(lpParam);
+    HRESULT hr = S_OK;
+    JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+    int i = -(int)benchmarkWarmup;
+
+    IfFailGo(CreateRuntime(&runtime));
+    for (; i < (int)worker->iterations; i++)
+    {
+        JsContextRef context = JS_INVALID_REFERENCE;
+        IfJsErrorFailLog(ChakraRTInterface::JsCreateContext(runtime, &context));
+        IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(context));
+        if (!WScriptJsrt::Initialize())
+        {
+            IfFailGo(E_FAIL);
+        }
+
+        unsigned long long start = GetMicroseconds();
+        IfFailGo(RunScript(worker->fileName, worker->fileContents, nullptr, worker->fullPath));
+        unsigned long long end = GetMicroseconds();
+        IfJsErrorFailLog(ChakraRTInterface::JsSetCurrentContext(nullptr));
+
+        if (i == 0)
+        {
+            worker->startTime = start;
+        }
+        if (i >= 0)
+        {
+            worker->latencies[i] = end - start;
+            worker->endTime = end;
+        }
+    }
+
+Error:
+    if (runtime != JS_INVALID_RUNTIME_HANDLE)
+    {
+        ChakraRTInterface::JsSetCurrentContext(nullptr);
+        ChakraRTInterface::JsDisposeRuntime(runtime);
+    }
+    // IfJsErrorFailLog leaves hr alone; the latencies are only complete if every iteration ran.
+    worker->hr = SUCCEEDED(hr) && i < (int)worker->iterations ? E_FAIL : hr;
+    return 0;
+}
+
+// Runs the script in workerCount runtimes at once, each on a thread of its own, benchmarkWarmup times and then
+// benchmarkIterations times measured (at least once), each time in a new context. Prints the throughput of all
+// the runtimes together and the latency percentiles of each as a single line of JSON.
+HRESULT RunWorkers(const char* fileName, LPCSTR fileContents)
+{
+    HRESULT hr = S_OK;
+    char fullPath[_MAX_PATH];
+    UINT32 iterations = benchmarkIterations > 0 ? benchmarkIterations : 1;
+    Worker *workers = new Worker[workerCount];
+    HANDLE *threads = new HANDLE[workerCount];
+    UINT32 threadCount = 0;
+    unsigned long long startTime = 0;
+    unsigned long long endTime = 0;
+
+    for (UINT32 i = 0; i < workerCount; i++)
+    {
+        workers[i].fileName = fileName;
+        workers[i].fileContents = fileContents;
+        workers[i].fullPath = fullPath;
+        workers[i].iterations = iterations;
+        workers[i].latencies = new unsigned long long[iterations];
+        workers[i].startTime = 0;
+        workers[i].endTime = 0;
+        workers[i].hr = E_FAIL;
+    }
+
+    if (_fullpath(fullPath, fileName, _MAX_PATH) == nullptr)
+    {
+        IfFailGo(E_FAIL);
+    }
+
+    for (; threadCount < workerCount; threadCount++)
+    {
+        threads[threadCount] = CreateThread(nullptr, 0, WorkerThreadProc, &workers[threadCount], 0, nullptr);
+        if (threads[threadCount] == nullptr)
+        {
+            fwprintf(stderr, _u("FATAL ERROR: failed to create worker thread, exiting\n"));
+            IfFailGo(E_FAIL);
+        }
+    }
+
+Error:
+    for (UINT32 i = 0; i < threadCount; i++)
+    {
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+        if (FAILED(workers[i].hr))
+        {
+            hr = workers[i].hr;
+        }
+    }
+
+    if (SUCCEEDED(hr))
+    {
+        // Throughput over the time any runtime was running a measured iteration.
+        startTime = workers[0].startTime;
+        endTime = workers[0].endTime;
+        for (UINT32 i = 1; i < workerCount; i++)
+        {
+            startTime = workers[i].startTime < startTime ? workers[i].startTime : startTime;
+            endTime = workers[i].endTime > endTime ? workers[i].endTime : endTime;
+        }
+        unsigned long long wallMicroseconds = endTime > startTime ? endTime - startTime : 1;
+
+        printf("{\"file\":");
+        PrintJsonString(fileName);
+        printf(",\"workers\":%u,\"iterations\":%u,\"warmup\":%u,\"wall_us\":%llu,\"runs_per_second\":%.3f,\"worker_latency_us\":[",
+            workerCount, iterations, benchmarkWarmup, wallMicroseconds, (double)workerCount * iterations * 1000000 / wallMicroseconds);
+        for (UINT32 i = 0; i < workerCount; i++)
+        {
+            unsigned long long *latencies = workers[i].latencies;
+            qsort(latencies, iterations, sizeof(unsigned long long), CompareLatencies);
+            printf("%s{\"p50\":%llu,\"p90\":%llu,\"p99\":%llu,\"max\":%llu}", i == 0 ? "" : ",",
+                GetPercentile(latencies, iterations, 50), GetPercentile(latencies, iterations, 90),
+                GetPercentile(latencies, iterations, 99), latencies[iterations - 1]);
+        }
+        printf("]}\n");
+        fflush(stdout);
+    }
+
+    for (UINT32 i = 0; i < workerCount; i++)
+    {
+        delete[] workers[i].latencies;
+    }
+    delete[] threads;
+    delete[] workers;
+    return hr;
+}
+
 HRESULT ExecuteTest(const char* fileName)
 {
     HRESULT hr = S_OK;
@@ -478,6 +758,12 @@ HRESULT ExecuteTest(const char* fileName)
         contentsRaw; lengthBytes; // Unused for now.
 
         IfFailGo(hr);
+        if (workerCount > 0)
+        {
+            // The workers create their own runtimes.
+            IfFailGo(RunWorkers(fileName, fileContents));
+            goto Error;
+        }
         if (HostConfigFlags::flags.GenerateLibraryByteCodeHeaderIsEnabled)
         {
             jsrtAttributes = (JsRuntimeAttributes)(jsrtAttributes | JsRuntimeAttributeSerializeLibraryByteCode);
@@ -572,6 +858,10 @@ HRESULT ExecuteTest(const char* fileName)
         {
             CreateAndRunSerializedScript(fileName, fileContents, fullPath);
         }
+        else if (benchmarkIterations > 0)
+        {
+            IfFailGo(RunBenchmark(runtime, fileName, fileContents, fullPath));
+        }
         else
         {
             IfFailGo(RunScript(fileName, fileContents, nullptr, fullPath));
@@ -693,6 +983,22 @@ int _cdecl wmain(int argc, __in_ecount(argc) LPWSTR argv[])
             LPCWSTR startEventStr = argv[i] + wcslen(_u("-TTDStartEvent="));
             startEventCount = (UINT32)_wtoi(startEventStr);
         }
+        else if(wcsstr(argv[i], _u("-Benchmark=")) == argv[i])
+        {
+            // Handled here rather than as a host flag, so that it works in release builds.
+            LPCWSTR iterationsStr = argv[i] + wcslen(_u("-Benchmark="));
+            benchmarkIterations = (UINT32)_wtoi(iterationsStr);
+        }
+        else if(wcsstr(argv[i], _u("-BenchmarkWarmup=")) == argv[i])
+        {
+            LPCWSTR warmupStr = argv[i] + wcslen(_u("-BenchmarkWarmup="));
+            benchmarkWarmup = (UINT32)_wtoi(warmupStr);
+        }
+        else if(wcsstr(argv[i], _u("-Workers=")) == argv[i])
+        {
+            LPCWSTR workersStr = argv[i] + wcslen(_u("-Workers="));
+            workerCount = (UINT32)_wtoi(workersStr);
+        }
         else
         {
             argv[cpos] = argv[i];
@@ -707,6 +1013,12 @@ int _cdecl wmain(int argc, __in_ecount(argc) LPWSTR argv[])
         ExitProcess(0);
     }
 
+    if(workerCount > 0 && (doTTRecord || doTTDebug))
+    {
+        fwprintf(stderr, _u("Cannot time travel with workers!!!"));
+        ExitProcess(0);
+    }
+
     HostConfigFlags::pfnPrintUsage = PrintUsageFormat;
 
     // The following code is present to make sure we don't load
@@ -104,6 +104,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "DataStructures/StringBuilder.h"
 #include "DataStructures/WeakReferenceDictionary.h"
 #include "DataStructures/LeafValueDictionary.h"
+#include "DataStructures/OpenAddressingDictionary.h"
 #include "DataStructures/Dictionary.h"
 #include "DataStructures/List.h"
 #include "DataStructures/Stack.h"
@@ -116,6 +116,14 @@
 #define ENABLE_CUSTOM_ENTROPY
 #endif
 
+// Other builds get SIMD.js only when configured with it (build.sh --simdjs defines ENABLE_SIMDJS)
+
+// Statistical profiler for script frames, exposed through JSRT. Unlike script profiling, it needs nothing from the host.
+#define ENABLE_SAMPLING_PROFILER 1
+
+// Streaming snapshots of the script object graph, exposed through JSRT.
+#define ENABLE_HEAP_SNAPSHOT 1
+
 // GC features
 
 // Concurrent and Partial GC are disabled on non-Windows builds
@@ -158,12 +166,10 @@
 #define ENABLE_BACKGROUND_PARSING 0                 // Disable background parsing in this mode
                                                     // We need to decouple the Jobs infrastructure out of
                                                     // Backend to make background parsing work with JIT disabled
+#define ENABLE_PARALLEL_MODULE_PARSING 0
 #define DYNAMIC_INTERPRETER_THUNK 0
 #define DISABLE_DYNAMIC_PROFILE_DEFER_PARSE
 #define ENABLE_COPYONACCESS_ARRAY 0
-
-// Used to temporarily disable ASMjs related code to get nonative compiling
-#define TEMP_DISABLE_ASMJS
 #else
 // By default, enable the JIT
 #define ENABLE_NATIVE_CODEGEN 1
@@ -171,6 +177,7 @@
 
 #define ENABLE_BACKGROUND_JOB_PROCESSOR 1
 #define ENABLE_BACKGROUND_PARSING 1
+#define ENABLE_PARALLEL_MODULE_PARSING 1            // Parse imported ES6 modules on the background job processor
 #define ENABLE_COPYONACCESS_ARRAY 1
 #ifndef DYNAMIC_INTERPRETER_THUNK
 #if defined(_M_IX86_OR_ARM32) || defined(_M_X64_OR_ARM64)
@@ -181,6 +188,13 @@
 #endif
 #endif
 
+// Per function interpreter entry thunks that Linux perf can name, for builds without the dynamic interpreter thunk
+#if defined(__linux__) && defined(_M_X64) && !DYNAMIC_INTERPRETER_THUNK
+#define ENABLE_PERF_MAP_INTERPRETER_THUNK 1
+#else
+#define ENABLE_PERF_MAP_INTERPRETER_THUNK 0
+#endif
+
 // Other features
 // #define CHAKRA_CORE_DOWN_COMPAT 1
 
@@ -555,11 +569,11 @@
 #endif
 #endif
 
+// asm.js validation and the asm.js interpreter are available without the native backend;
+// the template JIT and the native thunks additionally require ENABLE_NATIVE_CODEGEN
 #if defined(_M_IX86) || defined(_M_X64)
-#ifndef TEMP_DISABLE_ASMJS
 #define ASMJS_PLAT
 #endif
-#endif
 
 #if _WIN32 || _WIN64
 #if _M_IX86
@@ -10,6 +10,7 @@ PHASE(All)
     PHASE(Parse)
         PHASE(RegexCompile)
         PHASE(DeferParse)
+        PHASE(Redeferral)
         PHASE(DeferEventHandlers)
         PHASE(FunctionSourceInfoParse)
         PHASE(StringTemplateParse)
@@ -17,6 +18,7 @@ PHASE(All)
         PHASE(CacheScopeInfoNames)
         PHASE(ScanAhead)
         PHASE(ParallelParse)
+        PHASE(ParallelModuleParse)
         PHASE(EarlyReferenceErrors)
     PHASE(ByteCode)
         PHASE(CachedScope)
@@ -231,6 +233,7 @@ PHASE(All)
 #endif
     PHASE(Run)
         PHASE(Interpreter)
+            PHASE(Quickening)
         PHASE(EvalCompile)
             PHASE(FastIndirectEval)
         PHASE(IdleDecommit)
@@ -287,6 +290,7 @@ PHASE(All)
         PHASE(InlineHostCandidate)
         PHASE(ScriptFunctionWithInlineCache)
         PHASE(IsConcatSpreadableCache)
+        PHASE(EnumerationCache)
         PHASE(Arena)
         PHASE(ApplyUsage)
         PHASE(ObjectHeaderInlining)
@@ -374,6 +378,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_Prejit               (false)
 #define DEFAULT_CONFIG_DeferNested          (true)
 #define DEFAULT_CONFIG_DeferTopLevelTillFirstCall (true)
+#define DEFAULT_CONFIG_Redeferral           (false)
+#define DEFAULT_CONFIG_RedeferralInactiveThreshold (5)    // Number of GCs a function must go uncalled before its byte code is released
 #define DEFAULT_CONFIG_DirectCallTelemetryStats (false)
 #define DEFAULT_CONFIG_errorStackTrace      (true)
 #define DEFAULT_CONFIG_FastPathCap          (-1)        // By default, we do not have any fast path cap
@@ -405,6 +411,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_InlineThresholdAdjustCountInSmallFunction  (10)
 #define DEFAULT_CONFIG_ConstructorInlineThreshold (21)      //Monomorphic constructor threshold
 #define DEFAULT_CONFIG_ConstructorCallsRequiredToFinalizeCachedType (2)
+#define DEFAULT_CONFIG_ConstructorInlineSlotCountLimit (32)
 #define DEFAULT_CONFIG_OutsideLoopInlineThreshold (16)      //Threshold to inline outside loops
 #define DEFAULT_CONFIG_LeafInlineThreshold  (60)            //Inlinee threshold for function which is leaf (irrespective of it has loops or not)
 #define DEFAULT_CONFIG_LoopInlineThreshold  (25)            //Inlinee threshold for function with loops
@@ -434,6 +441,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_LoopProfileIterations (25)
 #define DEFAULT_CONFIG_JitLoopBodyHotLoopThreshold (20000)
 #define DEFAULT_CONFIG_LoopBodySizeThresholdToDisableOpts (255)
+#define DEFAULT_CONFIG_QuickeningDeoptLimit (16)
+#define DEFAULT_CONFIG_QuickeningThreshold (2)
 
 #define DEFAULT_CONFIG_MaxJitThreadCount        (2)
 #define DEFAULT_CONFIG_ForceMaxJitThreadCount   (false)
@@ -637,9 +646,11 @@ PHASE(All)
 #define DEFAULT_CONFIG_Sse                  (-1)
 
 #define DEFAULT_CONFIG_DeletedPropertyReuseThreshold (32)
+#define DEFAULT_CONFIG_DeleteLastPropertyOnPathTypes (true)
 #define DEFAULT_CONFIG_BigDictionaryTypeHandlerThreshold (0xffff)
 #define DEFAULT_CONFIG_ForceStringKeyedSimpleDictionaryTypeHandler (false)
 #define DEFAULT_CONFIG_TypeSnapshotEnumeration (true)
+#define DEFAULT_CONFIG_ObjectBuiltinsUseEnumerationCache (true)
 #define DEFAULT_CONFIG_EnumerationCompat    (false)
 #define DEFAULT_CONFIG_ConcurrentRuntime (false)
 #define DEFAULT_CONFIG_PrimeRecycler     (false)
@@ -648,6 +659,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_DisableDebugObject (false)
 #define DEFAULT_CONFIG_DumpHeap (false)
 #define DEFAULT_CONFIG_PerfHintLevel (1)
+#define DEFAULT_CONFIG_PerfMap (false)
+#define DEFAULT_CONFIG_PerfJitDump (false)
 
 #define DEFAULT_CONFIG_FailFastIfDisconnectedDelegate    (false)
 
@@ -862,6 +875,7 @@ FLAGNR(Boolean, ConsoleExitPause      , "Pause on exit when a console window is
 #endif
 FLAGNR(Number,  ConstructorInlineThreshold      , "Maximum size in bytecodes of a constructor inline candidate with monomorphic field access", DEFAULT_CONFIG_ConstructorInlineThreshold)
 FLAGNR(Number,  ConstructorCallsRequiredToFinalizeCachedType, "Number of calls to a constructor required before the type cached in the constructor cache is finalized", DEFAULT_CONFIG_ConstructorCallsRequiredToFinalizeCachedType)
+FLAGNR(Number,  ConstructorInlineSlotCountLimit, "Maximum number of inline slots reserved for objects from a constructor whose first objects outgrew the default inline slots, before the cached type is finalized (0 to disable)", DEFAULT_CONFIG_ConstructorInlineSlotCountLimit)
 #ifdef SECURITY_TESTING
 FLAGNR(Boolean, CrashOnException      , "Removes the top-level exception handler, allowing jc.exe to crash on an unhandled exception.  No effect on IE. (default: false)", false)
 #endif
@@ -870,6 +884,8 @@ FLAGNR(NumberSet,  DebugBreak         , "Index of the function where you want to
 FLAGNR(Boolean, DebugWindow           , "Send console output to debugger window", false)
 FLAGNR(Boolean, DeferNested           , "Enable deferred parsing of nested function", DEFAULT_CONFIG_DeferNested)
 FLAGNR(Boolean, DeferTopLevelTillFirstCall      , "Enable tracking of deferred top level functions in a script file, until the first function of the script context is parsed.", DEFAULT_CONFIG_DeferTopLevelTillFirstCall)
+FLAGNR(Boolean, Redeferral            , "Release the byte code of cold, previously deferred functions at GC time and reparse them on their next call", DEFAULT_CONFIG_Redeferral)
+FLAGNR(Number,  RedeferralInactiveThreshold, "Number of GCs a function must go without being called before redeferral releases its byte code", DEFAULT_CONFIG_RedeferralInactiveThreshold)
 FLAGNR(Number,  DeferParse            , "Minimum size of defer-parsed script (non-zero only: use /nodeferparse do disable", 0)
 FLAGNR(Boolean, DirectCallTelemetryStats, "Enables logging stats for direct call telemetry", DEFAULT_CONFIG_DirectCallTelemetryStats)
 FLAGNR(Boolean, DisableArrayBTree     , "Disable creation of BTree for Arrays", false)
@@ -1145,6 +1161,8 @@ FLAGNR(Number,  MinInterpretCount     , "Minimum number of times a function must
 FLAGNR(Number,  MinSimpleJitRunCount  , "Minimum number of times a function must be run in simple jit", 0)
 FLAGNRA(Number, MaxInterpretCount     , Mic, "Maximum number of times a function can be interpreted", 0)
 FLAGNRA(Number, MaxSimpleJitRunCount  , Msjrc, "Maximum number of times a function will be run in SimpleJitted code", 0)
+FLAGNR(Number,  QuickeningDeoptLimit  , "Number of times a quickened opcode in a function may revert to its generic form before the interpreter stops quickening the function", DEFAULT_CONFIG_QuickeningDeoptLimit)
+FLAGNR(Number,  QuickeningThreshold   , "Number of times a function must be interpreted before the interpreter makes the private byte code copy it quickens", DEFAULT_CONFIG_QuickeningThreshold)
 FLAGNRA(Number, MinMemOpCount         , Mmoc, "Minimum count of a loop to activate MemOp", DEFAULT_CONFIG_MinMemOpCount)
 
 #if ENABLE_COPYONACCESS_ARRAY
@@ -1383,9 +1401,11 @@ FLAGR(Boolean, FailFastIfDisconnectedDelegate, "When set fail fast if disconnect
 #endif
 FLAGNR(Number, Sse, "Virtually disables SSE-based optimizations above the specified SSE level in the Chakra JIT (does not affect CRT SSE usage)", DEFAULT_CONFIG_Sse)
 FLAGNR(Number,  DeletedPropertyReuseThreshold, "Start reusing deleted property indexes after this many properties are deleted. Zero to disable reuse.", DEFAULT_CONFIG_DeletedPropertyReuseThreshold)
+FLAGNR(Boolean, DeleteLastPropertyOnPathTypes, "Deleting the last added property of an object with a path type moves it back to the previous type on the path instead of converting it to a dictionary type", DEFAULT_CONFIG_DeleteLastPropertyOnPathTypes)
 FLAGNR(Boolean, ForceStringKeyedSimpleDictionaryTypeHandler, "Force switch to string keyed version of SimpleDictionaryTypeHandler on first new property added to a SimpleDictionaryTypeHandler", DEFAULT_CONFIG_ForceStringKeyedSimpleDictionaryTypeHandler)
 FLAGNR(Number,  BigDictionaryTypeHandlerThreshold, "Min Slot Capacity required to convert DictionaryTypeHandler to BigDictionaryTypeHandler.(Advisable to give more than 15 - to avoid false positive cases)", DEFAULT_CONFIG_BigDictionaryTypeHandlerThreshold)
 FLAGNR(Boolean, TypeSnapshotEnumeration, "Create a true snapshot of the type of an object before enumeration and enumerate only those properties.", DEFAULT_CONFIG_TypeSnapshotEnumeration)
+FLAGNR(Boolean, ObjectBuiltinsUseEnumerationCache, "Object.keys, Object.values, Object.entries and Object.assign take the properties of objects with a path type from the type's enumeration cache and read their slots directly", DEFAULT_CONFIG_ObjectBuiltinsUseEnumerationCache)
 FLAGR (Boolean, EnumerationCompat,      "When set in IE10 mode, restores enumeration behavior to RC behavior", DEFAULT_CONFIG_EnumerationCompat)
 FLAGNR(Boolean, IsolatePrototypes, "Should prototypes get unique types not shared with other objects (default: true)?", DEFAULT_CONFIG_IsolatePrototypes)
 FLAGNR(Boolean, ChangeTypeOnProto, "When becoming a prototype should the object switch to a new type (default: true)?", DEFAULT_CONFIG_ChangeTypeOnProto)
@@ -1394,6 +1414,8 @@ FLAGNR(Boolean, DisableDebugObject, "Disable test only Debug object properties",
 FLAGNR(Boolean, DumpHeap, "enable Debug.dumpHeap even when DisableDebugObject is set", DEFAULT_CONFIG_DumpHeap)
 FLAGNR(String, autoProxy, "enable creating proxy for each object creation", _u("__msTestHandler"))
 FLAGNR(Number,  PerfHintLevel, "Specifies the perf-hint level (1,2) 1 == critical, 2 == only noisy", DEFAULT_CONFIG_PerfHintLevel)
+FLAGR(Boolean, PerfMap, "Give each interpreted function its own entry thunk and list them in /tmp/perf-<pid>.map for Linux perf", DEFAULT_CONFIG_PerfMap)
+FLAGR(Boolean, PerfJitDump, "Like -PerfMap, but write the thunks to jit-<pid>.dump for perf inject --jit", DEFAULT_CONFIG_PerfJitDump)
 #ifdef INTERNAL_MEM_PROTECT_HEAP_ALLOC
 FLAGNR(Boolean, MemProtectHeap, "Use the mem protect heap as the default heap", DEFAULT_CONFIG_MemProtectHeap)
 #endif
@@ -0,0 +1,752 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////
+// Dictionary with the entry layout of BaseDictionary and an open addressing index, for the property maps of the
+// dictionary type handlers.
+//
+// ENTRIES
+// Entries are kept in one contiguous array in insertion order, and removed entries are free-listed and reused in the
+// same order as BaseDictionary does, so an entry index is as stable as it is in BaseDictionary. The type handlers
+// depend on that: they use the entry index as the property index.
+//
+// INDEX
+// Lookups go through a power of 2 array of slots holding the tagged hash code of an entry next to its index. The hash
+// code picks a slot with a multiplicative hash and collisions probe linearly, so most probes stay in the cache line of
+// the first slot, and a slot whose hash code doesn't match is skipped without touching its entry. Slots are at most
+// three quarters full. A removed entry leaves a deleted slot behind unless it ended a probe run; deleted slots are
+// dropped whenever the slots are rebuilt.
+//
+// Compared to BaseDictionary, a hit reads the same two cache lines (slot and entry), but a miss or a collision no
+// longer reads the entries of a chain.
+//
+// SMALL DICTIONARIES
+// Slots cost 8 bytes each against the 4 bytes of a BaseDictionary bucket, and there are more of them than entries. Up
+// to MaxLinearScanSize entries there is no index at all: lookups scan the entries, which fit in a few cache lines, so a
+// small dictionary costs less than a BaseDictionary of the same size. The slots are built when the entries grow past
+// that size.
+//
+namespace JsUtil
+{
+    template <
+        class TKey,
+        class TValue,
+        class TAllocator,
+        template <typename ValueOrKey> class Comparer = DefaultComparer,
+        template <typename K, typename V> class Entry = SimpleDictionaryEntry
+    >
+    class OpenAddressingDictionary
+    {
+    public:
+        typedef TKey KeyType;
+        typedef TValue ValueType;
+        typedef typename AllocatorInfo<TAllocator, TValue>::AllocatorType AllocatorType;
+        typedef Entry<TKey, TValue> EntryType;
+
+        template<class TDictionary> class EntryIterator;
+
+    private:
+        typedef typename AllocatorInfo<TAllocator, TValue>::AllocatorFunc EntryAllocatorFuncType;
+
+        struct Slot
+        {
+            hash_t hashCode;    // Tagged hash code of the entry, 0 if there is no entry
+            int entryIndex;     // Index of the entry, EmptySlot or DeletedSlot
+        };
+
+        static const int EmptySlot = -1;
+        static const int DeletedSlot = -2;
+        static const int MaxLinearScanSize = 8;
+
+        EntryType* entries;
+        Slot* slots;
+        AllocatorType* alloc;
+        int size;
+        uint slotCount;
+        uint slotShift;         // 32 - log2(slotCount)
+        uint deletedSlotCount;
+        int count;
+        int freeList;
+        int freeCount;
+
+        enum InsertOperations
+        {
+            Insert_Add,             // FatalInternalError if the item already exist in debug build
+            Insert_AddNew,          // Ignore add if the item already exist
+            Insert_Item             // Replace the item if it already exist
+        };
+
+    public:
+        OpenAddressingDictionary(AllocatorType* allocator, int capacity = 0)
+            : entries(nullptr),
+            slots(nullptr),
+            alloc(allocator),
+            size(0),
+            slotCount(0),
+            slotShift(0),
+            deletedSlotCount(0),
+            count(0),
+            freeList(0),
+            freeCount(0)
+        {
+            Assert(allocator);
+
+            // If initial capacity is negative or 0, lazy initialization on
+            // the first insert operation is performed.
+            if (capacity > 0)
+            {
+                Initialize(capacity);
+            }
+        }
+
+        ~OpenAddressingDictionary()
+        {
+            if (slots)
+            {
+                DeleteSlots(slots, slotCount);
+            }
+
+            if (entries)
+            {
+                DeleteEntries(entries, size);
+            }
+        }
+
+        AllocatorType *GetAllocator() const
+        {
+            return alloc;
+        }
+
+        inline int Capacity() const
+        {
+            return size;
+        }
+
+        inline int Count() const
+        {
+            return count - freeCount;
+        }
+
+        TValue Item(const TKey& key)
+        {
+            int i = FindEntry(key);
+            Assert(i >= 0);
+            return entries[i].Value();
+        }
+
+        int Add(const TKey& key, const TValue& value)
+        {
+            return Insert<Insert_Add>(key, value);
+        }
+
+        int AddNew(const TKey& key, const TValue& value)
+        {
+            return Insert<Insert_AddNew>(key, value);
+        }
+
+        int Item(const TKey& key, const TValue& value)
+        {
+            return Insert<Insert_Item>(key, value);
+        }
+
+        bool ContainsKey(const TKey& key) const
+        {
+            return FindEntry(key) >= 0;
+        }
+
+        template <typename TLookup>
+        inline const TValue& LookupWithKey(const TLookup& key, const TValue& defaultValue) const
+        {
+            int i = FindEntryWithKey(key);
+            if (i >= 0)
+            {
+                return entries[i].Value();
+            }
+            return defaultValue;
+        }
+
+        template <typename TLookup>
+        bool TryGetValue(const TLookup& key, TValue* value) const
+        {
+            int i = FindEntryWithKey(key);
+            if (i >= 0)
+            {
+                *value = entries[i].Value();
+                return true;
+            }
+            return false;
+        }
+
+        template <typename TLookup>
+        bool TryGetReference(const TLookup& key, const TValue** value) const
+        {
+            int i;
+            return TryGetReference(key, value, &i);
+        }
+
+        template <typename TLookup>
+        bool TryGetReference(const TLookup& key, TValue** value) const
+        {
+            return TryGetReference(key, const_cast<const TValue **>(value));
+        }
+
+        template <typename TLookup>
+        bool TryGetReference(const TLookup& key, const TValue** value, int* index) const
+        {
+            int i = FindEntryWithKey(key);
+            if (i >= 0)
+            {
+                *value = &entries[i].Value();
+                *index = i;
+                return true;
+            }
+            return false;
+        }
+
+        template <typename TLookup>
+        bool TryGetReference(const TLookup& key, TValue** value, int* index) const
+        {
+            return TryGetReference(key, const_cast<const TValue **>(value), index);
+        }
+
+        const TValue& GetValueAt(const int index) const
+        {
+            Assert(index >= 0);
+            Assert(index < count);
+
+            return entries[index].Value();
+        }
+
+        TValue* GetReferenceAt(const int index) const
+        {
+            Assert(index >= 0);
+            Assert(index < count);
+
+            return &entries[index].Value();
+        }
+
+        TKey const& GetKeyAt(const int index) const
+        {
+            Assert(index >= 0);
+            Assert(index < count);
+
+            return entries[index].Key();
+        }
+
+        bool TryGetValueAt(const int index, TValue const ** value) const
+        {
+            if (index >= 0 && index < count)
+            {
+                *value = &entries[index].Value();
+                return true;
+            }
+            return false;
+        }
+
+        bool TryGetValueAt(int index, TValue * value) const
+        {
+            if (index >= 0 && index < count)
+            {
+                *value = entries[index].Value();
+                return true;
+            }
+            return false;
+        }
+
+        bool Remove(const TKey& key)
+        {
+            uint slotIndex = 0;
+            int i = FindEntryWithKey(key, &slotIndex);
+            if (i >= 0)
+            {
+                RemoveAt(i, slotIndex);
+                return true;
+            }
+            return false;
+        }
+
+        EntryIterator<const OpenAddressingDictionary> GetIterator() const
+        {
+            return EntryIterator<const OpenAddressingDictionary>(*this);
+        }
+
+        EntryIterator<OpenAddressingDictionary> GetIterator()
+        {
+            return EntryIterator<OpenAddressingDictionary>(*this);
+        }
+
+        // Unlike BaseDictionary::Map, visits the entries in index order.
+        template<class Fn>
+        void Map(Fn fn) const
+        {
+            MapUntil([fn](TKey const& key, TValue const& value) -> bool
+            {
+                fn(key, value);
+                return false;
+            });
+        }
+
+        template<class Fn>
+        bool MapUntil(Fn fn) const
+        {
+            for (int i = 0; i < count; i++)
+            {
+                if (!IsFreeEntry(entries[i]) && fn(entries[i].Key(), entries[i].Value()))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns whether the dictionary was resized or not
+        bool EnsureCapacity()
+        {
+            if (freeCount == 0 && count == size)
+            {
+                Resize();
+                return true;
+            }
+
+            return false;
+        }
+
+        int GetNextIndex()
+        {
+            if (freeCount != 0)
+            {
+                Assert(freeCount > 0);
+                Assert(freeList >= 0);
+                Assert(freeList < count);
+                return freeList;
+            }
+
+            return count;
+        }
+
+        int GetLastIndex()
+        {
+            return count - 1;
+        }
+
+    private:
+        template <typename TLookup>
+        static hash_t GetHashCodeWithKey(const TLookup& key)
+        {
+            // set last bit to 1 to avoid false positive to make hash appears to be a valid recycler address.
+            // In the same line, 0 should be use to indicate a non-existing entry.
+            return TAGHASH(Comparer<TLookup>::GetHashCode(key));
+        }
+
+        static hash_t GetHashCode(const TKey& key)
+        {
+            return GetHashCodeWithKey<TKey>(key);
+        }
+
+        static uint GetSlotIndex(hash_t hashCode, uint slotShift)
+        {
+            // Fibonacci hashing: property name hashes are poorly mixed in their low bits.
+            return (UNTAGHASH(hashCode) * 0x9E3779B9u) >> slotShift;
+        }
+
+        static uint GetSlotCount(int size)
+        {
+            // No slots while the entries are scanned; at most three quarters full once every entry is used otherwise.
+            if (size <= MaxLinearScanSize)
+            {
+                return 0;
+            }
+            return PowerOf2Policy::GetSize((size_t)size + (size + 2) / 3);
+        }
+
+        static bool IsFreeEntry(const EntryType &entry)
+        {
+            // A free entry's next index will be (-2 - nextIndex), such that it is always <= -2, for fast entry iteration
+            // allowing for skipping over free entries. Used entries have a next of -1; the slots do the chaining.
+            return entry.next <= -2;
+        }
+
+        void SetNextFreeEntryIndex(EntryType &freeEntry, const int nextFreeEntryIndex)
+        {
+            Assert(!IsFreeEntry(freeEntry));
+            Assert(nextFreeEntryIndex >= -1);
+            Assert(nextFreeEntryIndex < count);
+
+            // The last entry in the free list chain will have a next of -2 to indicate that it is a free entry. The end of the
+            // free list chain is identified using freeCount.
+            freeEntry.next = nextFreeEntryIndex >= 0 ? -2 - nextFreeEntryIndex : -2;
+        }
+
+        static int GetNextFreeEntryIndex(const EntryType &freeEntry)
+        {
+            Assert(IsFreeEntry(freeEntry));
+            return -2 - freeEntry.next;
+        }
+
+        template <typename LookupType>
+        inline int FindEntryWithKey(const LookupType& key, uint *const foundSlotIndex = nullptr) const
+        {
+            Slot * localSlots = slots;
+            EntryType * localEntries = entries;
+            if (localSlots == nullptr)
+            {
+                // Small dictionary: foundSlotIndex is not used without slots.
+                Assert(size <= MaxLinearScanSize);
+                if (localEntries != nullptr)
+                {
+                    hash_t hashCode = GetHashCodeWithKey<LookupType>(key);
+                    for (int i = 0; i < count; i++)
+                    {
+                        if (!IsFreeEntry(localEntries[i]) && localEntries[i].template KeyEquals<Comparer<TKey>>(key, hashCode))
+                        {
+                            return i;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                hash_t hashCode = GetHashCodeWithKey<LookupType>(key);
+                uint mask = slotCount - 1;
+
+                // There is always an empty slot to end the probe.
+                for (uint slotIndex = GetSlotIndex(hashCode, slotShift); ; slotIndex = (slotIndex + 1) & mask)
+                {
+                    const Slot& slot = localSlots[slotIndex];
+                    if (slot.hashCode == hashCode)
+                    {
+                        if (localEntries[slot.entryIndex].template KeyEquals<Comparer<TKey>>(key, hashCode))
+                        {
+                            if (foundSlotIndex != nullptr)
+                            {
+                                *foundSlotIndex = slotIndex;
+                            }
+                            return slot.entryIndex;
+                        }
+                    }
+                    else if (slot.entryIndex == EmptySlot)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            return -1;
+        }
+
+        inline int FindEntry(const TKey& key) const
+        {
+            return FindEntryWithKey<TKey>(key);
+        }
+
+        void Initialize(int capacity)
+        {
+            // minimum capacity is 4
+            int initSize = max(capacity, 4);
+            uint initSlotCount = GetSlotCount(initSize);
+            Slot * newSlots = initSlotCount != 0 ? AllocateSlots(initSlotCount) : nullptr;
+            EntryType * newEntries;
+            try
+            {
+                newEntries = AllocateEntries(initSize);
+            }
+            catch(...)
+            {
+                if (newSlots != nullptr)
+                {
+                    DeleteSlots(newSlots, initSlotCount);
+                }
+                throw;
+            }
+
+            // Allocation can throw - assign the size only after allocation has succeeded.
+            this->slots = newSlots;
+            this->entries = newEntries;
+            this->slotCount = initSlotCount;
+            this->slotShift = initSlotCount != 0 ? 32 - Math::Log2(initSlotCount) : 0;
+            this->size = initSize;
+            Assert(this->freeCount == 0);
+        }
+
+        template <InsertOperations op>
+        int Insert(TKey key, TValue value)
+        {
+            if (entries == nullptr)
+            {
+                Initialize(0);
+            }
+
+#if DBG
+            // Always search and verify
+            const bool needSearch = true;
+#else
+            const bool needSearch = (op != Insert_Add);
+#endif
+            hash_t hashCode = GetHashCode(key);
+            if (needSearch)
+            {
+                int i = FindEntryWithKey(key);
+                if (i >= 0)
+                {
+                    Assert(op != Insert_Add);
+                    if (op == Insert_Item)
+                    {
+                        entries[i].SetValue(value);
+                        return i;
+                    }
+                    return -1;
+                }
+            }
+
+            int index;
+            if (freeCount != 0)
+            {
+                Assert(freeCount > 0);
+                Assert(freeList >= 0);
+                Assert(freeList < count);
+                index = freeList;
+                freeCount--;
+                if (freeCount != 0)
+                {
+                    freeList = GetNextFreeEntryIndex(entries[index]);
+                }
+            }
+            else
+            {
+                if (count == size)
+                {
+                    Resize();
+                }
+                index = count;
+                count++;
+
+                Assert(count <= size);
+                Assert(index < size);
+            }
+
+            if (slots != nullptr && (Count() + deletedSlotCount) * 4 > slotCount * 3)
+            {
+                // Too many deleted slots; Count() already includes the new entry.
+                RebuildSlots(slotCount);
+            }
+
+            entries[index].Set(key, value, hashCode);
+            entries[index].next = -1;
+            if (slots != nullptr)
+            {
+                InsertSlot(slots, slotCount, slotShift, hashCode, index);
+            }
+            return index;
+        }
+
+        void InsertSlot(Slot * targetSlots, uint targetSlotCount, uint targetSlotShift, hash_t hashCode, int entryIndex)
+        {
+            uint mask = targetSlotCount - 1;
+            uint slotIndex = GetSlotIndex(hashCode, targetSlotShift);
+            while (targetSlots[slotIndex].entryIndex >= 0)
+            {
+                slotIndex = (slotIndex + 1) & mask;
+            }
+
+            if (targetSlots[slotIndex].entryIndex == DeletedSlot)
+            {
+                Assert(targetSlots == slots);
+                deletedSlotCount--;
+            }
+            targetSlots[slotIndex].hashCode = hashCode;
+            targetSlots[slotIndex].entryIndex = entryIndex;
+        }
+
+        void Resize()
+        {
+            int newSize = count * 2;
+            uint newSlotCount = GetSlotCount(newSize);
+
+            __analysis_assume(newSize > count);
+            EntryType * newEntries = AllocateEntries(newSize);
+            js_memcpy_s(newEntries, sizeof(EntryType) * newSize, entries, sizeof(EntryType) * count);
+            if (newSlotCount != slotCount)
+            {
+                try
+                {
+                    RebuildSlots(newSlotCount);
+                }
+                catch(...)
+                {
+                    DeleteEntries(newEntries, newSize);
+                    throw;
+                }
+            }
+
+            DeleteEntries(entries, size);
+            entries = newEntries;
+            size = newSize;
+        }
+
+        void RebuildSlots(uint newSlotCount)
+        {
+            Slot * newSlots = AllocateSlots(newSlotCount);
+            uint newSlotShift = 32 - Math::Log2(newSlotCount);
+            if (slots == nullptr)
+            {
+                // Leaving the linear scan: the hash codes come from the entries this one time.
+                for (int i = 0; i < count; i++)
+                {
+                    if (!IsFreeEntry(entries[i]))
+                    {
+                        InsertSlot(newSlots, newSlotCount, newSlotShift, entries[i].template GetHashCode<Comparer<TKey>>(), i);
+                    }
+                }
+            }
+            else
+            {
+                // The slots hold the hash codes, so this doesn't touch the entries.
+                for (uint i = 0; i < slotCount; i++)
+                {
+                    if (slots[i].entryIndex >= 0)
+                    {
+                        InsertSlot(newSlots, newSlotCount, newSlotShift, slots[i].hashCode, slots[i].entryIndex);
+                    }
+                }
+
+                DeleteSlots(slots, slotCount);
+            }
+
+            slots = newSlots;
+            slotCount = newSlotCount;
+            slotShift = newSlotShift;
+            deletedSlotCount = 0;
+        }
+
+        __ecount(slotCount) Slot *AllocateSlots(DECLSPEC_GUARD_OVERFLOW const uint slotCount)
+        {
+            Slot * newSlots =
+                AllocateArray<AllocatorType, Slot, false>(
+                    TRACK_ALLOC_INFO(alloc, Slot, AllocatorType, 0, slotCount),
+                    TypeAllocatorFunc<AllocatorType, Slot>::GetAllocFunc(),
+                    slotCount);
+            Assert(newSlots); // no-throw allocators are currently not supported
+
+            for (uint i = 0; i < slotCount; i++)
+            {
+                newSlots[i].hashCode = 0;
+                newSlots[i].entryIndex = EmptySlot;
+            }
+            return newSlots;
+        }
+
+        __ecount(size) EntryType * AllocateEntries(DECLSPEC_GUARD_OVERFLOW int size)
+        {
+            // As in BaseDictionary, the choice of leaf/non-leaf node is decided for the EntryType on the basis of TValue.
+            EntryType * newEntries =
+                AllocateArray<AllocatorType, EntryType, false>(
+                    TRACK_ALLOC_INFO(alloc, EntryType, AllocatorType, 0, size),
+                    EntryAllocatorFuncType::GetAllocZeroFunc(),
+                    size);
+            Assert(newEntries); // no-throw allocators are currently not supported
+            return newEntries;
+        }
+
+        void DeleteSlots(__in_ecount(slotCount) Slot *const slots, const uint slotCount)
+        {
+            Assert(slots);
+            Assert(slotCount != 0);
+
+            AllocatorFree(alloc, (TypeAllocatorFunc<AllocatorType, Slot>::GetFreeFunc()), slots, slotCount * sizeof(Slot));
+        }
+
+        void DeleteEntries(__in_ecount(size) EntryType *const entries, const int size)
+        {
+            Assert(entries);
+            Assert(size != 0);
+
+            AllocatorFree(alloc, EntryAllocatorFuncType::GetFreeFunc(), entries, size * sizeof(EntryType));
+        }
+
+        void RemoveAt(const int i, const uint slotIndex)
+        {
+            if (slots != nullptr)
+            {
+                Assert(slots[slotIndex].entryIndex == i);
+
+                // A slot that doesn't continue a probe run can go back to empty.
+                uint mask = slotCount - 1;
+                if (slots[(slotIndex + 1) & mask].entryIndex == EmptySlot)
+                {
+                    slots[slotIndex].entryIndex = EmptySlot;
+                }
+                else
+                {
+                    slots[slotIndex].entryIndex = DeletedSlot;
+                    deletedSlotCount++;
+                }
+                slots[slotIndex].hashCode = 0;
+            }
+
+            entries[i].Clear();
+            SetNextFreeEntryIndex(entries[i], freeCount == 0 ? -1 : freeList);
+            freeList = i;
+            freeCount++;
+        }
+
+    public:
+        template<class TDictionary>
+        class EntryIterator sealed
+        {
+        private:
+            EntryType *const entries;
+            const int entryCount;
+            int entryIndex;
+
+        public:
+            EntryIterator(TDictionary &dictionary) : entries(dictionary.entries), entryCount(dictionary.count), entryIndex(0)
+            {
+                if (IsValid() && IsFreeEntry(this->entries[this->entryIndex]))
+                {
+                    MoveNext();
+                }
+            }
+
+            bool IsValid() const
+            {
+                return this->entryIndex < this->entryCount;
+            }
+
+            void MoveNext()
+            {
+                Assert(IsValid());
+
+                do
+                {
+                    ++(this->entryIndex);
+                } while (IsValid() && IsFreeEntry(this->entries[this->entryIndex]));
+            }
+
+            EntryType &Current() const
+            {
+                Assert(IsValid());
+                Assert(!IsFreeEntry(entries[entryIndex]));
+
+                return entries[entryIndex];
+            }
+
+            TKey CurrentKey() const
+            {
+                return Current().Key();
+            }
+
+            const TValue &CurrentValue() const
+            {
+                return Current().Value();
+            }
+
+            TValue &CurrentValueReference() const
+            {
+                return Current().Value();
+            }
+        };
+    };
+}
@@ -28,6 +28,7 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
 private:
     size_t memoryLimit;
     size_t currentMemory;
+    size_t peakMemory;
     bool supportConcurrency;
     CriticalSection cs;
     void * context;
@@ -37,6 +38,7 @@ public:
     AllocationPolicyManager(bool needConcurrencySupport) :
         memoryLimit((size_t)-1),
         currentMemory(0),
+        peakMemory(0),
         supportConcurrency(needConcurrencySupport),
         context(NULL),
         memoryAllocationCallback(NULL)
@@ -53,6 +55,17 @@ public:
         return currentMemory;
     }
 
+    // The highest usage since creation or the last ResetPeakUsage.
+    size_t GetPeakUsage()
+    {
+        return peakMemory;
+    }
+
+    void ResetPeakUsage()
+    {
+        peakMemory = currentMemory;
+    }
+
     size_t GetLimit()
     {
         return memoryLimit;
@@ -137,6 +150,10 @@ private:
         else
         {
             currentMemory = newCurrentMemory;
+            if (newCurrentMemory > peakMemory)
+            {
+                peakMemory = newCurrentMemory;
+            }
             return true;
         }
     }
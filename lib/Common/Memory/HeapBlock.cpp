@@ -98,6 +98,7 @@ SmallHeapBlockT<TBlockAttributes>::ConstructorCommon(HeapBucket * bucket, ushort
         Assert(heapBlockType >= HeapBlockType::SmallAllocBlockTypeCount && heapBlockType < HeapBlockType::SmallBlockTypeCount);
     }
 
+    this->allocationAccountId = 0;
     DebugOnly(lastUncollectedAllocBytes = 0);
 }
 
@@ -1022,6 +1023,11 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
     this->markCount = (ushort)localMarkCount;
     Assert(markCount <= objectCount - this->freeCount);
 
+    if (this->allocationAccountId != 0 && recyclerSweep.GetRecycler()->IsAllocationAccountSweep())
+    {
+        recyclerSweep.GetRecycler()->AddAllocationAccountLiveBytes(this->allocationAccountId, localMarkCount * this->objectSize);
+    }
+
     const uint expectFreeCount = objectCount - localMarkCount;
     Assert(expectFreeCount >= this->freeCount);
 
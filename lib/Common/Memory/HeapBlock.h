@@ -419,6 +419,7 @@ public:
     ushort oldFreeCount;
 #endif
     bool   isInAllocator;
+    uint   allocationAccountId;     // The recycler allocation account charged for the objects in this block
 #if DBG
     bool   isClearedFromAllocator;
 
@@ -236,7 +236,10 @@ HeapBucketT<TBlockType>::IntegrateBlock(char * blockAddress, PageSegment * segme
     this->fullBlockList = heapBlock;
     RECYCLER_SLOW_CHECK(this->heapBlockCount++);
 
-    this->heapInfo->uncollectedAllocBytes += heapBlock->GetAndClearLastFreeCount() * heapBlock->GetObjectSize();
+    heapBlock->allocationAccountId = recycler->GetCurrentAllocationAccount();
+    size_t allocBytes = heapBlock->GetAndClearLastFreeCount() * heapBlock->GetObjectSize();
+    this->heapInfo->uncollectedAllocBytes += allocBytes;
+    recycler->ChargeAllocationAccount(heapBlock->allocationAccountId, allocBytes);
     RecyclerMemoryTracking::ReportAllocation(recycler, blockAddress, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
     RECYCLER_PERF_COUNTER_ADD(LiveObject,heapBlock->GetObjectCount());
     RECYCLER_PERF_COUNTER_ADD(LiveObjectSize, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
@@ -333,12 +336,24 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
     if (heapBlock != nullptr)
     {
         Assert(!this->IsAllocationStopped());
-        this->nextAllocableBlockHead = heapBlock->GetNextBlock();
+        if (recycler->CanTakeAllocationAccountBlock(heapBlock->allocationAccountId))
+        {
+            this->nextAllocableBlockHead = heapBlock->GetNextBlock();
+        }
+        else
+        {
+            heapBlock = this->TakeAllocationAccountBlock(recycler);
+        }
+    }
 
+    if (heapBlock != nullptr)
+    {
         allocator->Set(heapBlock);
     }
-    else if (this->explicitFreeList != nullptr)
+    else if (this->explicitFreeList != nullptr && !recycler->HasLimitedAllocationAccounts())
     {
+        // Explicitly freed objects may be in any account's blocks, so they are left for the next sweep while an
+        // account has a limit.
         allocator->SetExplicitFreeList(this->explicitFreeList);
         this->lastExplicitFreeListAllocator = allocator;
         this->explicitFreeList = nullptr;
@@ -353,6 +368,29 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
     return memBlock;
 }
 
+// Find an allocable block past nextAllocableBlockHead that the current allocation account may take, and move it to the
+// front of the heap block list, with the blocks already handed out to allocators.
+template <typename TBlockType>
+TBlockType *
+HeapBucketT<TBlockType>::TakeAllocationAccountBlock(Recycler * recycler)
+{
+    TBlockType * previousBlock = this->nextAllocableBlockHead;
+    TBlockType * heapBlock = previousBlock->GetNextBlock();
+    while (heapBlock != nullptr)
+    {
+        if (recycler->CanTakeAllocationAccountBlock(heapBlock->allocationAccountId))
+        {
+            previousBlock->SetNextBlock(heapBlock->GetNextBlock());
+            heapBlock->SetNextBlock(this->heapBlockList);
+            this->heapBlockList = heapBlock;
+            return heapBlock;
+        }
+        previousBlock = heapBlock;
+        heapBlock = heapBlock->GetNextBlock();
+    }
+    return nullptr;
+}
+
 template <typename TBlockType>
 char *
 HeapBucketT<TBlockType>::TryAllocFromNewHeapBlock(Recycler * recycler, TBlockAllocatorType * allocator, size_t sizeCat, size_t size, ObjectInfoBits attributes)
@@ -401,6 +439,16 @@ HeapBucketT<TBlockType>::SnailAlloc(Recycler * recycler, TBlockAllocatorType * a
     Assert(sizeCat == this->sizeCat);
     Assert((attributes & InternalObjectInfoBitMask) == attributes);
 
+    // The current allocation account is only checked when the allocator needs another block.
+    if (!recycler->CheckAllocationAccountLimit())
+    {
+        if (nothrow == false)
+        {
+            recycler->OutOfMemory();
+        }
+        return nullptr;
+    }
+
     char * memBlock = this->TryAlloc(recycler, allocator, sizeCat, attributes);
     if (memBlock != nullptr)
     {
@@ -1337,6 +1385,19 @@ HeapBucketGroup<TBlockAttributes>::Rescan(Recycler * recycler, RescanFlags flags
         finalizableHeapBucket.Rescan(recycler, flags);
 }
 
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::ClearAllocators()
+{
+    heapBucket.ClearAllocators();
+    leafHeapBucket.ClearAllocators();
+#ifdef RECYCLER_WRITE_BARRIER
+    smallNormalWithBarrierHeapBucket.ClearAllocators();
+    smallFinalizableWithBarrierHeapBucket.ClearAllocators();
+#endif
+    finalizableHeapBucket.ClearAllocators();
+}
+
 #if ENABLE_CONCURRENT_GC
 template <class TBlockAttributes>
 void
@@ -1153,6 +1153,22 @@ void HeapInfo::FinishPartialCollect(RecyclerSweep * recyclerSweep)
 }
 #endif
 
+void
+HeapInfo::ClearAllocators()
+{
+    for (uint i = 0; i < HeapConstants::BucketCount; i++)
+    {
+        heapBuckets[i].ClearAllocators();
+    }
+
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+    {
+        mediumHeapBuckets[i].ClearAllocators();
+    }
+#endif
+}
+
 #if ENABLE_CONCURRENT_GC
 void
 HeapInfo::PrepareSweep()
@@ -85,6 +85,7 @@ public:
     void SweepPartialReusePages(RecyclerSweep& recyclerSweep);
     void FinishPartialCollect(RecyclerSweep * recyclerSweep);
 #endif
+    void ClearAllocators();
 #if ENABLE_CONCURRENT_GC
     void PrepareSweep();
 
@@ -147,8 +147,10 @@ LargeHeapBlock::GetAllocPlusSize(uint objectCount)
     // Large Heap Block Layout:
     //      LargeHeapBlock
     //      LargeObjectHeader * [objectCount]
+    //      uint                [objectCount] (Allocation account of each object, padded to pointer size)
     //      TrackerData *       [objectCount] (Optional)
     size_t allocPlusSize = objectCount * (sizeof(LargeObjectHeader *));
+    allocPlusSize += Math::Align<size_t>(objectCount * sizeof(uint), sizeof(void *));
 #ifdef PROFILE_RECYCLER_ALLOC
     if (Recycler::DoProfileAllocTracker())
     {
@@ -234,6 +236,13 @@ LargeHeapBlock::HeaderList()
     return (LargeObjectHeader **)(((byte *)this) + sizeof(LargeHeapBlock));
 }
 
+uint *
+LargeHeapBlock::AllocationAccountList()
+{
+    // See LargeHeapBlock::GetAllocPlusSize for layout description
+    return (uint *)(this->HeaderList() + this->objectCount);
+}
+
 void
 LargeHeapBlock::FinalizeAllObjects()
 {
@@ -487,6 +496,7 @@ LargeHeapBlock::AllocFreeListEntry(size_t size, ObjectInfoBits attributes, Large
     header->SetAttributes(this->heapInfo->recycler->Cookie, (attributes & StoredObjectInfoBitMask));
     header->markOnOOMRescan = false;
     header->SetNext(this->heapInfo->recycler->Cookie, nullptr);
+    this->SetObjectAllocationAccount(header, this->heapInfo->recycler->GetCurrentAllocationAccount());
 
     HeaderList()[headerIndex] = header;
     finalizeCount += ((attributes & FinalizeBit) != 0);
@@ -542,6 +552,7 @@ LargeHeapBlock::Alloc(size_t size, ObjectInfoBits attributes)
     header->objectSize = size;
     header->SetAttributes(recycler->Cookie, (attributes & StoredObjectInfoBitMask));
     HeaderList()[allocCount++] = header;
+    this->SetObjectAllocationAccount(header, recycler->GetCurrentAllocationAccount());
     finalizeCount += ((attributes & FinalizeBit) != 0);
 
 #ifdef RECYCLER_FINALIZE_CHECK
@@ -1330,6 +1341,20 @@ LargeHeapBlock::Sweep(RecyclerSweep& recyclerSweep, bool queuePendingSweep)
         return SweepStateEmpty;
     }
 
+    if (recycler->IsAllocationAccountSweep())
+    {
+        const HeapBlockMap& heapBlockMap = recycler->heapBlockMap;
+        uint * accountIds = this->AllocationAccountList();
+        for (uint i = 0; i < allocCount; i++)
+        {
+            LargeObjectHeader * header = this->GetHeader(i);
+            if (header != nullptr && accountIds[i] != 0 && heapBlockMap.IsMarked(header->GetAddress()))
+            {
+                recycler->AddAllocationAccountLiveBytes(accountIds[i], header->objectSize);
+            }
+        }
+    }
+
     RECYCLER_STATS_ADD(recycler, largeHeapBlockTotalByteCount, this->pageCount * AutoSystemInfo::PageSize);
     RECYCLER_STATS_ADD(recycler, heapBlockFreeByteCount[HeapBlock::LargeBlockType],
         addressEnd - allocAddressEnd <= HeapConstants::MaxSmallObjectSize? 0 : (size_t)(addressEnd - allocAddressEnd));
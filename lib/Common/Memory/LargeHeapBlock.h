@@ -183,6 +183,8 @@ private:
     static LargeObjectHeader * GetHeaderFromAddress(void * address);
     LargeObjectHeader * GetHeader(void * address);
     LargeObjectHeader ** HeaderList();
+    uint * AllocationAccountList();
+    void SetObjectAllocationAccount(LargeObjectHeader * header, uint accountId) { this->AllocationAccountList()[header->objectIndex] = accountId; }
     LargeObjectHeader * GetHeader(uint index)
     {
         Assert(index < this->allocCount);
@@ -384,6 +384,11 @@ LargeHeapBucket::TryAllocFromExplicitFreeList(Recycler * recycler, size_t sizeCa
 #endif
         header->SetAttributes(recycler->Cookie, (attributes & StoredObjectInfoBitMask));
 
+        if (recycler->GetCurrentAllocationAccount() != 0)
+        {
+            ((LargeHeapBlock *)recycler->FindHeapBlock(memBlock))->SetObjectAllocationAccount(header, recycler->GetCurrentAllocationAccount());
+        }
+
         if ((attributes & ObjectInfoBits::FinalizeBit) != 0)
         {
             LargeHeapBlock* heapBlock = (LargeHeapBlock *)recycler->FindHeapBlock(memBlock);
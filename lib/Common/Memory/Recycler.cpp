@@ -253,6 +253,14 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     , objectBeforeCollectCallbackMap(nullptr)
     , objectBeforeCollectCallbackState(ObjectBeforeCollectCallback_None)
+    , allocationAccounts(nullptr)
+    , currentAllocationAccount(nullptr)
+    , currentAllocationAccountId(0)
+    , allocatorsAllocationAccountId(0)
+    , nextAllocationAccountId(0)
+    , limitedAllocationAccountCount(0)
+    , allocationAccountSweepCount(0)
+    , isAllocationAccountSweep(false)
 {
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
@@ -464,6 +472,16 @@ Recycler::~Recycler()
 
     ClearObjectBeforeCollectCallbacks();
 
+    if (this->allocationAccounts != nullptr)
+    {
+        this->allocationAccounts->Map([](uint accountId, RecyclerAllocationAccount * account)
+        {
+            HeapDelete(account);
+        });
+        HeapDelete(this->allocationAccounts);
+        this->allocationAccounts = nullptr;
+    }
+
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
     if (GetRecyclerFlagsTable().DumpObjectGraphOnExit)
     {
@@ -927,6 +945,249 @@ Recycler::AddExternalMemoryUsage(size_t size)
     CollectNow<CollectOnAllocation>();
 }
 
+uint
+Recycler::AddAllocationAccount()
+{
+    if (this->allocationAccounts == nullptr)
+    {
+        this->allocationAccounts = HeapNew(AllocationAccountMap, &HeapAllocator::Instance);
+    }
+
+    AutoPtr<RecyclerAllocationAccount> account(HeapNew(RecyclerAllocationAccount));
+    uint accountId = ++this->nextAllocationAccountId;
+    if (accountId == 0)
+    {
+        // Wrapped around; 0 stands for no account.
+        accountId = ++this->nextAllocationAccountId;
+    }
+
+    {
+        AutoCriticalSection autoCs(&this->allocationAccountsLock);
+        this->allocationAccounts->Add(accountId, account);
+    }
+    account.Detach();
+    return accountId;
+}
+
+void
+Recycler::RemoveAllocationAccount(uint accountId)
+{
+    RecyclerAllocationAccount * account = nullptr;
+    if (this->allocationAccounts == nullptr || !this->allocationAccounts->TryGetValue(accountId, &account))
+    {
+        return;
+    }
+
+    if (this->currentAllocationAccountId == accountId)
+    {
+        this->SetCurrentAllocationAccount(0);
+    }
+
+    {
+        AutoCriticalSection autoCs(&this->allocationAccountsLock);
+        this->allocationAccounts->Remove(accountId);
+        if (account->HasLimit())
+        {
+            this->limitedAllocationAccountCount--;
+        }
+    }
+
+    // Blocks still owned by the account are charged to no one until another account allocates from them.
+    HeapDelete(account);
+}
+
+void
+Recycler::SetCurrentAllocationAccount(uint accountId)
+{
+    if (accountId == this->currentAllocationAccountId)
+    {
+        // Most hosts never opt in, so switching contexts only ever sets account 0 again.
+        return;
+    }
+
+    RecyclerAllocationAccount * account = nullptr;
+    if (accountId != 0 && (this->allocationAccounts == nullptr || !this->allocationAccounts->TryGetValue(accountId, &account)))
+    {
+        accountId = 0;
+    }
+
+    if (accountId != 0 && accountId != this->allocatorsAllocationAccountId)
+    {
+        // The blocks in the allocators belong to the account they were taken for. A limited account takes its own, and
+        // doesn't leave its blocks to the next account.
+        if (account->HasLimit() || this->IsLimitedAllocationAccount(this->allocatorsAllocationAccountId))
+        {
+            this->autoHeap.ClearAllocators();
+        }
+        this->allocatorsAllocationAccountId = accountId;
+    }
+
+    this->currentAllocationAccountId = accountId;
+    this->currentAllocationAccount = account;
+}
+
+size_t
+Recycler::GetAllocationAccountUsage(uint accountId)
+{
+    // The host may ask from another thread.
+    AutoCriticalSection autoCs(&this->allocationAccountsLock);
+    RecyclerAllocationAccount * account = nullptr;
+    if (this->allocationAccounts == nullptr || !this->allocationAccounts->TryGetValue(accountId, &account))
+    {
+        return 0;
+    }
+    return account->GetUsage();
+}
+
+size_t
+Recycler::GetAllocationAccountLimit(uint accountId)
+{
+    AutoCriticalSection autoCs(&this->allocationAccountsLock);
+    RecyclerAllocationAccount * account = nullptr;
+    if (this->allocationAccounts == nullptr || !this->allocationAccounts->TryGetValue(accountId, &account))
+    {
+        return (size_t)-1;
+    }
+    return account->limit;
+}
+
+void
+Recycler::SetAllocationAccountLimit(uint accountId, size_t limit)
+{
+    AutoCriticalSection autoCs(&this->allocationAccountsLock);
+    RecyclerAllocationAccount * account = nullptr;
+    if (this->allocationAccounts != nullptr && this->allocationAccounts->TryGetValue(accountId, &account))
+    {
+        if (account->HasLimit())
+        {
+            this->limitedAllocationAccountCount--;
+        }
+        account->limit = limit;
+        if (account->HasLimit())
+        {
+            this->limitedAllocationAccountCount++;
+        }
+    }
+}
+
+bool
+Recycler::IsLimitedAllocationAccount(uint accountId)
+{
+    RecyclerAllocationAccount * account = nullptr;
+    return this->HasLimitedAllocationAccounts() && accountId != 0 &&
+        this->allocationAccounts->TryGetValue(accountId, &account) && account->HasLimit();
+}
+
+bool
+Recycler::CanTakeOtherAllocationAccountBlock(uint blockAccountId)
+{
+    Assert(this->currentAllocationAccount != nullptr);
+
+    // Blocks of a removed account are free for anyone to take. Accounts without a limit share their blocks.
+    RecyclerAllocationAccount * blockAccount = nullptr;
+    if (!this->allocationAccounts->TryGetValue(blockAccountId, &blockAccount))
+    {
+        return true;
+    }
+    return !blockAccount->HasLimit() && !this->currentAllocationAccount->HasLimit();
+}
+
+void
+Recycler::ChargeAllocationAccount(uint accountId, size_t bytes)
+{
+    if (accountId == 0)
+    {
+        return;
+    }
+
+    RecyclerAllocationAccount * account = this->currentAllocationAccount;
+    if (accountId != this->currentAllocationAccountId)
+    {
+        if (!this->allocationAccounts->TryGetValue(accountId, &account))
+        {
+            return;
+        }
+    }
+    account->allocatedBytes += bytes;
+}
+
+void
+Recycler::AddAllocationAccountLiveBytes(uint accountId, size_t bytes)
+{
+    if (!this->isAllocationAccountSweep || accountId == 0)
+    {
+        return;
+    }
+
+    // May be called from the concurrent sweep while the main thread adds or removes accounts.
+    AutoCriticalSection autoCs(&this->allocationAccountsLock);
+    RecyclerAllocationAccount * account = nullptr;
+    if (this->allocationAccounts->TryGetValue(accountId, &account))
+    {
+        account->sweptBytes += bytes;
+    }
+}
+
+bool
+Recycler::CheckAllocationAccountLimit()
+{
+    if (this->currentAllocationAccount == nullptr || !this->currentAllocationAccount->IsOverLimit())
+    {
+        return true;
+    }
+
+    // Some of what was allocated since the last full sweep may be garbage by now. Collect at most once per full sweep,
+    // so that a context that stays over its limit fails its allocations without collecting the whole runtime each time.
+    if (this->currentAllocationAccount->allocatedBytes != 0 &&
+        this->currentAllocationAccount->limitCollectSweepCount != this->allocationAccountSweepCount)
+    {
+        this->CollectNow<CollectNowForceInThread>();
+        if (this->currentAllocationAccount != nullptr)
+        {
+            this->currentAllocationAccount->limitCollectSweepCount = this->allocationAccountSweepCount;
+        }
+    }
+
+    // The collection may have run finalizers that removed the account.
+    return this->currentAllocationAccount == nullptr || !this->currentAllocationAccount->IsOverLimit();
+}
+
+void
+Recycler::BeginAllocationAccountSweep(bool isFullSweep)
+{
+    // Only a full sweep looks at every heap block.
+    if (!isFullSweep || this->allocationAccounts == nullptr || this->allocationAccounts->Count() == 0)
+    {
+        return;
+    }
+
+    this->allocationAccounts->Map([](uint accountId, RecyclerAllocationAccount * account)
+    {
+        account->sweptBytes = 0;
+        account->allocatedBytesBeforeSweep = account->allocatedBytes;
+    });
+    this->isAllocationAccountSweep = true;
+}
+
+void
+Recycler::EndAllocationAccountSweep()
+{
+    if (!this->isAllocationAccountSweep)
+    {
+        return;
+    }
+
+    this->isAllocationAccountSweep = false;
+    this->allocationAccountSweepCount++;
+    this->allocationAccounts->Map([](uint accountId, RecyclerAllocationAccount * account)
+    {
+        // What was allocated before the sweep began is now either counted live or gone.
+        account->liveBytes = account->sweptBytes;
+        account->allocatedBytes = account->allocatedBytes > account->allocatedBytesBeforeSweep ?
+            account->allocatedBytes - account->allocatedBytesBeforeSweep : 0;
+    });
+}
+
 BOOL Recycler::ReportExternalMemoryAllocation(size_t size)
 {
     return recyclerPageAllocator.RequestAlloc(size);
@@ -1244,6 +1505,15 @@ Recycler::LargeAlloc(HeapInfo* heap, size_t size, ObjectInfoBits attributes)
 {
     Assert((attributes & InternalObjectInfoBitMask) == attributes);
 
+    if (!this->CheckAllocationAccountLimit())
+    {
+        if (nothrow == false)
+        {
+            this->OutOfMemory();
+        }
+        return nullptr;
+    }
+
     char * addr = TryLargeAlloc(heap, size, attributes, nothrow);
     if (addr == nullptr)
     {
@@ -1265,6 +1535,7 @@ Recycler::LargeAlloc(HeapInfo* heap, size_t size, ObjectInfoBits attributes)
         }
     }
     autoHeap.uncollectedAllocBytes += size;
+    this->ChargeAllocationAccount(this->currentAllocationAccountId, size);
     return addr;
 }
 
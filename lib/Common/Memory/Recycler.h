@@ -598,6 +598,36 @@ private:
 };
 #endif
 
+// Recycler memory charged to one allocation account, typically one script context of a recycler shared by several.
+// Accounts are opt-in: the recycler does no accounting work for allocations made outside of one. A small heap block
+// belongs to the account that last took it into an allocator. An account with a limit keeps its blocks to itself: while
+// another account has live objects in a block, it doesn't allocate from it, and the others don't allocate from its
+// blocks. Large objects are charged one by one. The account is charged the bytes allocated since the last full sweep,
+// plus the bytes it still held live at that sweep.
+struct RecyclerAllocationAccount
+{
+    RecyclerAllocationAccount() :
+        liveBytes(0),
+        sweptBytes(0),
+        allocatedBytes(0),
+        allocatedBytesBeforeSweep(0),
+        limit((size_t)-1),
+        limitCollectSweepCount((uint)-1)
+    {
+    }
+
+    size_t GetUsage() const { return liveBytes + allocatedBytes; }
+    bool HasLimit() const { return limit != (size_t)-1; }
+    bool IsOverLimit() const { return GetUsage() > limit; }
+
+    size_t liveBytes;
+    size_t sweptBytes;                  // Live bytes counted so far by the sweep in progress
+    size_t allocatedBytes;
+    size_t allocatedBytesBeforeSweep;   // Already covered by the sweep in progress
+    size_t limit;
+    uint limitCollectSweepCount;        // Full sweep count after the last collection forced for going over the limit
+};
+
 
 class Recycler
 {
@@ -1253,6 +1283,35 @@ public:
 
     void AddExternalMemoryUsage(size_t size);
 
+    // Allocation accounts, see RecyclerAllocationAccount. Account id 0 stands for no account.
+    uint AddAllocationAccount();
+    void RemoveAllocationAccount(uint accountId);
+    void SetCurrentAllocationAccount(uint accountId);
+    uint GetCurrentAllocationAccount() const { return currentAllocationAccountId; }
+    size_t GetAllocationAccountUsage(uint accountId);
+    size_t GetAllocationAccountLimit(uint accountId);
+    void SetAllocationAccountLimit(uint accountId, size_t limit);
+
+    // Called by the allocators and heap blocks.
+    void ChargeAllocationAccount(uint accountId, size_t bytes);
+    void AddAllocationAccountLiveBytes(uint accountId, size_t bytes);
+    bool CheckAllocationAccountLimit();
+    void BeginAllocationAccountSweep(bool isFullSweep);
+    void EndAllocationAccountSweep();
+    bool IsAllocationAccountSweep() const { return isAllocationAccountSweep; }
+    bool HasLimitedAllocationAccounts() const { return limitedAllocationAccountCount != 0; }
+
+    // Whether the current account may allocate from a small heap block charged to blockAccountId.
+    bool CanTakeAllocationAccountBlock(uint blockAccountId)
+    {
+        if (!this->HasLimitedAllocationAccounts() || blockAccountId == 0 || blockAccountId == this->currentAllocationAccountId ||
+            this->currentAllocationAccountId == 0)
+        {
+            return true;
+        }
+        return CanTakeOtherAllocationAccountBlock(blockAccountId);
+    }
+
     bool NeedDispose()
     {
         return this->hasDisposableObject;
@@ -1405,6 +1464,23 @@ public:
     void RootAddRef(void* obj, uint *count = nullptr);
     void RootRelease(void* obj, uint *count = nullptr);
 
+    template <typename Fn>
+    void MapPinnedObjects(Fn fn)
+    {
+        if (transientPinnedObject != nullptr)
+        {
+            fn(transientPinnedObject);
+        }
+        pinnedObjectMap.Map([&](void * obj, PinRecord const& refCount)
+        {
+            // Entries released down to zero stay in the map until the next mark removes them.
+            if (refCount != 0)
+            {
+                fn(obj);
+            }
+        });
+    }
+
     template <ObjectInfoBits attributes, bool nothrow>
     inline char* RealAlloc(HeapInfo* heap, DECLSPEC_GUARD_OVERFLOW size_t size);
 
@@ -2015,6 +2091,22 @@ private:
     } objectBeforeCollectCallbackState;
 
     bool ProcessObjectBeforeCollectCallbacks(bool atShutdown = false);
+
+    bool CanTakeOtherAllocationAccountBlock(uint blockAccountId);
+    bool IsLimitedAllocationAccount(uint accountId);
+
+    typedef JsUtil::BaseDictionary<uint, RecyclerAllocationAccount *, HeapAllocator,
+        PrimeSizePolicy, DefaultComparer, JsUtil::SimpleDictionaryEntry, JsUtil::NoResizeLock> AllocationAccountMap;
+    AllocationAccountMap* allocationAccounts;
+    // Accounts are only added and removed on the main thread, but a concurrent sweep looks them up in the background.
+    CriticalSection allocationAccountsLock;
+    RecyclerAllocationAccount * currentAllocationAccount;
+    uint currentAllocationAccountId;
+    uint allocatorsAllocationAccountId;     // The account the small allocators' current blocks were taken for
+    uint nextAllocationAccountId;
+    uint limitedAllocationAccountCount;
+    uint allocationAccountSweepCount;
+    bool isAllocationAccountSweep;
 };
 
 
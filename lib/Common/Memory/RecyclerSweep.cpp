@@ -154,6 +154,12 @@ RecyclerSweep::BeginSweep(Recycler * recycler)
         // so don't reset it here (but do reset partial heuristics).
         recycler->ResetPartialHeuristicCounters();
     }
+
+#if ENABLE_PARTIAL_GC
+    recycler->BeginAllocationAccountSweep(!this->inPartialCollect);
+#else
+    recycler->BeginAllocationAccountSweep(true);
+#endif
 }
 
 void
@@ -256,6 +262,7 @@ RecyclerSweep::EndSweep()
     }
 #endif
 
+    recycler->EndAllocationAccountSweep();
     recycler->recyclerSweep = nullptr;
 
     // Clean up the HeapBlockMap.
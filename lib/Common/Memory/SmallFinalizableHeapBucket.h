@@ -230,6 +230,7 @@ public:
     }
 
     void Initialize(HeapInfo * heapInfo, uint sizeCat);
+    void ClearAllocators();
     void ResetMarks(ResetMarkFlags flags);
     void ScanInitialImplicitRoots(Recycler * recycler);
     void ScanNewImplicitRoots(Recycler * recycler);
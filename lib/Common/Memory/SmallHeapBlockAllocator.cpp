@@ -104,6 +104,7 @@ SmallHeapBlockAllocator<TBlockType>::Clear()
         {
             uint lastFreeCount = heapBlock->GetAndClearLastFreeCount();
             heapBlock->heapBucket->heapInfo->uncollectedAllocBytes += lastFreeCount * heapBlock->GetObjectSize();
+            heapBlock->heapBucket->heapInfo->GetRecycler()->ChargeAllocationAccount(heapBlock->allocationAccountId, lastFreeCount * heapBlock->GetObjectSize());
             Assert(heapBlock->lastUncollectedAllocBytes == 0);
             DebugOnly(heapBlock->lastUncollectedAllocBytes = lastFreeCount * heapBlock->GetObjectSize());
         }
@@ -151,6 +152,7 @@ SmallHeapBlockAllocator<TBlockType>::SetNew(BlockType * heapBlock)
 
     Assert(!heapBlock->isInAllocator);
     heapBlock->isInAllocator = true;
+    heapBlock->allocationAccountId = heapBlock->heapBucket->heapInfo->GetRecycler()->GetCurrentAllocationAccount();
 
     this->heapBlock = heapBlock;
     this->freeObjectList = (FreeObject *)heapBlock->GetAddress();
@@ -172,6 +174,14 @@ SmallHeapBlockAllocator<TBlockType>::Set(BlockType * heapBlock)
     Assert(!heapBlock->isInAllocator);
     heapBlock->isInAllocator = true;
 
+    // The bucket only hands out blocks the current account may take (see HeapBucketT::TryAlloc), so its objects are
+    // the current account's from now on. Allocations outside of any account go to the block's account.
+    uint accountId = heapBlock->heapBucket->heapInfo->GetRecycler()->GetCurrentAllocationAccount();
+    if (accountId != 0)
+    {
+        heapBlock->allocationAccountId = accountId;
+    }
+
     this->heapBlock = heapBlock;
     RECYCLER_SLOW_CHECK(this->heapBlock->CheckDebugFreeBitVector(true));
     this->freeObjectList = this->heapBlock->freeObjectList;
@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef RUNTIME_PLATFORM_AGNOSTIC_COMMON_PERFMAP
+#define RUNTIME_PLATFORM_AGNOSTIC_COMMON_PERFMAP
+
+namespace PlatformAgnostic
+{
+    // Tells Linux perf the names of code the engine generates at runtime. Either a /tmp/perf-<pid>.map file, which
+    // perf report reads as is, or a jit-<pid>.dump file in the current directory, which perf inject --jit merges into
+    // a perf.data recorded with -k mono. Both are process wide and kept after the process exits.
+    class PerfMap
+    {
+    public:
+        enum Format
+        {
+            Format_PerfMap,
+            Format_JitDump
+        };
+
+        // Returns false if the file couldn't be created. Later calls return the result of the first one.
+        static bool EnsureOpen(Format format);
+
+        // name is UTF-8, size is the number of bytes of code at address.
+        static void LogCodeLoad(const void *address, size_t size, const char *name);
+    };
+} // namespace PlatformAgnostic
+
+#endif // RUNTIME_PLATFORM_AGNOSTIC_COMMON_PERFMAP
@@ -163,4 +163,271 @@ JsGetModuleHostInfo(
     _In_ JsModuleHostInfoKind moduleHostInfo,
     _Outptr_result_maybenull_ void** hostInfo);
 
+/// <summary>
+///     The format of the profile written by <c>JsStopSamplingProfiler</c>.
+/// </summary>
+typedef enum JsSamplingProfileFormat
+{
+    /// <summary>
+    ///     One line per distinct call stack, outermost frame first, with the frames separated by semicolons and
+    ///     followed by the number of samples. This is the input flame graph tools expect.
+    /// </summary>
+    JsSamplingProfileFormat_CollapsedStacks = 0,
+    /// <summary>
+    ///     A .cpuprofile JSON document, as loaded by the Chrome developer tools.
+    /// </summary>
+    JsSamplingProfileFormat_CpuProfile = 1
+} JsSamplingProfileFormat;
+
+/// <summary>
+///     User implemented callback that receives the profile written by <c>JsStopSamplingProfiler</c>.
+/// </summary>
+/// <remarks>
+///     The profile is UTF-8 text. It is handed over in chunks, in order; a chunk is not null terminated and is
+///     only valid for the duration of the call.
+/// </remarks>
+/// <param name="callbackState">The state passed to <c>JsStopSamplingProfiler</c>.</param>
+/// <param name="chunk">The next part of the profile.</param>
+/// <param name="length">The length of the chunk, in bytes.</param>
+typedef void (CHAKRA_CALLBACK * JsSamplingProfileWriteCallback)(_In_opt_ void *callbackState, _In_reads_(length) const char *chunk, _In_ size_t length);
+
+/// <summary>
+///     Starts sampling the script call stacks of a runtime.
+/// </summary>
+/// <remarks>
+///     A timer thread asks for a sample every <paramref name="intervalMilliseconds"/>. The sample is taken by the
+///     runtime's thread at its next stack check (calls, and loop iterations in the interpreter), and attributed to
+///     the functions and statements on the stack. Time spent outside of script is not sampled.
+/// </remarks>
+/// <param name="runtime">The runtime to profile.</param>
+/// <param name="intervalMilliseconds">The sampling interval, in milliseconds.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsStartSamplingProfiler(
+    _In_ JsRuntimeHandle runtime,
+    _In_ unsigned int intervalMilliseconds);
+
+/// <summary>
+///     Stops the sampling profiler of a runtime and writes out the profile it collected.
+/// </summary>
+/// <param name="runtime">The runtime being profiled.</param>
+/// <param name="format">The format to write the profile in.</param>
+/// <param name="writeCallback">The callback the profile is written to. If null, the profile is discarded.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsStopSamplingProfiler(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsSamplingProfileFormat format,
+    _In_opt_ JsSamplingProfileWriteCallback writeCallback,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     The format of the snapshot written by <c>JsWriteHeapSnapshot</c>.
+/// </summary>
+typedef enum JsHeapSnapshotFormat
+{
+    /// <summary>
+    ///     Every reachable object with its outgoing references, followed by the summary.
+    /// </summary>
+    JsHeapSnapshotFormat_Graph = 0,
+    /// <summary>
+    ///     Only the number of objects and their total size for each type and constructor name.
+    /// </summary>
+    JsHeapSnapshotFormat_Summary = 1
+} JsHeapSnapshotFormat;
+
+/// <summary>
+///     User implemented callback that receives the snapshot written by <c>JsWriteHeapSnapshot</c>.
+/// </summary>
+/// <remarks>
+///     The snapshot is handed over in chunks, in order; a chunk is only valid for the duration of the call. The
+///     callback must not call back into the runtime.
+/// </remarks>
+/// <param name="callbackState">The state passed to <c>JsWriteHeapSnapshot</c>.</param>
+/// <param name="chunk">The next part of the snapshot.</param>
+/// <param name="length">The length of the chunk, in bytes.</param>
+typedef void (CHAKRA_CALLBACK * JsHeapSnapshotWriteCallback)(_In_opt_ void *callbackState, _In_reads_bytes_(length) const void *chunk, _In_ size_t length);
+
+/// <summary>
+///     Collects garbage, then writes out the objects reachable from the global objects of a runtime's contexts and
+///     from the values kept alive with <c>JsAddRef</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The snapshot is streamed while the object graph is walked, so it is never held in memory as a whole. It is
+///     little endian binary: the bytes "CHHS", a uint32 version (currently 1), then records each starting with a
+///     uint8 kind, up to an end record of kind 0.
+///     </para>
+///     <para>
+///     A string record (kind 1) is a uint32 id, a uint32 byte length and the UTF-8 bytes. Strings are numbered from
+///     1 and written before the first record that uses them.
+///     </para>
+///     <para>
+///     A node record (kind 2) is a uint32 node id, a uint32 type id, a uint32 name string id, a uint64 size in
+///     bytes and a uint32 edge count, followed by the edges: each a uint8 kind (0 for a property, 1 for an
+///     element, 2 for an internal reference), a uint32 property name string id or element index, and the uint32
+///     id of the target node. Nodes are numbered from 1 in the order they are found, so an edge may refer to a
+///     node written later on. Variables captured by closures are nodes of type id 0xFFFFFFFF.
+///     </para>
+///     <para>
+///     A summary record (kind 3) is a uint32 type id, a uint32 name string id, a uint64 object count and a
+///     uint64 total size. Objects are named after their constructor, functions after themselves.
+///     </para>
+///     <para>
+///     All sizes, in node and summary records alike, are shallow: an object's own allocations, not those of the
+///     objects it refers to. The snapshot does not compute retained sizes; they can be derived from the graph.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to take a snapshot of.</param>
+/// <param name="format">The format to write the snapshot in.</param>
+/// <param name="writeCallback">The callback the snapshot is written to.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsWriteHeapSnapshot(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsHeapSnapshotFormat format,
+    _In_ JsHeapSnapshotWriteCallback writeCallback,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Where a runtime spent its time, and its highest memory usage, since it was created or since the last
+///     <c>JsResetRuntimeStatistics</c>.
+/// </summary>
+/// <remarks>
+///     A collection that happens while parsing or generating byte code counts toward both.
+/// </remarks>
+typedef struct JsRuntimeStatistics
+{
+    /// <summary>
+    ///     Time spent parsing scripts and deferred functions, in microseconds.
+    /// </summary>
+    unsigned long long parseMicroseconds;
+    /// <summary>
+    ///     Time spent generating byte code, in microseconds.
+    /// </summary>
+    unsigned long long byteCodeGenMicroseconds;
+    /// <summary>
+    ///     Time the runtime's thread spent in garbage collection, in microseconds. Work done on the concurrent
+    ///     collection thread is not included.
+    /// </summary>
+    unsigned long long gcPauseMicroseconds;
+    /// <summary>
+    ///     The number of times the runtime's thread stopped for garbage collection.
+    /// </summary>
+    unsigned long long gcPauseCount;
+    /// <summary>
+    ///     The highest memory usage of the runtime, in bytes, as reported by <c>JsGetRuntimeMemoryUsage</c>.
+    /// </summary>
+    size_t peakMemoryUsage;
+} JsRuntimeStatistics;
+
+/// <summary>
+///     Gets the statistics a runtime collected since it was created or since the last
+///     <c>JsResetRuntimeStatistics</c>.
+/// </summary>
+/// <param name="runtime">The runtime to get the statistics of.</param>
+/// <param name="statistics">The statistics.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetRuntimeStatistics(
+    _In_ JsRuntimeHandle runtime,
+    _Out_ JsRuntimeStatistics *statistics);
+
+/// <summary>
+///     Clears the times and counts in the statistics of a runtime, and lowers the peak memory usage to the
+///     current usage.
+/// </summary>
+/// <param name="runtime">The runtime to reset the statistics of.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsResetRuntimeStatistics(
+    _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Gets the memory a context's runtime has charged to the context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The runtime only keeps count for contexts it has been asked about: the first call to
+///     <c>JsGetContextMemoryUsage</c> or <c>JsSetContextMemoryLimit</c> for a context starts charging it, and
+///     what the context allocated before isn't counted.
+///     </para>
+///     <para>
+///     Memory is charged to the context that was current when it was allocated. A context with a memory limit
+///     doesn't share the runtime's heap blocks for small objects with other contexts, so what one context frees
+///     is not reused by the other before a block is empty. Contexts without a limit share blocks, and a context
+///     may then be charged for objects of another one that survive in its blocks. The count covers what was live
+///     at the last full garbage collection plus what was allocated since, so it only drops after a collection.
+///     Memory allocated while no context is current is charged to the context owning the heap block it lands in,
+///     if any.
+///     </para>
+///     <para>
+///     The usage of all contexts of a runtime adds up to less than the runtime's memory usage, which also covers
+///     memory that isn't garbage collected.
+///     </para>
+/// </remarks>
+/// <param name="context">The context to get the memory usage of.</param>
+/// <param name="memoryUsage">The memory usage, in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetContextMemoryUsage(
+    _In_ JsContextRef context,
+    _Out_ size_t *memoryUsage);
+
+/// <summary>
+///     Sets a limit on the memory a context's runtime charges to the context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     When an allocation made while the context is current finds the context over its limit, the runtime
+///     collects garbage, at most once between two full collections; if the context is still over its limit, the
+///     allocation fails the same way it does when the runtime's own memory limit is reached. Other contexts of
+///     the runtime can go on running.
+///     </para>
+///     <para>
+///     The limit is only checked when the runtime needs a new heap block, so a context can go over it by up to
+///     a block of memory.
+///     </para>
+/// </remarks>
+/// <param name="context">The context to set the memory limit of.</param>
+/// <param name="memoryLimit">
+///     The memory limit of the context, in bytes. -1 means no memory limit.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetContextMemoryLimit(
+    _In_ JsContextRef context,
+    _In_ size_t memoryLimit);
+
+/// <summary>
+///     Gets the memory limit of a context, as set by <c>JsSetContextMemoryLimit</c>.
+/// </summary>
+/// <param name="context">The context to get the memory limit of.</param>
+/// <param name="memoryLimit">
+///     The memory limit of the context, in bytes. -1 means no memory limit.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetContextMemoryLimit(
+    _In_ JsContextRef context,
+    _Out_ size_t *memoryLimit);
+
 #endif // _CHAKRACORE_H_
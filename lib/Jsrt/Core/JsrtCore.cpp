@@ -7,6 +7,9 @@
 #include "jsrtHelper.h"
 #include "JsrtContextCore.h"
 #include "chakracore.h"
+#include "Base/ThreadContextTlsEntry.h"
+#include "Base/SamplingProfiler.h"
+#include "Base/HeapSnapshotWriter.h"
 
 CHAKRA_API
 JsInitializeModuleRecord(
@@ -68,6 +71,12 @@ JsParseModuleSource(
     {
         return JsErrorModuleParsed;
     }
+#if ENABLE_PARALLEL_MODULE_PARSING
+    if (moduleRecord->IsParsePending())
+    {
+        return JsErrorModuleParsed;
+    }
+#endif
     Js::ScriptContext* scriptContext = moduleRecord->GetScriptContext();
     JsErrorCode errorCode = GlobalAPIWrapper([&]() -> JsErrorCode {
         SourceContextInfo* sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
@@ -209,3 +218,234 @@ JsGetModuleHostInfo(
     });
     return errorCode;
 }
+
+#if ENABLE_SAMPLING_PROFILER
+C_ASSERT(JsSamplingProfileFormat_CollapsedStacks == (JsSamplingProfileFormat) Js::SamplingProfiler::OutputFormat_CollapsedStacks);
+C_ASSERT(JsSamplingProfileFormat_CpuProfile == (JsSamplingProfileFormat) Js::SamplingProfiler::OutputFormat_CpuProfile);
+#endif
+
+CHAKRA_API
+JsStartSamplingProfiler(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ unsigned int intervalMilliseconds)
+{
+#if ENABLE_SAMPLING_PROFILER
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (threadContext->IsSamplingProfilerRunning())
+        {
+            return JsErrorAlreadyProfilingContext;
+        }
+
+        threadContext->StartSamplingProfiler(intervalMilliseconds);
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API
+JsStopSamplingProfiler(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsSamplingProfileFormat format,
+    _In_opt_ JsSamplingProfileWriteCallback writeCallback,
+    _In_opt_ void *callbackState)
+{
+#if ENABLE_SAMPLING_PROFILER
+    if (format > JsSamplingProfileFormat_CpuProfile)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (!threadContext->IsSamplingProfilerRunning())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        AutoPtr<Js::SamplingProfiler> samplingProfiler(threadContext->StopSamplingProfiler());
+        if (writeCallback != nullptr)
+        {
+            samplingProfiler->Write((Js::SamplingProfiler::OutputFormat)format, writeCallback, callbackState);
+        }
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+#if ENABLE_HEAP_SNAPSHOT
+C_ASSERT(JsHeapSnapshotFormat_Graph == (JsHeapSnapshotFormat) Js::HeapSnapshotWriter::OutputFormat_Graph);
+C_ASSERT(JsHeapSnapshotFormat_Summary == (JsHeapSnapshotFormat) Js::HeapSnapshotWriter::OutputFormat_Summary);
+#endif
+
+CHAKRA_API
+JsWriteHeapSnapshot(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsHeapSnapshotFormat format,
+    _In_ JsHeapSnapshotWriteCallback writeCallback,
+    _In_opt_ void *callbackState)
+{
+#if ENABLE_HEAP_SNAPSHOT
+    if (format > JsHeapSnapshotFormat_Summary)
+    {
+        return JsErrorInvalidArgument;
+    }
+    PARAM_NOT_NULL(writeCallback);
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        // Leave only reachable objects to size up. The walk itself doesn't allocate from the recycler, so no
+        // collection can move on under it.
+        Recycler* recycler = threadContext->EnsureRecycler();
+        recycler->CollectNow<CollectNowExhaustive>();
+
+        ArenaAllocator arena(_u("HeapSnapshot"), threadContext->GetPageAllocator(), Js::Throw::OutOfMemory);
+        Js::HeapSnapshotWriter writer(threadContext, &arena, writeCallback, callbackState);
+        writer.Write((Js::HeapSnapshotWriter::OutputFormat)format);
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API
+JsGetRuntimeStatistics(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _Out_ JsRuntimeStatistics *statistics)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(statistics);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    ThreadStatistics threadStatistics = threadContext->GetThreadStatistics();
+
+    statistics->parseMicroseconds = threadStatistics.parseMicroseconds;
+    statistics->byteCodeGenMicroseconds = threadStatistics.byteCodeGenMicroseconds;
+    statistics->gcPauseMicroseconds = threadStatistics.gcPauseMicroseconds;
+    statistics->gcPauseCount = threadStatistics.gcPauseCount;
+    statistics->peakMemoryUsage = threadContext->GetAllocationPolicyManager()->GetPeakUsage();
+
+    return JsNoError;
+}
+
+CHAKRA_API
+JsResetRuntimeStatistics(
+    _In_ JsRuntimeHandle runtimeHandle)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->ResetThreadStatistics();
+    return JsNoError;
+}
+
+// Starts charging the context's allocations, see ScriptContext::EnsureAllocationAccount.
+static uint EnsureContextAllocationAccount(JsrtContext * context)
+{
+    Js::ScriptContext * scriptContext = context->GetScriptContext();
+    uint accountId = scriptContext->EnsureAllocationAccount();
+    if (JsrtContext::GetCurrent() == context)
+    {
+        // JsSetCurrentContext found no account to make current.
+        scriptContext->GetRecycler()->SetCurrentAllocationAccount(accountId);
+    }
+    return accountId;
+}
+
+CHAKRA_API
+JsGetContextMemoryUsage(
+    _In_ JsContextRef context,
+    _Out_ size_t *memoryUsage)
+{
+    VALIDATE_JSREF(context);
+    PARAM_NOT_NULL(memoryUsage);
+
+    *memoryUsage = 0;
+
+    if (!JsrtContext::Is(context))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    uint accountId = EnsureContextAllocationAccount(static_cast<JsrtContext *>(context));
+    *memoryUsage = static_cast<JsrtContext *>(context)->GetScriptContext()->GetRecycler()->GetAllocationAccountUsage(accountId);
+    return JsNoError;
+}
+
+CHAKRA_API
+JsSetContextMemoryLimit(
+    _In_ JsContextRef context,
+    _In_ size_t memoryLimit)
+{
+    VALIDATE_JSREF(context);
+
+    if (!JsrtContext::Is(context))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    uint accountId = EnsureContextAllocationAccount(static_cast<JsrtContext *>(context));
+    static_cast<JsrtContext *>(context)->GetScriptContext()->GetRecycler()->SetAllocationAccountLimit(accountId, memoryLimit);
+    return JsNoError;
+}
+
+CHAKRA_API
+JsGetContextMemoryLimit(
+    _In_ JsContextRef context,
+    _Out_ size_t *memoryLimit)
+{
+    VALIDATE_JSREF(context);
+    PARAM_NOT_NULL(memoryLimit);
+
+    *memoryLimit = (size_t)-1;
+
+    if (!JsrtContext::Is(context))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    Js::ScriptContext * scriptContext = static_cast<JsrtContext *>(context)->GetScriptContext();
+    *memoryLimit = scriptContext->GetRecycler()->GetAllocationAccountLimit(scriptContext->GetAllocationAccountId());
+    return JsNoError;
+}
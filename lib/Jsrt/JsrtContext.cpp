@@ -115,6 +115,7 @@ bool JsrtContext::TrySetCurrent(JsrtContext * context)
             return false;
         }
         threadContext->GetRecycler()->RootAddRef((LPVOID)context);
+        threadContext->GetRecycler()->SetCurrentAllocationAccount(context->GetScriptContext()->GetAllocationAccountId());
     }
     else
     {
@@ -127,7 +128,12 @@ bool JsrtContext::TrySetCurrent(JsrtContext * context)
     JsrtContext* originalContext = (JsrtContext*) TlsGetValue(s_tlsSlot);
     if (originalContext != nullptr)
     {
-        originalContext->GetScriptContext()->GetRecycler()->RootRelease((LPVOID) originalContext);
+        Recycler * originalRecycler = originalContext->GetScriptContext()->GetRecycler();
+        if (context == nullptr || context->GetScriptContext()->GetRecycler() != originalRecycler)
+        {
+            originalRecycler->SetCurrentAllocationAccount(0);
+        }
+        originalRecycler->RootRelease((LPVOID) originalContext);
     }
 
     TlsSetValue(s_tlsSlot, context);
@@ -78,6 +78,8 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
     AssertMsg(size == sizeof(Parser), "verify conditionals affecting the size of Parser agree");
     Assert(scriptContext != nullptr);
     m_isInBackground = isBackground;
+    m_hasBackgroundRegExpNode = false;
+    m_backgroundStackLimit = nullptr;
     m_phtbl = nullptr;
     m_pscan = nullptr;
     m_deferringAST = FALSE;
@@ -230,7 +232,7 @@ HRESULT Parser::ValidateSyntax(LPCUTF8 pszSrc, size_t encodedCharCount, bool isG
 
     if (this->IsBackgroundParser())
     {
-        PROBE_STACK_NO_DISPOSE(m_scriptContext, Js::Constants::MinStackDefault);
+        this->ProbeBackgroundStack(Js::Constants::MinStackDefault);
     }
     else
     {
@@ -329,13 +331,16 @@ HRESULT Parser::ParseSourceInternal(
     AssertPsz(pszSrc);
     AssertMemN(pse);
 
+    // Background parsers run on a job thread and don't own the thread context, its telemetry or the profiler.
 #ifdef ENABLE_BASIC_TELEMETRY
-    double startTime = m_scriptContext->GetThreadContext()->ParserTelemetry.Now();
+    double startTime = this->IsBackgroundParser() ? 0 : m_scriptContext->GetThreadContext()->ParserTelemetry.Now();
 #endif
-    
+
+    Js::Tick parseStartTime = this->IsBackgroundParser() ? Js::Tick() : Js::Tick::Now();
+
     if (this->IsBackgroundParser())
     {
-        PROBE_STACK_NO_DISPOSE(m_scriptContext, Js::Constants::MinStackDefault);
+        this->ProbeBackgroundStack(Js::Constants::MinStackDefault);
     }
     else
     {
@@ -343,7 +348,10 @@ HRESULT Parser::ParseSourceInternal(
     }
 
 #ifdef PROFILE_EXEC
-    m_scriptContext->ProfileBegin(Js::ParsePhase);
+    if (!this->IsBackgroundParser())
+    {
+        m_scriptContext->ProfileBegin(Js::ParsePhase);
+    }
 #endif
     JS_ETW(EventWriteJSCRIPT_PARSE_START(m_scriptContext,0));
 
@@ -445,15 +453,22 @@ HRESULT Parser::ParseSourceInternal(
     RELEASEPTR(m_pscan);
 
 #ifdef PROFILE_EXEC
-    m_scriptContext->ProfileEnd(Js::ParsePhase);
+    if (!this->IsBackgroundParser())
+    {
+        m_scriptContext->ProfileEnd(Js::ParsePhase);
+    }
 #endif
     JS_ETW(EventWriteJSCRIPT_PARSE_STOP(m_scriptContext, 0));
 
+    if (!this->IsBackgroundParser())
+    {
 #ifdef ENABLE_BASIC_TELEMETRY
-    ThreadContext *threadContext = m_scriptContext->GetThreadContext();
-    threadContext->ParserTelemetry.LogTime(threadContext->ParserTelemetry.Now() - startTime);
+        ThreadContext *threadContext = m_scriptContext->GetThreadContext();
+        threadContext->ParserTelemetry.LogTime(threadContext->ParserTelemetry.Now() - startTime);
 #endif
-    
+        m_scriptContext->GetThreadContext()->threadStatistics.parseMicroseconds += (uint64)(Js::Tick::Now() - parseStartTime).ToMicroseconds();
+    }
+
     return hr;
 }
 
@@ -2052,12 +2067,46 @@ BOOL Parser::PnodeLabelNoAST(IdentToken* pToken, LabelId* pLabelIdList)
 
 void Parser::EnsureStackAvailable()
 {
+    if (this->IsBackgroundParser() && m_backgroundStackLimit != nullptr)
+    {
+        // Not a parse error: the owner of the job retries the parse on the main thread
+        this->ProbeBackgroundStack(Js::Constants::MinStackCompile);
+        return;
+    }
+
     if (!m_scriptContext->GetThreadContext()->IsStackAvailable(Js::Constants::MinStackCompile))
     {
         Error(ERRnoMemory);
     }
 }
 
+// A background parser given a stack limit probes the stack of the job thread it runs on. The thread context's stack limit
+// belongs to the main thread, and the script interrupt and the sampling profiler hammer it to get the main thread's attention.
+void Parser::ProbeBackgroundStack(size_t size)
+{
+    Assert(this->IsBackgroundParser());
+
+    if (m_backgroundStackLimit == nullptr)
+    {
+        // The main thread is helping with background work
+        PROBE_STACK_NO_DISPOSE(m_scriptContext, size);
+        return;
+    }
+
+    if (!this->IsBackgroundStackAvailable(size))
+    {
+        throw Js::StackOverflowException();
+    }
+}
+
+_NOINLINE // See ThreadContext::IsStackAvailable
+bool Parser::IsBackgroundStackAvailable(size_t size)
+{
+    Assert(m_backgroundStackLimit != nullptr);
+    PBYTE sp = (PBYTE)_AddressOfReturnAddress();
+    return (size_t)sp > size && (sp - size) > m_backgroundStackLimit;
+}
+
 void Parser::ThrowNewTargetSyntaxErrForGlobalScope()
 {
     if (GetCurrentNonLambdaFunctionNode() != nullptr)
@@ -2840,7 +2889,7 @@ ParseNodePtr Parser::ParseTerm(BOOL fAllowCall,
 
     if (this->IsBackgroundParser())
     {
-        PROBE_STACK_NO_DISPOSE(m_scriptContext, Js::Constants::MinStackParseOneTerm);
+        this->ProbeBackgroundStack(Js::Constants::MinStackParseOneTerm);
     }
     else
     {
@@ -10575,7 +10624,7 @@ void Parser::RestoreScopeInfo(Js::FunctionBody* functionBody)
 
     if (this->IsBackgroundParser())
     {
-        PROBE_STACK_NO_DISPOSE(m_scriptContext, Js::Constants::MinStackByteCodeVisitor);
+        this->ProbeBackgroundStack(Js::Constants::MinStackByteCodeVisitor);
     }
     else
     {
@@ -10631,7 +10680,7 @@ void Parser::FinishScopeInfo(Js::FunctionBody *functionBody)
 
     if (this->IsBackgroundParser())
     {
-        PROBE_STACK_NO_DISPOSE(m_scriptContext, Js::Constants::MinStackByteCodeVisitor);
+        this->ProbeBackgroundStack(Js::Constants::MinStackByteCodeVisitor);
     }
     else
     {
@@ -10927,7 +10976,10 @@ ParseNodePtr Parser::Parse(LPCUTF8 pszSrc, size_t offset, size_t length, charcou
     // Append block as body of pnodeProg
     FinishParseBlock(pnodeGlobalBlock);
 
-    m_scriptContext->AddSourceSize(m_length);
+    if (!this->IsBackgroundParser())
+    {
+        m_scriptContext->AddSourceSize(m_length);
+    }
 
     if (m_parseType != ParseType_Deferred)
     {
@@ -11102,7 +11154,14 @@ void Parser::AddFastScannedRegExpNode(ParseNodePtr const pnode)
 void Parser::AddBackgroundRegExpNode(ParseNodePtr const pnode)
 {
     Assert(IsBackgroundParser());
-    Assert(currBackgroundParseItem != nullptr);
+
+    if (currBackgroundParseItem == nullptr)
+    {
+        // A whole module is being parsed on a job processor thread, with no foreground fast scan to hand us the
+        // compiled pattern. Let the owner know the tree can't be used as is.
+        m_hasBackgroundRegExpNode = true;
+        return;
+    }
 
     currBackgroundParseItem->AddRegExpNode(pnode, &m_nodeAllocator);
 }
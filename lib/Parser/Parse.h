@@ -129,6 +129,9 @@ public:
     void ClearScriptContext() { m_scriptContext = nullptr; }
 
     bool IsBackgroundParser() const { return m_isInBackground; }
+    void SetIsBackgroundParser(bool isBackground) { m_isInBackground = isBackground; }
+    bool HasBackgroundRegExpNode() const { return m_hasBackgroundRegExpNode; }
+    void SetBackgroundStackLimit(PBYTE stackLimit) { Assert(IsBackgroundParser()); m_backgroundStackLimit = stackLimit; }
     bool IsDoingFastScan() const { return m_doingFastScan; }
 
     static IdentPtr PidFromNode(ParseNodePtr pnode);
@@ -218,6 +221,8 @@ private:
         LPCOLESTR pszSrc, int32 cchSrc, LPCOLESTR pszTitle);
 
     void EnsureStackAvailable();
+    void ProbeBackgroundStack(size_t size);
+    bool IsBackgroundStackAvailable(size_t size);
 
     void IdentifierExpectedError(const Token& token);
 
@@ -367,6 +372,8 @@ private:
     ParseNodePtr * m_ppnodeVar;  // variable list tail
     bool m_inDeferredNestedFunc; // true if parsing a function in deferred mode, nested within the current node
     bool m_isInBackground;
+    bool m_hasBackgroundRegExpNode; // a background parse of a whole script saw a regex literal it couldn't compile
+    PBYTE m_backgroundStackLimit;   // stack limit of the job thread a background parser runs on; null when the main thread helps out
 
     // This bool is used for deferring the shorthand initializer error ( {x = 1}) - as it is allowed in the destructuring grammar.
     bool m_hasDeferredShorthandInitError;
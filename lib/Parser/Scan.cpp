@@ -4,6 +4,12 @@
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
 /*****************************************************************************
 *
 *  The following table speeds various tests of characters, such as whether
@@ -89,6 +95,142 @@ struct AorW< OLECHAR >
     }
 };
 
+/*****************************************************************************
+*
+*  Skip loops for the runs of plain ASCII that make up most of comments, string
+*  bodies, identifiers and indentation. Each one returns the first code unit at or
+*  after p that the scanner has to look at itself; anything that isn't ASCII always
+*  stops a run so that multi-unit characters, LS and PS go through the normal path.
+*  Only whole 16-byte blocks before last are examined, which keeps the loads inside
+*  the source buffer; the scanner's own loops deal with whatever is left.
+*/
+
+#if defined(_M_IX86) || defined(_M_X64)
+template< typename CharT >
+struct ScanBlock
+{
+};
+
+template<>
+struct ScanBlock< UTF8Char >
+{
+    static __m128i Match(__m128i block, char ch) { return _mm_cmpeq_epi8(block, _mm_set1_epi8(ch)); }
+    static __m128i MatchRange(__m128i block, char min, char max)
+    {
+        // Bytes >= 0x80 are negative here, so they never fall into an ASCII range
+        return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(min - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8(max + 1)));
+    }
+    static __m128i MatchNonAscii(__m128i block) { return _mm_cmplt_epi8(block, _mm_setzero_si128()); }
+};
+
+template<>
+struct ScanBlock< OLECHAR >
+{
+    static __m128i Match(__m128i block, char ch) { return _mm_cmpeq_epi16(block, _mm_set1_epi16(ch)); }
+    static __m128i MatchRange(__m128i block, char min, char max)
+    {
+        return _mm_and_si128(_mm_cmpgt_epi16(block, _mm_set1_epi16(min - 1)), _mm_cmplt_epi16(block, _mm_set1_epi16(max + 1)));
+    }
+    static __m128i MatchNonAscii(__m128i block)
+    {
+        return _mm_xor_si128(_mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128()), _mm_set1_epi16(-1));
+    }
+};
+
+template< typename CharT, typename TStopMask >
+static const CharT* SkipToStop(const CharT* p, const CharT* last, TStopMask stopMask)
+{
+    const ptrdiff_t unitsPerBlock = sizeof(__m128i) / sizeof(CharT);
+    while (last - p >= unitsPerBlock)
+    {
+        int mask = _mm_movemask_epi8(stopMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+        if (mask != 0)
+        {
+            DWORD firstStop;
+            _BitScanForward(&firstStop, mask);
+            return p + firstStop / sizeof(CharT);
+        }
+        p += unitsPerBlock;
+    }
+    return p;
+}
+
+// Spaces and tabs between tokens
+template< typename CharT >
+static const CharT* SkipWhiteSpaceRun(const CharT* p, const CharT* last)
+{
+    return SkipToStop(p, last, [](__m128i block)
+    {
+        return _mm_xor_si128(_mm_or_si128(ScanBlock<CharT>::Match(block, ' '), ScanBlock<CharT>::Match(block, '\t')), _mm_set1_epi8(-1));
+    });
+}
+
+// Body of a // comment: stops at line terminators and NUL
+template< typename CharT >
+static const CharT* SkipLineCommentRun(const CharT* p, const CharT* last)
+{
+    return SkipToStop(p, last, [](__m128i block)
+    {
+        return _mm_or_si128(
+            _mm_or_si128(ScanBlock<CharT>::Match(block, kchNWL), ScanBlock<CharT>::Match(block, kchRET)),
+            _mm_or_si128(ScanBlock<CharT>::Match(block, kchNUL), ScanBlock<CharT>::MatchNonAscii(block)));
+    });
+}
+
+// Body of a /* */ comment: also stops at '*'
+template< typename CharT >
+static const CharT* SkipBlockCommentRun(const CharT* p, const CharT* last)
+{
+    return SkipToStop(p, last, [](__m128i block)
+    {
+        return _mm_or_si128(
+            _mm_or_si128(
+                _mm_or_si128(ScanBlock<CharT>::Match(block, kchNWL), ScanBlock<CharT>::Match(block, kchRET)),
+                _mm_or_si128(ScanBlock<CharT>::Match(block, kchNUL), ScanBlock<CharT>::Match(block, '*'))),
+            ScanBlock<CharT>::MatchNonAscii(block));
+    });
+}
+
+// Body of a string literal or template: stops at quotes, escapes, line terminators, NUL and '$'
+template< typename CharT >
+static const CharT* SkipStringRun(const CharT* p, const CharT* last)
+{
+    return SkipToStop(p, last, [](__m128i block)
+    {
+        return _mm_or_si128(
+            _mm_or_si128(
+                _mm_or_si128(
+                    _mm_or_si128(ScanBlock<CharT>::Match(block, '"'), ScanBlock<CharT>::Match(block, '\'')),
+                    _mm_or_si128(ScanBlock<CharT>::Match(block, '`'), ScanBlock<CharT>::Match(block, '$'))),
+                _mm_or_si128(
+                    _mm_or_si128(ScanBlock<CharT>::Match(block, kchBSL), ScanBlock<CharT>::Match(block, kchNUL)),
+                    _mm_or_si128(ScanBlock<CharT>::Match(block, kchNWL), ScanBlock<CharT>::Match(block, kchRET)))),
+            ScanBlock<CharT>::MatchNonAscii(block));
+    });
+}
+
+// Identifier tail: [A-Za-z0-9$_]
+template< typename CharT >
+static const CharT* SkipIdentifierRun(const CharT* p, const CharT* last)
+{
+    return SkipToStop(p, last, [](__m128i block)
+    {
+        __m128i idChars = _mm_or_si128(
+            _mm_or_si128(ScanBlock<CharT>::MatchRange(block, 'a', 'z'), ScanBlock<CharT>::MatchRange(block, 'A', 'Z')),
+            _mm_or_si128(
+                ScanBlock<CharT>::MatchRange(block, '0', '9'),
+                _mm_or_si128(ScanBlock<CharT>::Match(block, '$'), ScanBlock<CharT>::Match(block, '_'))));
+        return _mm_xor_si128(idChars, _mm_set1_epi8(-1));
+    });
+}
+#else
+template< typename CharT > static const CharT* SkipWhiteSpaceRun(const CharT* p, const CharT* last) { return p; }
+template< typename CharT > static const CharT* SkipLineCommentRun(const CharT* p, const CharT* last) { return p; }
+template< typename CharT > static const CharT* SkipBlockCommentRun(const CharT* p, const CharT* last) { return p; }
+template< typename CharT > static const CharT* SkipStringRun(const CharT* p, const CharT* last) { return p; }
+template< typename CharT > static const CharT* SkipIdentifierRun(const CharT* p, const CharT* last) { return p; }
+#endif
+
 BOOL Token::IsKeyword() const
 {
     // keywords (but not future reserved words)
@@ -486,6 +628,8 @@ tokens Scanner<EncodingPolicy>::ScanIdentifierContinue(bool identifyKwds, bool f
 
     while (true)
     {
+        p = SkipIdentifierRun(p, last);
+
         // Fast path for utf8, non-multi unit char and not escape
         if (FastIdentifierContinue(p, last))
         {
@@ -1173,6 +1317,14 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
 
     for (;;)
     {
+        EncodedCharPtr pchRun = p;
+        p = SkipStringRun(p, last);
+        if (p != pchRun)
+        {
+            m_tempChBuf.AppendChars(pchRun, (uint32)(p - pchRun));
+            m_tempChBufSecondary.template AppendChars<createRawString>(pchRun, (uint32)(p - pchRun));
+        }
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1601,6 +1753,8 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        p = SkipBlockCommentRun(p, last);
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1886,6 +2040,7 @@ LEof:
         case 0x000C:
         case 0x0020:
             Assert(chType == _C_WSP);
+            p = SkipWhiteSpaceRun(p, last);
             continue;
 
         case '.':
@@ -2157,6 +2312,8 @@ LSkipLineComment:
                 pchT = NULL;
                 for (;;)
                 {
+                    p = SkipLineCommentRun(p, last);
+
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
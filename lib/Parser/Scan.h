@@ -624,6 +624,30 @@ public:
             }
         }
 
+        template<typename EncodedCharType> void AppendChars(const EncodedCharType* pch, uint32 cch)
+        {
+            return AppendChars<true>(pch, cch);
+        }
+
+        // Appends a run of single-unit characters, widening each to an OLECHAR
+        template<bool performAppend, typename EncodedCharType> void AppendChars(const EncodedCharType* pch, uint32 cch)
+        {
+            if (performAppend)
+            {
+                while (m_cchMax - m_ichCur < cch)
+                {
+                    Grow();
+                }
+
+                Assert(m_ichCur + cch <= m_cchMax);
+                for (uint32 i = 0; i < cch; i++)
+                {
+                    m_prgch[m_ichCur + i] = static_cast<OLECHAR>(pch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
         void Grow()
         {
             Assert(m_pscanner != nullptr);
@@ -25,8 +25,10 @@ const char16 Constants::UnknownScriptCode[] = _u("Unknown script code");
 
 #ifdef _M_AMD64
 const PBYTE Constants::StackLimitForScriptInterrupt = (PBYTE)0x7fffffffffffffff;
+const PBYTE Constants::StackLimitForSamplingInterrupt = (PBYTE)0x7ffffffffffffffe;
 #else
 const PBYTE Constants::StackLimitForScriptInterrupt = (PBYTE)0x7fffffff;
+const PBYTE Constants::StackLimitForSamplingInterrupt = (PBYTE)0x7ffffffe;
 #endif
 
 #pragma warning(push)
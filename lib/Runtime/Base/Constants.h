@@ -114,6 +114,7 @@ namespace Js
 #endif
 
         static const PBYTE StackLimitForScriptInterrupt;
+        static const PBYTE StackLimitForSamplingInterrupt;
 
 
         // Arguments object created on the fly is 1 slot before the frame
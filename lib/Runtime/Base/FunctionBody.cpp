@@ -30,6 +30,7 @@
 #include "Library/RegexHelper.h"
 
 #include "Language/InterpreterStackFrame.h"
+#include "Language/PerfMapInterpreterThunkEmitter.h"
 #include "Library/ModuleRoot.h"
 #include "Types/PathTypeHandler.h"
 #include "Common/MathUtil.h"
@@ -454,6 +455,8 @@ namespace Js
         loopInterpreterLimit(CONFIG_FLAG(LoopInterpretCount)),
         savedPolymorphicCacheState(0),
         debuggerScopeIndex(0),
+        quickeningDeoptCount(0),
+        redeferralInactiveCount(0),
         flags(Flags_HasNoExplicitReturnValue),
         m_hasFinally(false),
 #if ENABLE_PROFILE_INFO
@@ -473,6 +476,8 @@ namespace Js
         m_isParamAndBodyScopeMerged(true),
         m_firstFunctionObject(true),
         m_inlineCachesOnFunctionObject(false),
+        m_isFromDeferredParse(false),
+        m_isReferencedByStackTrace(false),
         m_hasDoneAllNonLocalReferenced(false),
         m_hasFunctionCompiledSent(false),
         byteCodeCache(nullptr),
@@ -506,6 +511,7 @@ namespace Js
         wasCalledFromLoop(false),
         hasScopeObject(false),
         hasNestedLoop(false),
+        hasLoopWithoutLoopBodyStart(false),
         recentlyBailedOutOfJittedLoopBody(false),
         m_isAsmJsScheduledForFullJIT(false),
         m_asmJsTotalLoopCount(0)
@@ -623,6 +629,154 @@ namespace Js
         }
     }
 
+    // Returns the copy of the byte code that quickening interpreter frames execute (see DoInterpreterQuickening). The
+    // interpreter overwrites generic opcodes in it with type-specialized forms as it observes operand types (see
+    // InterpreterStackFrame::QuickenOpCode), so it must never be shared with the debugger, the serializer or the JIT,
+    // all of which read GetByteCode().
+    ByteBlock*
+    FunctionBody::EnsureQuickenedByteCode()
+    {
+        ByteBlock * quickenedByteCode = this->GetQuickenedByteCode();
+        if (quickenedByteCode == nullptr)
+        {
+            ByteBlock * byteCode = this->GetByteCode();
+            Assert(byteCode != nullptr);
+            quickenedByteCode = ByteBlock::New(this->m_scriptContext->GetRecycler(), byteCode->GetBuffer(), byteCode->GetLength());
+            this->SetAuxPtr(AuxPointerType::QuickenedByteCode, quickenedByteCode);
+        }
+        return quickenedByteCode;
+    }
+
+    bool
+    FunctionBody::DoInterpreterQuickening()
+    {
+#if ENABLE_NATIVE_CODEGEN
+        // With a JIT available the interpreter only runs cold code, so the private copy isn't worth its memory.
+        if (!PHASE_ON(Js::QuickeningPhase, this))
+        {
+            return false;
+        }
+#else
+        if (PHASE_OFF(Js::QuickeningPhase, this))
+        {
+            return false;
+        }
+#endif
+        // Functions that only run a few times (global code, one-time initializers) keep executing the shared byte
+        // code, so they never pay for the copy.
+        return !this->IsInDebugMode() &&
+            !this->GetIsAsmJsFunction() &&
+            this->GetByteCode() != nullptr &&
+            this->GetQuickeningDeoptCount() < (uint32)CONFIG_FLAG(QuickeningDeoptLimit) &&
+            (this->GetQuickenedByteCode() != nullptr || this->GetInterpretedCount() >= (uint32)CONFIG_FLAG(QuickeningThreshold));
+    }
+
+    // Whether the GC-time redeferral pass (see ThreadContext::TryRedeferFunctionBodies) may throw this function's byte code away.
+    // Only byte code produced by a deferred parse qualifies: the next call replays that same parse, against the same ScopeInfo,
+    // so the regenerated function is indistinguishable from the one that was released. Functions a captured stack trace points
+    // into are kept: the trace resolves its byte code offsets to line and column lazily, through the statement maps.
+    bool
+    FunctionBody::CanBeRedeferred()
+    {
+        if (PHASE_OFF(Js::RedeferralPhase, this) ||
+            !this->IsFromDeferredParse() ||
+            this->IsReferencedByStackTrace() ||
+            this->IsDeferredParseFunction() ||
+            this->GetByteCode() == nullptr ||
+            this->m_depth != 0 ||
+            this->GetIsGlobalFunc() ||
+            this->GetIsAsmjsMode() ||
+            this->GetIsAsmJsFunction() ||
+            this->IsCoroutine() ||
+            this->IsInDebugMode() ||
+            this->GetUtf8SourceInfo()->GetIsLibraryCode() ||
+            this->GetInlineCachesOnFunctionObject() ||
+            this->HasGeneratedFromByteCodeCache() ||
+            !this->IsInterpreterThunk() ||
+            m_scriptContext->IsScriptContextInSourceRundownOrDebugMode())
+        {
+            return false;
+        }
+
+#if ENABLE_NATIVE_CODEGEN
+        // Anything the JIT has seen may still be referenced by a background work item or by native code.
+        bool hasNativeCode = false;
+        this->MapEntryPoints([&](int index, FunctionEntryPointInfo* entryPoint)
+        {
+            hasNativeCode = hasNativeCode || (entryPoint != nullptr && !entryPoint->IsNotScheduled());
+        });
+        this->MapLoopHeaders([&](uint loopNumber, LoopHeader* header)
+        {
+            header->MapEntryPoints([&](int index, LoopEntryPointInfo* entryPoint)
+            {
+                hasNativeCode = hasNativeCode || (entryPoint != nullptr && !entryPoint->IsNotScheduled());
+            });
+        });
+        if (hasNativeCode)
+        {
+            return false;
+        }
+#endif
+
+        return true;
+    }
+
+    // Turns the function back into a deferred one: the byte code and everything generated with it is released and the entry
+    // point is switched back to the deferred parsing thunk, as SetEntryToDeferParseForDebugger does for a debugger attach.
+    // ParseableFunctionInfo::Parse regenerates the byte code into this same body on the next call; function objects whose
+    // types still carry the interpreter thunk get there through InterpreterStackFrame::InterpreterHelper.
+    size_t
+    FunctionBody::Redefer()
+    {
+        Assert(this->CanBeRedeferred());
+
+        size_t reclaimedBytes = this->GetByteCode()->GetLength() +
+            this->GetConstantCount() * sizeof(Var) +
+            this->GetInlineCacheCount() * sizeof(InlineCache) +
+            this->GetIsInstInlineCacheCount() * sizeof(IsInstInlineCache);
+        if (this->GetQuickenedByteCode() != nullptr)
+        {
+            reclaimedBytes += this->GetQuickenedByteCode()->GetLength();
+        }
+        if (this->GetAuxiliaryData() != nullptr)
+        {
+            reclaimedBytes += this->GetAuxiliaryData()->GetLength();
+        }
+        if (this->GetAuxiliaryContextData() != nullptr)
+        {
+            reclaimedBytes += this->GetAuxiliaryContextData()->GetLength();
+        }
+
+#if DBG
+        bool isCleaningUpOldValue = this->counters.isCleaningUp;
+        this->counters.isCleaningUp = true;
+#endif
+        this->CleanupByteCodeGenData();
+
+        this->GetDefaultEntryPointInfo()->jsMethod = m_scriptContext->DeferredParsingThunk;
+        this->originalEntryPoint = DefaultDeferredParsingThunk;
+
+        // Abandon the shared type so new function objects pick up the deferred parsing thunk
+        this->deferredPrototypeType = nullptr;
+        this->AddDeferParseAttribute();
+        this->SetStackNestedFunc(false);
+        this->SetIsFromDeferredParse(false);
+        this->ResetRedeferralInactiveCount();
+
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+#endif
+        PHASE_PRINT_TRACE(Js::RedeferralPhase, this, _u("Redeferred function %s (%s), %u bytes released\n"),
+            this->GetDisplayName(), this->GetDebugNumberSet(debugStringBuffer), (uint)reclaimedBytes);
+        PHASE_PRINT_TESTTRACE(Js::RedeferralPhase, this, _u("Redeferred function %s\n"), this->GetDisplayName());
+
+#if DBG
+        this->counters.bgThreadCallStarted = false; // The function has no native code, so no background JIT work refers to it
+        this->counters.isCleaningUp = isCleaningUpOldValue;
+#endif
+        return reclaimedBytes;
+    }
+
     const char16* ParseableFunctionInfo::GetExternalDisplayName() const
     {
         return GetExternalDisplayName(this);
@@ -857,6 +1011,9 @@ namespace Js
         bool isInterpreterThunk = this->originalEntryPoint == DefaultEntryThunk;
 #if DYNAMIC_INTERPRETER_THUNK
         isInterpreterThunk = isInterpreterThunk || IsDynamicInterpreterThunk();
+#endif
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+        isInterpreterThunk = isInterpreterThunk || IsPerfMapInterpreterThunk();
 #endif
         return isInterpreterThunk;
     }
@@ -870,6 +1027,15 @@ namespace Js
 #endif
     }
 
+    BOOL FunctionBody::IsPerfMapInterpreterThunk() const
+    {
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+        return this->m_perfMapInterpreterThunk != nullptr && this->originalEntryPoint == this->m_perfMapInterpreterThunk;
+#else
+        return FALSE;
+#endif
+    }
+
     FunctionEntryPointInfo * FunctionBody::TryGetEntryPointInfo(int index) const
     {
         // If we've already freed the recyclable data, we're shutting down the script context so skip clean up
@@ -1136,6 +1302,9 @@ namespace Js
       FunctionProxy(entryPoint, attributes, functionId, scriptContext, sourceInfo, functionNumber),
 #if DYNAMIC_INTERPRETER_THUNK
       m_dynamicInterpreterThunk(nullptr),
+#endif
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+      m_perfMapInterpreterThunk(nullptr),
 #endif
       m_hasBeenParsed(false),
       m_isGlobalFunc(false),
@@ -1948,6 +2117,10 @@ namespace Js
             // Restore if the function has nameIdentifier reference, as that name on the left side will not be parsed again while deferparse.
             funcBody->SetIsNameIdentifierRef(this->GetIsNameIdentifierRef());
 
+            // A debug or asm.js reparse doesn't replay the original deferred parse, so its result can't be redeferred.
+            funcBody->SetIsFromDeferredParse(!isDebugOrAsmJsReparse);
+            funcBody->ResetRedeferralInactiveCount();
+
             this->UpdateFunctionBodyImpl(funcBody);
             this->m_hasBeenParsed = true;
         }
@@ -1959,7 +2132,6 @@ namespace Js
         return returnFunctionBody;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     FunctionBody* ParseableFunctionInfo::ParseAsmJs(Parser * ps, __out CompileScriptException * se, __out ParseNodePtr * parseTree)
     {
         Assert(IsDeferredParseFunction());
@@ -2058,7 +2230,6 @@ namespace Js
 
         return returnFunctionBody;
     }
-#endif
 
     void ParseableFunctionInfo::Finalize(bool isShutdown)
     {
@@ -2497,6 +2668,12 @@ namespace Js
     {
         Assert(!this->GetUtf8SourceInfo()->GetIsLibraryCode());
 
+        return this->GetLineCharOffsetFromStartChar(this->GetStartCharOfStatement(byteCodeOffset), _line, _charOffset, canAllocateLineCache);
+    }
+
+    // Doesn't allocate, so it can be used from the stack probes.
+    int FunctionBody::GetStartCharOfStatement(int byteCodeOffset)
+    {
         int startCharOfStatement = this->m_cchStartOffset; // Default to the start of this function
 
         if (m_sourceInfo.pSpanSequence)
@@ -2521,7 +2698,7 @@ namespace Js
             }
         }
 
-        return this->GetLineCharOffsetFromStartChar(startCharOfStatement, _line, _charOffset, canAllocateLineCache);
+        return startCharOfStatement;
     }
 
     bool FunctionBody::GetLineCharOffsetFromStartChar(int startCharOfStatement, ULONG* _line, LONG* _charOffset, bool canAllocateLineCache /*= true*/)
@@ -2946,7 +3123,7 @@ namespace Js
         return m_scriptContext->IsNoContextSourceContextInfo(this->GetSourceContextInfo());
     }
 
-    // originalEntryPoint: DefaultDeferredParsingThunk, DefaultDeferredDeserializeThunk, DefaultEntryThunk, dynamic interpreter thunk or native entry point
+    // originalEntryPoint: DefaultDeferredParsingThunk, DefaultDeferredDeserializeThunk, DefaultEntryThunk, dynamic or perf map interpreter thunk or native entry point
     // directEntryPoint:
     //      if (!profiled) - DefaultDeferredParsingThunk, DefaultDeferredDeserializeThunk, DefaultEntryThunk, CheckCodeGenThunk,
     //                       dynamic interpreter thunk, native entry point
@@ -3050,7 +3227,11 @@ namespace Js
         Assert(m_scriptContext->CurrentThunk == DefaultEntryThunk);
         Assert(originalEntryPoint == DefaultDeferredParsingThunk ||
                originalEntryPoint == DefaultDeferredDeserializeThunk ||
-               originalEntryPoint == DefaultEntryThunk);
+               originalEntryPoint == DefaultEntryThunk
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+               || (this->IsFunctionBody() && this->GetFunctionBody()->IsPerfMapInterpreterThunk())
+#endif
+               );
 #endif
         Assert(this->m_defaultEntryPointInfo != nullptr);
 
@@ -3058,6 +3239,13 @@ namespace Js
         // If we know that we are in the defer parsing thunk already
         this->SetEntryPoint(this->GetDefaultEntryPointInfo(), m_scriptContext->CurrentThunk);
         this->originalEntryPoint = DefaultEntryThunk;
+
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+        if (this->IsFunctionBody())
+        {
+            this->GetFunctionBody()->GeneratePerfMapInterpreterThunk();
+        }
+#endif
     }
 
     void FunctionBody::SetCheckCodeGenEntryPoint(FunctionEntryPointInfo* entryPointInfo, JavascriptMethod entryPoint)
@@ -3150,6 +3338,41 @@ namespace Js
     }
 #endif
 
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+    void FunctionBody::GeneratePerfMapInterpreterThunk()
+    {
+        Assert(this->originalEntryPoint == DefaultEntryThunk || this->IsPerfMapInterpreterThunk());
+
+        if (this->m_perfMapInterpreterThunk == nullptr)
+        {
+            // Asm.js functions are entered through their own interpreter thunk.
+            if (m_isAsmJsFunction)
+            {
+                return;
+            }
+
+            PerfMapInterpreterThunkEmitter *emitter = this->m_scriptContext->GetThreadContext()->GetPerfMapInterpreterThunkEmitter();
+            if (emitter == nullptr)
+            {
+                return;
+            }
+
+            // Keep the shared thunk if this one can't be had; the function just won't get its own name in the profile.
+            this->m_perfMapInterpreterThunk = emitter->GetNextThunk(this);
+            if (this->m_perfMapInterpreterThunk == nullptr)
+            {
+                return;
+            }
+        }
+
+        this->originalEntryPoint = this->m_perfMapInterpreterThunk;
+        if (this->GetEntryPoint(this->GetDefaultEntryPointInfo()) == DefaultEntryThunk)
+        {
+            this->SetEntryPoint(this->GetDefaultEntryPointInfo(), this->m_perfMapInterpreterThunk);
+        }
+    }
+#endif
+
 #if ENABLE_NATIVE_CODEGEN
     void FunctionBody::SetNativeEntryPoint(FunctionEntryPointInfo* entryPointInfo, JavascriptMethod originalEntryPoint, Var directEntryPoint)
     {
@@ -3301,6 +3524,7 @@ namespace Js
         MemoryBarrier();
 
         this->byteCodeBlock = byteCodeBlock;
+        this->SetAuxPtr(AuxPointerType::QuickenedByteCode, nullptr);
         PERF_COUNTER_ADD(Code, TotalByteCodeSize, byteCodeSize);
 
         // If this is a defer parse function body, we would not have registered it
@@ -4302,6 +4526,29 @@ namespace Js
             return true;
         });
 
+        this->CleanupByteCodeGenData();
+
+        this->SetScopeInfo(nullptr);
+        this->SetDebuggerScopeIndex(0);
+        this->GetUtf8SourceInfo()->DeleteLineOffsetCache();
+
+        ResetInParams();
+
+        this->m_isAsmjsMode = false;
+        this->m_isAsmJsFunction = false;
+        this->m_isAsmJsScheduledForFullJIT = false;
+        this->m_asmJsTotalLoopCount = 0;
+
+#if DBG
+        this->counters.isCleaningUp = isCleaningUpOldValue;
+#endif
+    }
+
+    // Throws away everything the byte code generator produced for this function (byte code, auxiliary data, constant
+    // table, inline caches, loop headers, statement maps, entry points) so that the next parse regenerates it.
+    // The function's ScopeInfo, in-params and nested function array are left for the caller to deal with.
+    void FunctionBody::CleanupByteCodeGenData()
+    {
         CleanupRecyclerData(/* isShutdown */ false, true /* capture entry point cleanup stack trace */);
 
         this->entryPoints->ClearAndZero();
@@ -4326,9 +4573,9 @@ namespace Js
         this->SetAuxiliaryData(nullptr);
         this->SetAuxiliaryContextData(nullptr);
         this->byteCodeBlock = nullptr;
+        this->SetAuxPtr(AuxPointerType::QuickenedByteCode, nullptr);
         this->SetLoopHeaderArray(nullptr);
         this->SetConstTable(nullptr);
-        this->SetScopeInfo(nullptr);
         this->SetCodeGenRuntimeData(nullptr);
         this->cacheIdToPropertyIdMap = nullptr;
         this->SetFormalsPropIdArray(nullptr);
@@ -4389,19 +4636,9 @@ namespace Js
 
         this->m_hasDoneAllNonLocalReferenced = false;
 
-        this->SetDebuggerScopeIndex(0);
-        this->GetUtf8SourceInfo()->DeleteLineOffsetCache();
-
         // Reset to default.
         this->flags = Flags_HasNoExplicitReturnValue;
 
-        ResetInParams();
-
-        this->m_isAsmjsMode = false;
-        this->m_isAsmJsFunction = false;
-        this->m_isAsmJsScheduledForFullJIT = false;
-        this->m_asmJsTotalLoopCount = 0;
-
         recentlyBailedOutOfJittedLoopBody = false;
 
         SetLoopInterpreterLimit(CONFIG_FLAG(LoopInterpretCount));
@@ -4427,10 +4664,6 @@ namespace Js
             Assert(m_scriptContext->GetRecycler()->IsValidObject(m_sourceInfo.m_auxStatementData));
             m_sourceInfo.m_auxStatementData = nullptr;
         }
-
-#if DBG
-        this->counters.isCleaningUp = isCleaningUpOldValue;
-#endif
     }
 
     void FunctionBody::SetEntryToDeferParseForDebugger()
@@ -4504,6 +4737,9 @@ namespace Js
         this->CreateNewDefaultEntryPoint();
         this->originalEntryPoint = DefaultEntryThunk;
         m_defaultEntryPointInfo->jsMethod = m_scriptContext->CurrentThunk;
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+        this->GeneratePerfMapInterpreterThunk();
+#endif
 
         if (this->deferredPrototypeType)
         {
@@ -5589,7 +5825,6 @@ namespace Js
         this->SetLiteralRegexs(RecyclerNewArrayZ(m_scriptContext->GetRecycler(), UnifiedRegex::RegexPattern *, literalRegexCount));
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     AsmJsFunctionInfo* FunctionBody::AllocateAsmJsFunctionInfo()
     {
         Assert( !this->GetAsmJsFunctionInfo() );
@@ -5604,7 +5839,6 @@ namespace Js
         this->SetAuxPtr(AuxPointerType::AsmJsModuleInfo, RecyclerNew(rec, AsmJsModuleInfo, rec));
         return this->GetAsmJsModuleInfo();
     }
-#endif
 
     PropertyIdArray * FunctionBody::AllocatePropertyIdArrayForFormals(uint32 size, uint32 count)
     {
@@ -5696,6 +5930,7 @@ namespace Js
         this->SetConstantCount(0);
         this->SetConstTable(nullptr);
         this->byteCodeBlock = nullptr;
+        this->SetAuxPtr(AuxPointerType::QuickenedByteCode, nullptr);
 
         // There is other state that is set by the byte code generator but the state should be the same each time byte code
         // generation is done for the function, so it doesn't need to be reverted
@@ -5894,6 +6129,8 @@ namespace Js
                     m_dynamicInterpreterThunk
                         ? static_cast<JavascriptMethod>(InterpreterThunkEmitter::ConvertToEntryPoint(m_dynamicInterpreterThunk))
                         : DefaultEntryThunk;
+#elif ENABLE_PERF_MAP_INTERPRETER_THUNK
+                originalEntryPoint = m_perfMapInterpreterThunk ? m_perfMapInterpreterThunk : DefaultEntryThunk;
 #else
                 originalEntryPoint = DefaultEntryThunk;
 #endif
@@ -7268,6 +7505,7 @@ namespace Js
         this->SetAuxiliaryData(nullptr);
         this->SetAuxiliaryContextData(nullptr);
         this->byteCodeBlock = nullptr;
+        this->SetAuxPtr(AuxPointerType::QuickenedByteCode, nullptr);
         this->entryPoints = nullptr;
         this->SetLoopHeaderArray(nullptr);
         this->SetConstTable(nullptr);
@@ -8587,7 +8825,6 @@ namespace Js
     {
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     void FunctionEntryPointInfo::SetOldFunctionEntryPointInfo(FunctionEntryPointInfo* entrypointInfo)
     {
         Assert(this->GetIsAsmJSFunction());
@@ -8610,7 +8847,6 @@ namespace Js
     {
         return mIsTemplatizedJitMode;
     };
-#endif
     //End AsmJS Support
 
 #if ENABLE_NATIVE_CODEGEN
@@ -8677,13 +8913,11 @@ namespace Js
             }
 
             FunctionBody* functionBody = this->functionProxy->GetFunctionBody();
-#ifndef TEMP_DISABLE_ASMJS
             if (this->GetIsTJMode())
             {
                 // release LoopHeaders here if the entrypointInfo is TJ
                 this->GetFunctionBody()->ReleaseLoopHeaders();
             }
-#endif
             if(functionBody->GetSimpleJitEntryPointInfo() == this)
             {
                 functionBody->SetSimpleJitEntryPointInfo(nullptr);
@@ -8969,11 +9203,7 @@ namespace Js
 
     void LoopEntryPointInfo::OnCleanup(bool isShutdown)
     {
-#ifndef TEMP_DISABLE_ASMJS
         if (this->IsCodeGenDone() && !this->GetIsTJMode())
-#else
-        if (this->IsCodeGenDone())
-#endif
         {
             JS_ETW(EtwTrace::LogLoopBodyUnloadEvent(this->loopHeader->functionBody, this->loopHeader, this));
 
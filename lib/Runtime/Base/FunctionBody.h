@@ -42,10 +42,8 @@ namespace Js
     class DebuggerScope;
     class FunctionEntryPointInfo;
 
-#ifndef TEMP_DISABLE_ASMJS
     class AsmJsFunctionInfo;
     class AmsJsModuleInfo;
-#endif
     class ArrayBuffer;
     class FunctionCodeGenRuntimeData;
 #pragma endregion
@@ -717,7 +715,6 @@ namespace Js
         }
 #endif
 
-#ifndef TEMP_DISABLE_ASMJS
         void SetModuleAddress(uintptr_t moduleAddress)
         {
             Assert(this->GetIsAsmJSFunction());
@@ -731,7 +728,6 @@ namespace Js
             Assert(mModuleAddress); // module address should not be null
             return mModuleAddress;
         }
-#endif
 
         void Reset(bool resetStateToNotScheduled = true);
 
@@ -858,7 +854,6 @@ namespace Js
             return this->workItem;
         }
 
-#ifndef TEMP_DISABLE_ASMJS
         // set code size, used by TJ to set the code size
         void SetCodeSize(ptrdiff_t size)
         {
@@ -876,21 +871,18 @@ namespace Js
         {
             this->isAsmJsFunction = value;
         }
-#endif
 
         bool GetIsAsmJSFunction()const
         {
             return this->isAsmJsFunction;
         }
 
-#ifndef TEMP_DISABLE_ASMJS
         void SetTJCodeGenDone()
         {
             Assert(isAsmJsFunction);
             this->state = CodeGenDone;
             this->workItem = nullptr;
         }
-#endif
 
 #if ENABLE_NATIVE_CODEGEN
         void AddWeakFuncRef(RecyclerWeakReference<FunctionBody> *weakFuncRef, Recycler *recycler);
@@ -996,7 +988,6 @@ namespace Js
     public:
         FunctionEntryPointInfo(FunctionProxy * functionInfo, Js::JavascriptMethod method, ThreadContext* context, void* validationCookie);
 
-#ifndef TEMP_DISABLE_ASMJS
         //AsmJS Support
 
         void SetOldFunctionEntryPointInfo(FunctionEntryPointInfo* entrypointInfo);
@@ -1004,7 +995,6 @@ namespace Js
         void SetIsTJMode(bool value);
         bool GetIsTJMode()const;
         //End AsmJS Support
-#endif
 
         virtual FunctionBody *GetFunctionBody() const override;
 #if ENABLE_NATIVE_CODEGEN
@@ -1060,7 +1050,6 @@ namespace Js
         }
 #endif
 
-#ifndef TEMP_DISABLE_ASMJS
         void SetIsTJMode(bool value)
         {
             Assert(this->GetIsAsmJSFunction());
@@ -1071,7 +1060,6 @@ namespace Js
         {
             return mIsTemplatizedJitMode;
         };
-#endif
 
 #ifdef PERF_COUNTERS
         virtual void OnRecorded() override;
@@ -1259,6 +1247,7 @@ namespace Js
             ObjLiteralTypes = 19,
             ScopeInfo = 20,
             FormalsPropIdArray = 21,
+            QuickenedByteCode = 22,               // Private copy of the byte code that the interpreter specializes in place
 
             Max,
             Invalid = 0xff
@@ -1467,9 +1456,7 @@ namespace Js
 
         DEFINE_VTABLE_CTOR_NO_REGISTER(ParseableFunctionInfo, FunctionProxy);
         FunctionBody* Parse(ScriptFunction ** functionRef = nullptr, bool isByteCodeDeserialization = false);
-#ifndef TEMP_DISABLE_ASMJS
         FunctionBody* ParseAsmJs(Parser * p, __out CompileScriptException * se, __out ParseNodePtr * ptree);
-#endif
         virtual uint GetDisplayNameLength() const { return m_displayNameLength; }
         virtual uint GetShortDisplayNameOffset() const { return m_displayShortNameOffset; }
         bool GetIsDeclaration() const { return m_isDeclaration; }
@@ -1692,6 +1679,9 @@ namespace Js
         NoWriteBarrierField<uint> m_sourceIndex;             // index into the scriptContext's list of saved sources
 #if DYNAMIC_INTERPRETER_THUNK
         void* m_dynamicInterpreterThunk;  // Unique 'thunk' for every interpreted function - used for ETW symbol decoding.
+#endif
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+        JavascriptMethod m_perfMapInterpreterThunk;  // Unique 'thunk' for every interpreted function - listed in the perf map.
 #endif
         NoWriteBarrierField<uint> m_cbStartOffset;         // pUtf8Source is this many bytes from the start of the scriptContext's source buffer.
 
@@ -2005,9 +1995,12 @@ namespace Js
         bool hasHotLoop: 1;
         bool wasCalledFromLoop : 1;
         bool hasNestedLoop : 1;
+        bool hasLoopWithoutLoopBodyStart : 1; // The byte code has a loop that the interpreter can't probe for script interrupts or samples
         bool recentlyBailedOutOfJittedLoopBody : 1;
         bool m_firstFunctionObject: 1;
         bool m_inlineCachesOnFunctionObject: 1;
+        bool m_isFromDeferredParse : 1;     // Byte code was generated by ParseableFunctionInfo::Parse, so it can be regenerated the same way
+        bool m_isReferencedByStackTrace : 1; // A captured stack trace holds a byte code offset into this function, so its statement maps must stay valid
         // Used for the debug re-parse. Saves state of function on the first parse, and restores it on a reparse. The state below is either dependent on
         // the state of the script context, or on other factors like whether it was defer parsed or not.
         bool m_hasSetIsObject : 1;
@@ -2080,6 +2073,8 @@ namespace Js
         uint32 loopInterpreterLimit;
         uint32 debuggerScopeIndex;
         uint32 savedPolymorphicCacheState;
+        uint32 quickeningDeoptCount; // Runtime state, mutated by the interpreter, so it can't live in the compact counters
+        uint32 redeferralInactiveCount; // Number of GCs since the interpreter last entered the function
 
         // >>>>>>WARNING! WARNING!<<<<<<<<<<
         //
@@ -2115,6 +2110,9 @@ namespace Js
         void SetNativeEntryPoint(FunctionEntryPointInfo* entryPointInfo, JavascriptMethod originalEntryPoint, Var directEntryPoint);
 #if DYNAMIC_INTERPRETER_THUNK
         void GenerateDynamicInterpreterThunk();
+#endif
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+        void GeneratePerfMapInterpreterThunk();
 #endif
         void CloneByteCodeInto(ScriptContext * scriptContext, FunctionBody *newFunctionBody, uint sourceIndex);
         Js::JavascriptMethod GetEntryPoint(ProxyEntryPointInfo* entryPoint) const { return entryPoint->jsMethod; }
@@ -2161,6 +2159,20 @@ namespace Js
         Var GetFormalsPropIdArrayOrNullObj();
         ByteBlock* GetByteCode();
         ByteBlock* GetOriginalByteCode(); // Returns original bytecode without probes (such as BPs).
+        ByteBlock* GetQuickenedByteCode() const { return static_cast<ByteBlock*>(this->GetAuxPtr(AuxPointerType::QuickenedByteCode)); }
+        ByteBlock* EnsureQuickenedByteCode(); // Returns the interpreter's private, specializable copy of the byte code.
+        bool DoInterpreterQuickening();
+        uint32 GetQuickeningDeoptCount() const { return quickeningDeoptCount; }
+        uint32 IncreaseQuickeningDeoptCount() { return ++quickeningDeoptCount; }
+        uint32 GetRedeferralInactiveCount() const { return redeferralInactiveCount; }
+        uint32 IncreaseRedeferralInactiveCount() { return ++redeferralInactiveCount; }
+        void ResetRedeferralInactiveCount() { redeferralInactiveCount = 0; }
+        bool IsFromDeferredParse() const { return m_isFromDeferredParse; }
+        void SetIsFromDeferredParse(bool set) { m_isFromDeferredParse = set; }
+        bool IsReferencedByStackTrace() const { return m_isReferencedByStackTrace; }
+        void SetIsReferencedByStackTrace() { m_isReferencedByStackTrace = true; }
+        bool CanBeRedeferred();
+        size_t Redefer(); // Returns the number of bytes released
         Js::ByteCodeCache * GetByteCodeCache() const { return this->byteCodeCache; }
         void SetByteCodeCache(Js::ByteCodeCache *byteCodeCache)
         {
@@ -2235,7 +2247,6 @@ namespace Js
             Assert(this->GetLoopHeaderArray() != nullptr);
             return this->GetLoopHeaderArray();
         }
-#ifndef TEMP_DISABLE_ASMJS
         void SetIsAsmJsFullJitScheduled(bool val){ m_isAsmJsScheduledForFullJIT = val; }
         bool GetIsAsmJsFullJitScheduled(){ return m_isAsmJsScheduledForFullJIT; }
         uint32 GetAsmJSTotalLoopCount() const
@@ -2247,14 +2258,12 @@ namespace Js
         {
             m_isAsmJsFunction = isAsmJsFunction;
         }
-#endif
 
         const bool GetIsAsmJsFunction() const
         {
             return m_isAsmJsFunction;
         }
 
-#ifndef TEMP_DISABLE_ASMJS
         bool IsHotAsmJsLoop()
         {
             // Negative MinTemplatizedJitLoopRunCount treats all loops as hot asm loop
@@ -2264,7 +2273,6 @@ namespace Js
             }
             return false;
         }
-#endif
 
     private:
         void ResetLoops();
@@ -2469,6 +2477,7 @@ namespace Js
         // Find out an offset falls within the range. returns TRUE if found.
         BOOL GetBranchOffsetWithin(uint start, uint end, StatementAdjustmentRecord* record);
         bool GetLineCharOffset(int byteCodeOffset, ULONG* line, LONG* charOffset, bool canAllocateLineCache = true);
+        int GetStartCharOfStatement(int byteCodeOffset);
         bool GetLineCharOffsetFromStartChar(int startCharOfStatement, ULONG* _line, LONG* _charOffset, bool canAllocateLineCache = true);
 
         // Given bytecode position, returns the start position of the statement and length of the statement.
@@ -2547,6 +2556,7 @@ namespace Js
         // Kind of entry point for original entry point
         BOOL IsInterpreterThunk() const;
         BOOL IsDynamicInterpreterThunk() const;
+        BOOL IsPerfMapInterpreterThunk() const;
         BOOL IsNativeOriginalEntryPoint() const;
         bool IsSimpleJitOriginalEntryPoint() const;
 
@@ -2569,6 +2579,8 @@ namespace Js
 
         bool GetHasNestedLoop() const { return hasNestedLoop; };
         void SetHasNestedLoop(bool nest) { hasNestedLoop = nest; };
+        bool GetHasLoopWithoutLoopBodyStart() const { return hasLoopWithoutLoopBodyStart; }
+        void SetHasLoopWithoutLoopBodyStart(bool has) { hasLoopWithoutLoopBodyStart = has; }
 
         bool IsInlineApplyDisabled();
         void InitDisableInlineApply();
@@ -2961,7 +2973,6 @@ namespace Js
         void SetLiteralRegexs(UnifiedRegex::RegexPattern ** literalRegexes) { this->SetAuxPtr(AuxPointerType::LiteralRegexes, literalRegexes); }
         UnifiedRegex::RegexPattern *GetLiteralRegex(const uint index);
         UnifiedRegex::RegexPattern *GetLiteralRegexWithLock(const uint index);
-#ifndef TEMP_DISABLE_ASMJS
         AsmJsFunctionInfo* GetAsmJsFunctionInfo()const { return static_cast<AsmJsFunctionInfo*>(this->GetAuxPtr(AuxPointerType::AsmJsFunctionInfo)); }
         AsmJsFunctionInfo* GetAsmJsFunctionInfoWithLock()const { return static_cast<AsmJsFunctionInfo*>(this->GetAuxPtrWithLock(AuxPointerType::AsmJsFunctionInfo)); }
         AsmJsFunctionInfo* AllocateAsmJsFunctionInfo();
@@ -2974,7 +2985,6 @@ namespace Js
         }
         bool IsAsmJSModule()const{ return this->GetAsmJsFunctionInfo() != nullptr; }
         AsmJsModuleInfo* AllocateAsmJsModuleInfo();
-#endif
         void SetLiteralRegex(const uint index, UnifiedRegex::RegexPattern *const pattern);
     private:
         void ResetLiteralRegexes();
@@ -3103,6 +3113,7 @@ namespace Js
         void SetEntryToDeferParseForDebugger();
         void ResetEntryPoint();
         void CleanupToReparse();
+        void CleanupByteCodeGenData();
         void AddDeferParseAttribute();
         void RemoveDeferParseAttribute();
 #if DBG
@@ -0,0 +1,627 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "Library/BoundFunction.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataList.h"
+#include "Library/JavascriptMap.h"
+#include "Library/JavascriptSet.h"
+#include "Base/HeapSnapshotWriter.h"
+
+#if ENABLE_HEAP_SNAPSHOT
+namespace Js
+{
+    // Longer names are cut; they are only there to be recognized.
+    static const charcount_t MaxNameLength = 1024;
+
+    HeapSnapshotWriter::HeapSnapshotWriter(ThreadContext *threadContext, ArenaAllocator *allocator, WriteCallback callback, void *callbackState) :
+        threadContext(threadContext),
+        recycler(threadContext->GetRecycler()),
+        allocator(allocator),
+        callback(callback),
+        callbackState(callbackState),
+        writeNodes(false),
+        nodeIds(allocator),
+        pendingNodes(allocator),
+        stringIds(allocator),
+        typeNames(allocator),
+        summary(allocator),
+        length(0)
+    {
+    }
+
+    HeapSnapshotWriter::~HeapSnapshotWriter()
+    {
+        Flush();
+    }
+
+    void HeapSnapshotWriter::Write(OutputFormat format)
+    {
+        this->writeNodes = (format == OutputFormat_Graph);
+
+        WriteBytes("CHHS", 4);
+        WriteUInt32(Version);
+
+        AddRoots();
+        while (!pendingNodes.Empty())
+        {
+            PendingNode node = pendingNodes.Pop();
+            uint32 typeId = GetTypeId(node);
+            uint32 nameId = GetNameId(node);
+            uint64 size = GetSize(node);
+
+            SummaryKey key = { typeId, nameId };
+            SummaryEntry *entry;
+            if (summary.TryGetReference(key, &entry))
+            {
+                entry->count++;
+                entry->size += size;
+            }
+            else
+            {
+                SummaryEntry newEntry = { 1, size };
+                summary.Add(key, newEntry);
+            }
+
+            if (writeNodes)
+            {
+                // Count the edges first, which also writes out the strings naming them, so the node record can go
+                // out in one piece.
+                uint32 edgeCount = 0;
+                ForEachEdge(node, [&](EdgeKind kind, uint32 nameOrIndex, void *target, bool isClosureScope)
+                {
+                    edgeCount++;
+                });
+
+                WriteByte(RecordKind_Node);
+                WriteUInt32(node.id);
+                WriteUInt32(typeId);
+                WriteUInt32(nameId);
+                WriteUInt64(size);
+                WriteUInt32(edgeCount);
+                ForEachEdge(node, [&](EdgeKind kind, uint32 nameOrIndex, void *target, bool isClosureScope)
+                {
+                    WriteByte(kind);
+                    WriteUInt32(nameOrIndex);
+                    WriteUInt32(GetOrAddNode(target, isClosureScope));
+                });
+            }
+            else
+            {
+                ForEachEdge(node, [&](EdgeKind kind, uint32 nameOrIndex, void *target, bool isClosureScope)
+                {
+                    GetOrAddNode(target, isClosureScope);
+                });
+            }
+        }
+
+        WriteSummary();
+        WriteByte(RecordKind_End);
+        Flush();
+    }
+
+    void HeapSnapshotWriter::AddRoots()
+    {
+        for (ScriptContext *scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+        {
+            if (!scriptContext->IsClosed() && scriptContext->GetGlobalObject() != nullptr)
+            {
+                GetOrAddNode(scriptContext->GetGlobalObject(), false);
+            }
+        }
+
+        // Values the host holds on to with JsAddRef are roots as well. The pinned set also has function bodies,
+        // property records and other engine allocations, so only take the ones typed by a live context's library.
+        recycler->MapPinnedObjects([&](void *obj)
+        {
+            if (IsPinnedScriptObject(obj) && IsNodeValue(obj))
+            {
+                GetOrAddNode(obj, false);
+            }
+        });
+    }
+
+    bool HeapSnapshotWriter::IsPinnedScriptObject(void *obj)
+    {
+        if (!recycler->IsValidObject(obj, sizeof(RecyclableObject)))
+        {
+            return false;
+        }
+
+        Type *type = static_cast<RecyclableObject *>(obj)->GetType();
+        if (type == nullptr || !recycler->IsValidObject(type, sizeof(Type)))
+        {
+            return false;
+        }
+
+        TypeId typeId = type->GetTypeId();
+        if (typeId <= TypeIds_Undefined || typeId >= TypeIds_Limit)
+        {
+            return false;
+        }
+
+        for (ScriptContext *scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+        {
+            if (!scriptContext->IsClosed() && scriptContext->GetLibrary() == type->GetLibrary())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32 HeapSnapshotWriter::GetOrAddNode(void *address, bool isClosureScope)
+    {
+        uint32 id;
+        if (nodeIds.TryGetValue(address, &id))
+        {
+            return id;
+        }
+
+        id = (uint32)nodeIds.Count() + 1;
+        nodeIds.Add(address, id);
+
+        PendingNode node = { address, id, isClosureScope };
+        pendingNodes.Push(node);
+        return id;
+    }
+
+    // Values worth a node: everything but numbers and the library's undefined, null and boolean singletons.
+    bool HeapSnapshotWriter::IsNodeValue(Var value)
+    {
+        if (value == nullptr || TaggedNumber::Is(value))
+        {
+            return false;
+        }
+
+        TypeId typeId = RecyclableObject::FromVar(value)->GetTypeId();
+        return typeId > TypeIds_Boolean && typeId != TypeIds_UndeclBlockVar;
+    }
+
+    template <typename Fn>
+    void HeapSnapshotWriter::ForEachEdge(const PendingNode &node, Fn fn)
+    {
+        if (node.isClosureScope)
+        {
+            ForEachClosureScopeEdge((Var *)node.address, fn);
+        }
+        else
+        {
+            ForEachObjectEdge((RecyclableObject *)node.address, fn);
+        }
+    }
+
+    template <typename Fn>
+    void HeapSnapshotWriter::ForEachObjectEdge(RecyclableObject *object, Fn fn)
+    {
+        RecyclableObject *prototype = object->GetType()->GetPrototype();
+        if (IsNodeValue(prototype))
+        {
+            fn(EdgeKind_Internal, GetStringId(_u("__proto__")), prototype, false);
+        }
+
+        TypeId typeId = object->GetTypeId();
+        if (!DynamicType::Is(typeId))
+        {
+            return;
+        }
+
+        // Read the slots through the type handler, so that neither getters nor proxy traps run.
+        DynamicObject *dynamicObject = DynamicObject::FromVar(object);
+        DynamicTypeHandler *typeHandler = dynamicObject->GetDynamicType()->GetTypeHandler();
+        ScriptContext *scriptContext = object->GetScriptContext();
+        bool isRootObject = RootObjectBase::Is(object);
+        int propertyCount = typeHandler->GetPropertyCount();
+        for (int i = 0; i < propertyCount; i++)
+        {
+            PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, (BigPropertyIndex)i);
+            if (propertyId == Constants::NoProperty)
+            {
+                continue;
+            }
+
+            // The root object's let and const globals are only found through the root property APIs.
+            PropertyIndex slotIndex = isRootObject ?
+                RootObjectBase::FromVar(object)->GetRootPropertyIndex(propertyId) :
+                typeHandler->GetPropertyIndex(scriptContext->GetPropertyName(propertyId));
+            if (slotIndex != Constants::NoSlot)
+            {
+                Var value = dynamicObject->GetSlot(slotIndex);
+                if (IsNodeValue(value))
+                {
+                    fn(EdgeKind_Property, GetPropertyNameId(scriptContext, propertyId), value, false);
+                }
+                continue;
+            }
+
+            Var getter = nullptr;
+            Var setter = nullptr;
+            if (typeHandler->GetAccessors(dynamicObject, propertyId, &getter, &setter))
+            {
+                if (IsNodeValue(getter))
+                {
+                    fn(EdgeKind_Property, GetPropertyNameId(scriptContext, propertyId), getter, false);
+                }
+                if (IsNodeValue(setter))
+                {
+                    fn(EdgeKind_Property, GetPropertyNameId(scriptContext, propertyId), setter, false);
+                }
+            }
+        }
+
+        if (!DynamicObject::IsAnyArray(object))
+        {
+            ArrayObject *objectArray = dynamicObject->GetObjectArray();
+            if (objectArray != nullptr)
+            {
+                fn(EdgeKind_Internal, GetStringId(_u("elements")), objectArray, false);
+            }
+        }
+
+        switch (typeId)
+        {
+        case TypeIds_Array:
+        case TypeIds_ES5Array:
+            {
+                JavascriptArray *array = JavascriptArray::FromVar(object);
+                for (SparseArraySegmentBase *segment = array->GetHead(); segment != nullptr; segment = segment->next)
+                {
+                    Var *elements = ((SparseArraySegment<Var> *)segment)->elements;
+                    for (uint32 i = 0; i < segment->length; i++)
+                    {
+                        if (!SparseArraySegment<Var>::IsMissingItem(&elements[i]) && IsNodeValue(elements[i]))
+                        {
+                            fn(EdgeKind_Element, segment->left + i, elements[i], false);
+                        }
+                    }
+                }
+            }
+            break;
+
+        case TypeIds_Function:
+            if (BoundFunction::Is(object))
+            {
+                BoundFunction *boundFunction = (BoundFunction *)object;
+                fn(EdgeKind_Internal, GetStringId(_u("target_function")), boundFunction->GetTargetFunction(), false);
+                Var *boundArgs = boundFunction->GetArgsForHeapEnum();
+                for (uint i = 0; i < boundFunction->GetArgsCountForHeapEnum(); i++)
+                {
+                    if (IsNodeValue(boundArgs[i]))
+                    {
+                        fn(EdgeKind_Internal, GetStringId(_u("bound_argument")), boundArgs[i], false);
+                    }
+                }
+            }
+            else if (ScriptFunction::Is(object))
+            {
+                FrameDisplay *environment = ScriptFunction::FromVar(object)->GetEnvironment();
+                for (uint16 i = 0; environment != nullptr && i < environment->GetLength(); i++)
+                {
+                    void *scope = environment->GetItem(i);
+                    if (scope == nullptr)
+                    {
+                        continue;
+                    }
+
+                    if (FrameDisplay::GetScopeType(scope) == ScopeType_SlotArray)
+                    {
+                        fn(EdgeKind_Internal, GetStringId(_u("context")), scope, true);
+                    }
+                    else if (IsNodeValue(scope))
+                    {
+                        fn(EdgeKind_Internal, GetStringId(_u("context")), scope, false);
+                    }
+                }
+            }
+            break;
+
+        case TypeIds_Map:
+            {
+                auto iterator = JavascriptMap::FromVar(object)->GetIterator();
+                while (iterator.Next())
+                {
+                    auto entry = iterator.Current();
+                    if (IsNodeValue(entry.Key()))
+                    {
+                        fn(EdgeKind_Internal, GetStringId(_u("key")), entry.Key(), false);
+                    }
+                    if (IsNodeValue(entry.Value()))
+                    {
+                        fn(EdgeKind_Internal, GetStringId(_u("value")), entry.Value(), false);
+                    }
+                }
+            }
+            break;
+
+        case TypeIds_Set:
+            {
+                auto iterator = JavascriptSet::FromVar(object)->GetIterator();
+                while (iterator.Next())
+                {
+                    if (IsNodeValue(iterator.Current()))
+                    {
+                        fn(EdgeKind_Internal, GetStringId(_u("value")), iterator.Current(), false);
+                    }
+                }
+            }
+            break;
+
+        default:
+            if ((typeId >= TypeIds_TypedArrayMin && typeId <= TypeIds_TypedArrayMax) || typeId == TypeIds_DataView)
+            {
+                ArrayBuffer *arrayBuffer = static_cast<ArrayBufferParent *>(object)->GetArrayBuffer();
+                if (arrayBuffer != nullptr)
+                {
+                    fn(EdgeKind_Internal, GetStringId(_u("buffer")), arrayBuffer, false);
+                }
+            }
+            break;
+        }
+    }
+
+    template <typename Fn>
+    void HeapSnapshotWriter::ForEachClosureScopeEdge(Var *slotArray, Fn fn)
+    {
+        ScopeSlots slots(slotArray);
+        uint count = slots.GetCount();
+
+        // Function scopes know the names of their variables, block scopes only have them in the debugger's metadata.
+        PropertyId *propertyIds = nullptr;
+        ScriptContext *scriptContext = nullptr;
+        if (slots.IsFunctionScopeSlotArray())
+        {
+            FunctionBody *functionBody = slots.GetFunctionBody();
+            if (functionBody->GetScopeSlotArraySize() >= count)
+            {
+                propertyIds = functionBody->GetPropertyIdsForScopeSlotArray();
+                scriptContext = functionBody->GetScriptContext();
+            }
+        }
+
+        for (uint i = 0; i < count; i++)
+        {
+            Var value = slots.Get(i);
+            if (!IsNodeValue(value))
+            {
+                continue;
+            }
+
+            if (propertyIds != nullptr && propertyIds[i] != Constants::NoProperty)
+            {
+                fn(EdgeKind_Property, GetPropertyNameId(scriptContext, propertyIds[i]), value, false);
+            }
+            else
+            {
+                fn(EdgeKind_Element, i, value, false);
+            }
+        }
+    }
+
+    uint32 HeapSnapshotWriter::GetTypeId(const PendingNode &node) const
+    {
+        return node.isClosureScope ? ClosureScopeTypeId : (uint32)((RecyclableObject *)node.address)->GetTypeId();
+    }
+
+    // Functions go by their own name and objects by the name of their constructor, when it is a script function;
+    // everything else by a name for its type id.
+    uint32 HeapSnapshotWriter::GetNameId(const PendingNode &node)
+    {
+        if (node.isClosureScope)
+        {
+            ScopeSlots slots((Var *)node.address);
+            return slots.IsFunctionScopeSlotArray() ?
+                GetStringId(slots.GetFunctionBody()->GetDisplayName()) :
+                GetStringId(_u("(block scope)"));
+        }
+
+        RecyclableObject *object = (RecyclableObject *)node.address;
+        if (ScriptFunction::Is(object))
+        {
+            return GetStringId(ScriptFunction::FromVar(object)->GetFunctionProxy()->GetDisplayName());
+        }
+
+        Type *type = object->GetType();
+        uint32 nameId;
+        if (typeNames.TryGetValue(type, &nameId))
+        {
+            return nameId;
+        }
+
+        const char16 *name = nullptr;
+        RecyclableObject *prototype = type->GetPrototype();
+        if (DynamicType::Is(object->GetTypeId()) && prototype != nullptr && DynamicType::Is(prototype->GetTypeId()))
+        {
+            DynamicObject *dynamicPrototype = DynamicObject::FromVar(prototype);
+            ScriptContext *scriptContext = prototype->GetScriptContext();
+            PropertyIndex slotIndex = dynamicPrototype->GetDynamicType()->GetTypeHandler()->GetPropertyIndex(
+                scriptContext->GetPropertyName(PropertyIds::constructor));
+            if (slotIndex != Constants::NoSlot)
+            {
+                Var constructor = dynamicPrototype->GetSlot(slotIndex);
+                if (ScriptFunction::Is(constructor))
+                {
+                    name = ScriptFunction::FromVar(constructor)->GetFunctionProxy()->GetDisplayName();
+                }
+            }
+        }
+
+        if (name == nullptr)
+        {
+            switch (object->GetTypeId())
+            {
+            case TypeIds_String: name = _u("(string)"); break;
+            case TypeIds_Symbol: name = _u("(symbol)"); break;
+            case TypeIds_Function: name = _u("(native function)"); break;
+            case TypeIds_Array:
+            case TypeIds_NativeIntArray:
+#if ENABLE_COPYONACCESS_ARRAY
+            case TypeIds_CopyOnAccessNativeIntArray:
+#endif
+            case TypeIds_NativeFloatArray:
+            case TypeIds_ES5Array: name = _u("Array"); break;
+            case TypeIds_ArrayBuffer: name = _u("ArrayBuffer"); break;
+            case TypeIds_Map: name = _u("Map"); break;
+            case TypeIds_Set: name = _u("Set"); break;
+            case TypeIds_WeakMap: name = _u("WeakMap"); break;
+            case TypeIds_WeakSet: name = _u("WeakSet"); break;
+            case TypeIds_Date: name = _u("Date"); break;
+            case TypeIds_RegEx: name = _u("RegExp"); break;
+            case TypeIds_Error: name = _u("Error"); break;
+            case TypeIds_Promise: name = _u("Promise"); break;
+            case TypeIds_Proxy: name = _u("Proxy"); break;
+            case TypeIds_Arguments: name = _u("Arguments"); break;
+            case TypeIds_GlobalObject: name = _u("(global)"); break;
+            case TypeIds_ActivationObject: name = _u("(activation)"); break;
+            default:
+                name = (object->GetTypeId() >= TypeIds_TypedArrayMin && object->GetTypeId() <= TypeIds_TypedArrayMax) ?
+                    _u("(typed array)") : _u("Object");
+                break;
+            }
+        }
+
+        nameId = GetStringId(name);
+        typeNames.Add(type, nameId);
+        return nameId;
+    }
+
+    uint64 HeapSnapshotWriter::GetSize(const PendingNode &node) const
+    {
+        uint64 size = GetAllocationSize(node.address);
+        if (node.isClosureScope)
+        {
+            return size;
+        }
+
+        RecyclableObject *object = (RecyclableObject *)node.address;
+        TypeId typeId = object->GetTypeId();
+        if (typeId == TypeIds_String)
+        {
+            // Unflattened strings have no buffer yet, and literals point into their source.
+            size += GetAllocationSize((void *)JavascriptString::FromVar(object)->UnsafeGetBuffer());
+        }
+        else if (DynamicType::Is(typeId))
+        {
+            size += GetAllocationSize(DynamicObject::FromVar(object)->auxSlots);
+            if (DynamicObject::IsAnyArray(object))
+            {
+                // The head segment may be allocated along with the array, which doesn't count as an allocation of its own.
+                for (SparseArraySegmentBase *segment = JavascriptArray::FromAnyArray(object)->GetHead(); segment != nullptr; segment = segment->next)
+                {
+                    size += GetAllocationSize(segment);
+                }
+            }
+            else if (typeId == TypeIds_ArrayBuffer)
+            {
+                size += ArrayBuffer::FromVar(object)->GetByteLength();
+            }
+        }
+        return size;
+    }
+
+    size_t HeapSnapshotWriter::GetAllocationSize(void *address) const
+    {
+        RecyclerHeapObjectInfo heapObject;
+        if (address == nullptr || !recycler->FindHeapObject(address, FindHeapObjectFlags_NoFlags, heapObject))
+        {
+            return 0;
+        }
+        return heapObject.GetSize();
+    }
+
+    uint32 HeapSnapshotWriter::GetStringId(const char16 *str)
+    {
+        return GetStringId(str, str == nullptr ? 0 : (charcount_t)wcslen(str));
+    }
+
+    uint32 HeapSnapshotWriter::GetStringId(const char16 *str, charcount_t strLength)
+    {
+        if (str == nullptr)
+        {
+            str = _u("");
+            strLength = 0;
+        }
+        strLength = min(strLength, MaxNameLength);
+
+        JsUtil::CharacterBuffer<char16> key(str, strLength);
+        uint32 id;
+        if (stringIds.TryGetValue(key, &id))
+        {
+            return id;
+        }
+
+        id = (uint32)stringIds.Count() + 1;
+        stringIds.Add(key, id);
+
+        utf8char_t *utf8 = AnewArray(allocator, utf8char_t, strLength * 3 + 1);
+        size_t utf8Length = utf8::EncodeIntoAndNullTerminate(utf8, str, strLength);
+        WriteByte(RecordKind_String);
+        WriteUInt32(id);
+        WriteUInt32((uint32)utf8Length);
+        WriteBytes(utf8, utf8Length);
+        AdeleteArray(allocator, strLength * 3 + 1, utf8);
+        return id;
+    }
+
+    uint32 HeapSnapshotWriter::GetPropertyNameId(ScriptContext *scriptContext, PropertyId propertyId)
+    {
+        const PropertyRecord *propertyRecord = scriptContext->GetPropertyName(propertyId);
+        return GetStringId(propertyRecord->GetBuffer(), propertyRecord->GetLength());
+    }
+
+    void HeapSnapshotWriter::WriteSummary()
+    {
+        summary.Map([&](SummaryKey key, SummaryEntry entry)
+        {
+            WriteByte(RecordKind_Summary);
+            WriteUInt32(key.typeId);
+            WriteUInt32(key.nameId);
+            WriteUInt64(entry.count);
+            WriteUInt64(entry.size);
+        });
+    }
+
+    void HeapSnapshotWriter::WriteByte(uint8 value)
+    {
+        WriteBytes(&value, sizeof(value));
+    }
+
+    void HeapSnapshotWriter::WriteUInt32(uint32 value)
+    {
+        WriteBytes(&value, sizeof(value));
+    }
+
+    void HeapSnapshotWriter::WriteUInt64(uint64 value)
+    {
+        WriteBytes(&value, sizeof(value));
+    }
+
+    void HeapSnapshotWriter::WriteBytes(const void *bytes, size_t count)
+    {
+        const byte *current = (const byte *)bytes;
+        while (count != 0)
+        {
+            if (length == sizeof(buffer))
+            {
+                Flush();
+            }
+
+            size_t chunk = min(count, sizeof(buffer) - length);
+            js_memcpy_s(buffer + length, sizeof(buffer) - length, current, chunk);
+            length += chunk;
+            current += chunk;
+            count -= chunk;
+        }
+    }
+
+    void HeapSnapshotWriter::Flush()
+    {
+        if (length != 0)
+        {
+            callback(callbackState, buffer, length);
+            length = 0;
+        }
+    }
+}
+#endif
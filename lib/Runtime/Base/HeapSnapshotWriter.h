@@ -0,0 +1,133 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_HEAP_SNAPSHOT
+namespace Js
+{
+    // Walks the script objects reachable from the global objects of a thread context's script contexts and streams
+    // them to the host as they are visited, each node followed by its outgoing edges, so the graph itself is never
+    // built. Only the set of visited objects and the stack of objects still to visit are kept, in an arena.
+    //
+    // The format is little endian binary: a "CHHS" magic, a uint32 version and a sequence of records, each starting
+    // with a RecordKind byte. Strings are numbered from 1 and written before the first record that refers to them;
+    // nodes are numbered from 1 in the order they are discovered, so edges can refer to nodes written later on.
+    //
+    // Sizes are shallow: the object's own allocation, its aux slots, array segments and array buffer contents.
+    // Retained sizes are left to the tools reading the graph.
+    class HeapSnapshotWriter
+    {
+    public:
+        enum OutputFormat
+        {
+            // Node and edge records, followed by the summary.
+            OutputFormat_Graph = 0,
+            // Only the summary records: instance count and size for each type id and name.
+            OutputFormat_Summary = 1
+        };
+
+        enum RecordKind : uint8
+        {
+            RecordKind_End = 0,
+            // uint32 id, uint32 byte length, UTF-8 bytes.
+            RecordKind_String = 1,
+            // uint32 id, uint32 type id, uint32 name string id, uint64 size, uint32 edge count, then for each edge
+            // uint8 edge kind, uint32 name string id or element index, uint32 target node id.
+            RecordKind_Node = 2,
+            // uint32 type id, uint32 name string id, uint64 instance count, uint64 size.
+            RecordKind_Summary = 3
+        };
+
+        enum EdgeKind : uint8
+        {
+            EdgeKind_Property = 0,
+            EdgeKind_Element = 1,
+            EdgeKind_Internal = 2
+        };
+
+        // The type id of the nodes standing for the variables a closure captured.
+        static const uint32 ClosureScopeTypeId = 0xFFFFFFFF;
+        static const uint32 Version = 1;
+
+        typedef void (CALLBACK *WriteCallback)(void *callbackState, const void *chunk, size_t length);
+
+        HeapSnapshotWriter(ThreadContext *threadContext, ArenaAllocator *allocator, WriteCallback callback, void *callbackState);
+        ~HeapSnapshotWriter();
+
+        void Write(OutputFormat format);
+
+    private:
+        struct PendingNode
+        {
+            void *address;
+            uint32 id;
+            bool isClosureScope;
+        };
+
+        struct SummaryKey
+        {
+            uint32 typeId;
+            uint32 nameId;
+
+            bool operator==(SummaryKey const& other) const { return typeId == other.typeId && nameId == other.nameId; }
+            operator hash_t() const { return (hash_t)(typeId * 31 + nameId); }
+        };
+
+        struct SummaryEntry
+        {
+            uint64 count;
+            uint64 size;
+        };
+
+        typedef JsUtil::BaseDictionary<JsUtil::CharacterBuffer<char16>, uint32, ArenaAllocator> StringIdMap;
+        typedef JsUtil::BaseDictionary<void *, uint32, ArenaAllocator> NodeIdMap;
+        typedef JsUtil::BaseDictionary<Type *, uint32, ArenaAllocator> TypeNameMap;
+        typedef JsUtil::BaseDictionary<SummaryKey, SummaryEntry, ArenaAllocator> SummaryMap;
+
+        void AddRoots();
+        bool IsPinnedScriptObject(void *obj);
+        uint32 GetOrAddNode(void *address, bool isClosureScope);
+        static bool IsNodeValue(Var value);
+
+        template <typename Fn> void ForEachEdge(const PendingNode &node, Fn fn);
+        template <typename Fn> void ForEachObjectEdge(RecyclableObject *object, Fn fn);
+        template <typename Fn> void ForEachClosureScopeEdge(Var *slotArray, Fn fn);
+
+        uint32 GetTypeId(const PendingNode &node) const;
+        uint32 GetNameId(const PendingNode &node);
+        uint64 GetSize(const PendingNode &node) const;
+        size_t GetAllocationSize(void *address) const;
+
+        uint32 GetStringId(const char16 *str);
+        uint32 GetStringId(const char16 *str, charcount_t length);
+        uint32 GetPropertyNameId(ScriptContext *scriptContext, PropertyId propertyId);
+
+        void WriteSummary();
+
+        void WriteByte(uint8 value);
+        void WriteUInt32(uint32 value);
+        void WriteUInt64(uint64 value);
+        void WriteBytes(const void *bytes, size_t length);
+        void Flush();
+
+    private:
+        ThreadContext *threadContext;
+        Recycler *recycler;
+        ArenaAllocator *allocator;
+        WriteCallback callback;
+        void *callbackState;
+        bool writeNodes;
+
+        NodeIdMap nodeIds;
+        JsUtil::Stack<PendingNode, ArenaAllocator> pendingNodes;
+        StringIdMap stringIds;
+        TypeNameMap typeNames;
+        SummaryMap summary;
+
+        byte buffer[4096];
+        size_t length;
+    };
+}
+#endif
@@ -0,0 +1,576 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "Language/JavascriptStackWalker.h"
+#include "Base/SamplingProfiler.h"
+
+#if ENABLE_SAMPLING_PROFILER
+namespace Js
+{
+    static const uint NodeBucketCount = SamplingProfiler::MaxNodeCount * 2;
+    static const uint FunctionBucketCount = SamplingProfiler::MaxFunctionCount * 2;
+    CompileAssert((NodeBucketCount & (NodeBucketCount - 1)) == 0 && (FunctionBucketCount & (FunctionBucketCount - 1)) == 0);
+
+    // Buffers the UTF-8 output and hands it to the host in chunks.
+    class SamplingProfiler::OutputWriter
+    {
+    public:
+        OutputWriter(WriteCallback callback, void *callbackState) :
+            callback(callback), callbackState(callbackState), length(0)
+        {
+        }
+
+        ~OutputWriter()
+        {
+            Flush();
+        }
+
+        void Write(const char *str)
+        {
+            for (; *str != '\0'; str++)
+            {
+                Reserve(1);
+                buffer[length++] = *str;
+            }
+        }
+
+        void WriteNumber(int64 value)
+        {
+            char str[24];
+            sprintf_s(str, _countof(str), "%lld", (long long)value);
+            Write(str);
+        }
+
+        // Writes a JSON string literal, or a collapsed stack frame when not quoting (';' separates frames there).
+        void WriteString(const char16 *str, bool quote)
+        {
+            if (quote)
+            {
+                Write("\"");
+            }
+
+            charcount_t remaining = str == nullptr ? 0 : (charcount_t)wcslen(str);
+            while (remaining != 0)
+            {
+                char16 ch = *str++;
+                remaining--;
+
+                Reserve(6);
+                if (ch < 0x20)
+                {
+                    if (quote)
+                    {
+                        static const char hexDigits[] = "0123456789abcdef";
+                        buffer[length++] = '\\';
+                        buffer[length++] = 'u';
+                        buffer[length++] = '0';
+                        buffer[length++] = '0';
+                        buffer[length++] = hexDigits[ch >> 4];
+                        buffer[length++] = hexDigits[ch & 0xf];
+                    }
+                    else
+                    {
+                        buffer[length++] = ' ';
+                    }
+                }
+                else if (quote && (ch == '"' || ch == '\\'))
+                {
+                    buffer[length++] = '\\';
+                    buffer[length++] = (char)ch;
+                }
+                else if (!quote && ch == ';')
+                {
+                    buffer[length++] = ',';
+                }
+                else
+                {
+                    LPUTF8 end = utf8::EncodeTrueUtf8(ch, &str, &remaining, (LPUTF8)buffer + length);
+                    length = (char *)end - buffer;
+                }
+            }
+
+            if (quote)
+            {
+                Write("\"");
+            }
+        }
+
+        void Flush()
+        {
+            if (length != 0)
+            {
+                callback(callbackState, buffer, length);
+                length = 0;
+            }
+        }
+
+    private:
+        void Reserve(size_t count)
+        {
+            if (length + count > _countof(buffer))
+            {
+                Flush();
+            }
+        }
+
+        WriteCallback callback;
+        void *callbackState;
+        char buffer[4096];
+        size_t length;
+    };
+
+    SamplingProfiler::SamplingProfiler(ThreadContext *threadContext, uint intervalMilliseconds) :
+        threadContext(threadContext),
+        intervalMilliseconds(max(intervalMilliseconds, 1u)),
+        timerThread(nullptr),
+        stopEvent(nullptr),
+        pendingTickCount(0),
+        nodes(nullptr),
+        nodeBuckets(nullptr),
+        nodeCount(1),
+        pinnedFunctions(nullptr),
+        pinnedFunctionCount(0),
+        tickCount(0),
+        droppedTickCount(0)
+    {
+        startTime.QuadPart = 0;
+        stopTime.QuadPart = 0;
+    }
+
+    SamplingProfiler::~SamplingProfiler()
+    {
+        Stop();
+
+        if (pinnedFunctions != nullptr)
+        {
+            threadContext->GetRecycler()->RootRelease(pinnedFunctions);
+            pinnedFunctions = nullptr;
+        }
+        if (nodeBuckets != nullptr)
+        {
+            HeapDeleteArray(NodeBucketCount, nodeBuckets);
+            nodeBuckets = nullptr;
+        }
+        if (nodes != nullptr)
+        {
+            HeapDeleteArray(MaxNodeCount, nodes);
+            nodes = nullptr;
+        }
+    }
+
+    SamplingProfiler * SamplingProfiler::New(ThreadContext *threadContext, uint intervalMilliseconds)
+    {
+        AutoPtr<SamplingProfiler> samplingProfiler(HeapNew(SamplingProfiler, threadContext, intervalMilliseconds));
+        samplingProfiler->InitializeAllocations();
+        return samplingProfiler.Detach();
+    }
+
+    void SamplingProfiler::Delete(SamplingProfiler *samplingProfiler)
+    {
+        HeapDelete(samplingProfiler);
+    }
+
+    void SamplingProfiler::InitializeAllocations()
+    {
+        nodes = HeapNewArrayZ(SampleNode, MaxNodeCount);
+        nodeBuckets = HeapNewArrayZ(uint, NodeBucketCount);
+
+        Recycler *recycler = threadContext->EnsureRecycler();
+        pinnedFunctions = RecyclerNewArrayZ(recycler, FunctionBody *, FunctionBucketCount);
+        recycler->RootAddRef(pinnedFunctions);
+    }
+
+    bool SamplingProfiler::Start()
+    {
+        Assert(timerThread == nullptr);
+
+        stopEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+        if (stopEvent == nullptr)
+        {
+            return false;
+        }
+
+        QueryPerformanceCounter(&startTime);
+        timerThread = reinterpret_cast<HANDLE>(_beginthreadex(NULL, 0, &SamplingProfiler::StaticThreadProc, this, 0, NULL));
+        if (timerThread == nullptr)
+        {
+            CloseHandle(stopEvent);
+            stopEvent = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    void SamplingProfiler::Stop()
+    {
+        if (timerThread == nullptr)
+        {
+            return;
+        }
+
+        SetEvent(stopEvent);
+        WaitForSingleObject(timerThread, INFINITE);
+        CloseHandle(timerThread);
+        CloseHandle(stopEvent);
+        timerThread = nullptr;
+        stopEvent = nullptr;
+
+        QueryPerformanceCounter(&stopTime);
+    }
+
+    unsigned int WINAPI SamplingProfiler::StaticThreadProc(void *lpParam)
+    {
+        static_cast<SamplingProfiler *>(lpParam)->ThreadProc();
+        return 0;
+    }
+
+    void SamplingProfiler::ThreadProc()
+    {
+        while (WaitForSingleObject(stopEvent, intervalMilliseconds) == WAIT_TIMEOUT)
+        {
+            if (threadContext->IsScriptActive())
+            {
+                // Count the tick first: the script thread may take the sample as soon as the limit is hammered.
+                InterlockedIncrement(&pendingTickCount);
+                threadContext->RequestSamplingProfilerSample();
+            }
+        }
+    }
+
+    void SamplingProfiler::TakeSample(ScriptContext *scriptContext, PVOID returnAddress)
+    {
+        uint ticks = (uint)InterlockedExchange(&pendingTickCount, 0);
+        if (ticks == 0)
+        {
+            return;
+        }
+
+        JavascriptStackWalker walker(scriptContext, true, returnAddress);
+        JavascriptFunction *function = nullptr;
+        uint node = 0;
+        uint depth = 0;
+        while (depth < MaxStackDepth && walker.GetDisplayCaller(&function))
+        {
+            FunctionBody *functionBody = function->GetFunctionBody();
+            if (functionBody == nullptr)
+            {
+                // A native library entry point (-LibraryStackFrame). Its time goes to the script that called it.
+                continue;
+            }
+
+            node = GetOrAddNode(node, functionBody, walker.GetByteCodeOffset());
+            if (node == 0)
+            {
+                droppedTickCount += ticks;
+                return;
+            }
+            depth++;
+        }
+
+        nodes[node].hitCount += ticks;
+        tickCount += ticks;
+    }
+
+    uint SamplingProfiler::GetOrAddNode(uint parent, FunctionBody *functionBody, uint byteCodeOffset)
+    {
+        uint hash = (uint)((size_t)functionBody >> 4) * 0x9E3779B1 ^ byteCodeOffset * 0x85EBCA6B ^ parent;
+        for (uint bucket = hash & (NodeBucketCount - 1); ; bucket = (bucket + 1) & (NodeBucketCount - 1))
+        {
+            uint node = nodeBuckets[bucket];
+            if (node == 0)
+            {
+                if (nodeCount == MaxNodeCount || !PinFunctionBody(functionBody))
+                {
+                    return 0;
+                }
+
+                node = nodeCount++;
+                nodes[node].functionBody = functionBody;
+                nodes[node].byteCodeOffset = byteCodeOffset;
+                nodes[node].startCharOfStatement = functionBody->GetStartCharOfStatement(byteCodeOffset);
+                nodes[node].parent = parent;
+                nodes[node].hitCount = 0;
+                nodeBuckets[bucket] = node;
+                return node;
+            }
+
+            if (nodes[node].functionBody == functionBody && nodes[node].byteCodeOffset == byteCodeOffset && nodes[node].parent == parent)
+            {
+                return node;
+            }
+        }
+    }
+
+    bool SamplingProfiler::PinFunctionBody(FunctionBody *functionBody)
+    {
+        uint hash = (uint)((size_t)functionBody >> 4) * 0x9E3779B1;
+        for (uint bucket = hash & (FunctionBucketCount - 1); ; bucket = (bucket + 1) & (FunctionBucketCount - 1))
+        {
+            if (pinnedFunctions[bucket] == functionBody)
+            {
+                return true;
+            }
+            if (pinnedFunctions[bucket] == nullptr)
+            {
+                if (pinnedFunctionCount == MaxFunctionCount)
+                {
+                    return false;
+                }
+                pinnedFunctions[bucket] = functionBody;
+                pinnedFunctionCount++;
+                return true;
+            }
+        }
+    }
+
+    // The functions of closed script contexts are still pinned, but their script context may be gone, so their
+    // lines are looked up without the help of the line offset cache.
+    static bool IsScriptContextAlive(ThreadContext *threadContext, ScriptContext *scriptContext)
+    {
+        for (ScriptContext *liveScriptContext = threadContext->GetScriptContextList(); liveScriptContext != nullptr; liveScriptContext = liveScriptContext->next)
+        {
+            if (liveScriptContext == scriptContext)
+            {
+                return !liveScriptContext->IsClosed();
+            }
+        }
+        return false;
+    }
+
+    static ULONG GetStatementLine(ThreadContext *threadContext, FunctionBody *functionBody, int startCharOfStatement)
+    {
+        ULONG line = functionBody->GetLineNumber();
+        if (!functionBody->GetUtf8SourceInfo()->GetIsLibraryCode())
+        {
+            bool canAllocateLineCache = IsScriptContextAlive(threadContext, functionBody->GetScriptContext());
+            functionBody->GetLineCharOffsetFromStartChar(startCharOfStatement, &line, nullptr, canAllocateLineCache);
+        }
+        return line;
+    }
+
+    void SamplingProfiler::Write(OutputFormat format, WriteCallback callback, void *callbackState)
+    {
+        Assert(timerThread == nullptr);
+
+        OutputWriter writer(callback, callbackState);
+        if (format == OutputFormat_CpuProfile)
+        {
+            WriteCpuProfile(writer);
+        }
+        else
+        {
+            WriteCollapsedStacks(writer);
+        }
+    }
+
+    void SamplingProfiler::WriteCollapsedStacks(OutputWriter &writer)
+    {
+        for (uint i = 0; i < nodeCount; i++)
+        {
+            if (nodes[i].hitCount == 0)
+            {
+                continue;
+            }
+
+            if (i == 0)
+            {
+                writer.Write("(program)");
+            }
+            for (uint node = i; node != 0; node = nodes[node].parent)
+            {
+                FunctionBody *functionBody = nodes[node].functionBody;
+                writer.WriteString(functionBody->GetExternalDisplayName(), false);
+                writer.Write(" (");
+                writer.WriteString(functionBody->GetSourceName(), false);
+                writer.Write(":");
+                writer.WriteNumber(GetStatementLine(threadContext, functionBody, nodes[node].startCharOfStatement) + 1);
+                writer.Write(nodes[node].parent != 0 ? ");" : ")");
+            }
+            writer.Write(" ");
+            writer.WriteNumber(nodes[i].hitCount);
+            writer.Write("\n");
+        }
+
+        if (droppedTickCount != 0)
+        {
+            writer.Write("(dropped) ");
+            writer.WriteNumber(droppedTickCount);
+            writer.Write("\n");
+        }
+    }
+
+    // DevTools' profile nodes are per function rather than per statement. The statement the sample was taken at is
+    // kept as a position tick, the way V8 reports line level hits. The profile doesn't keep the samples in the order
+    // they were taken, so they are written grouped by node and evenly spaced.
+    void SamplingProfiler::WriteCpuProfile(OutputWriter &writer)
+    {
+        struct PositionTick
+        {
+            ULONG line;
+            uint ticks;
+            PositionTick *next;
+        };
+
+        struct ProfileNode
+        {
+            FunctionBody *functionBody;
+            const char16 *name;
+            uint64 hitCount;
+            int firstChild;
+            int nextSibling;
+            PositionTick *positionTicks;
+        };
+
+        ArenaAllocator arena(_u("SamplingProfiler"), threadContext->GetPageAllocator(), Js::Throw::OutOfMemory);
+        JsUtil::List<ProfileNode, ArenaAllocator> profileNodes(&arena);
+
+        auto addNode = [&](int parent, FunctionBody *functionBody, const char16 *name) -> int
+        {
+            ProfileNode profileNode = { functionBody, name, 0, -1, -1, nullptr };
+            int index = profileNodes.Add(profileNode);
+            if (parent != -1)
+            {
+                profileNodes.Item(index).nextSibling = profileNodes.Item(parent).firstChild;
+                profileNodes.Item(parent).firstChild = index;
+            }
+            return index;
+        };
+
+        const int root = addNode(-1, nullptr, _u("(root)"));
+        if (nodes[0].hitCount != 0)
+        {
+            profileNodes.Item(addNode(root, nullptr, _u("(program)"))).hitCount = nodes[0].hitCount;
+        }
+        if (droppedTickCount != 0)
+        {
+            profileNodes.Item(addNode(root, nullptr, _u("(dropped)"))).hitCount = droppedTickCount;
+        }
+
+        for (uint i = 1; i < nodeCount; i++)
+        {
+            if (nodes[i].hitCount == 0)
+            {
+                continue;
+            }
+
+            int parent = root;
+            uint node;
+            for (node = i; ; node = nodes[node].parent)
+            {
+                FunctionBody *functionBody = nodes[node].functionBody;
+                int child;
+                for (child = profileNodes.Item(parent).firstChild; child != -1; child = profileNodes.Item(child).nextSibling)
+                {
+                    if (profileNodes.Item(child).functionBody == functionBody)
+                    {
+                        break;
+                    }
+                }
+                parent = child != -1 ? child : addNode(parent, functionBody, functionBody->GetExternalDisplayName());
+
+                if (nodes[node].parent == 0)
+                {
+                    break;
+                }
+            }
+
+            ProfileNode &leaf = profileNodes.Item(parent);
+            leaf.hitCount += nodes[i].hitCount;
+
+            ULONG line = GetStatementLine(threadContext, nodes[node].functionBody, nodes[node].startCharOfStatement) + 1;
+            PositionTick *positionTick;
+            for (positionTick = leaf.positionTicks; positionTick != nullptr && positionTick->line != line; positionTick = positionTick->next);
+            if (positionTick == nullptr)
+            {
+                positionTick = AnewStruct(&arena, PositionTick);
+                positionTick->line = line;
+                positionTick->ticks = 0;
+                positionTick->next = leaf.positionTicks;
+                leaf.positionTicks = positionTick;
+            }
+            positionTick->ticks += nodes[i].hitCount;
+        }
+
+        writer.Write("{\"nodes\":[");
+        for (int i = 0; i < profileNodes.Count(); i++)
+        {
+            const ProfileNode &profileNode = profileNodes.Item(i);
+            FunctionBody *functionBody = profileNode.functionBody;
+
+            writer.Write(i == 0 ? "{\"id\":" : ",{\"id\":");
+            writer.WriteNumber(i + 1);
+            writer.Write(",\"callFrame\":{\"functionName\":");
+            writer.WriteString(profileNode.name, true);
+            writer.Write(",\"scriptId\":\"");
+            writer.WriteNumber(functionBody != nullptr ? functionBody->GetUtf8SourceInfo()->GetSourceInfoId() : 0);
+            writer.Write("\",\"url\":");
+            writer.WriteString(functionBody != nullptr ? functionBody->GetSourceName() : _u(""), true);
+            writer.Write(",\"lineNumber\":");
+            writer.WriteNumber(functionBody != nullptr ? (int64)functionBody->GetLineNumber() : -1);
+            writer.Write(",\"columnNumber\":");
+            writer.WriteNumber(functionBody != nullptr ? (int64)functionBody->GetColumnNumber() : -1);
+            writer.Write("},\"hitCount\":");
+            writer.WriteNumber(profileNode.hitCount);
+
+            if (profileNode.firstChild != -1)
+            {
+                writer.Write(",\"children\":[");
+                for (int child = profileNode.firstChild; child != -1; child = profileNodes.Item(child).nextSibling)
+                {
+                    writer.Write(child == profileNode.firstChild ? "" : ",");
+                    writer.WriteNumber(child + 1);
+                }
+                writer.Write("]");
+            }
+
+            if (profileNode.positionTicks != nullptr)
+            {
+                writer.Write(",\"positionTicks\":[");
+                for (PositionTick *positionTick = profileNode.positionTicks; positionTick != nullptr; positionTick = positionTick->next)
+                {
+                    writer.Write(positionTick == profileNode.positionTicks ? "{\"line\":" : ",{\"line\":");
+                    writer.WriteNumber(positionTick->line);
+                    writer.Write(",\"ticks\":");
+                    writer.WriteNumber(positionTick->ticks);
+                    writer.Write("}");
+                }
+                writer.Write("]");
+            }
+            writer.Write("}");
+        }
+
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        int64 startMicroseconds = (int64)(startTime.QuadPart * 1000000.0 / frequency.QuadPart);
+        int64 stopMicroseconds = (int64)(stopTime.QuadPart * 1000000.0 / frequency.QuadPart);
+        int64 intervalMicroseconds = (int64)intervalMilliseconds * 1000;
+
+        writer.Write("],\"startTime\":");
+        writer.WriteNumber(startMicroseconds);
+        writer.Write(",\"endTime\":");
+        writer.WriteNumber(max(stopMicroseconds, startMicroseconds + (int64)(tickCount + droppedTickCount) * intervalMicroseconds));
+
+        writer.Write(",\"samples\":[");
+        bool first = true;
+        for (int i = 0; i < profileNodes.Count(); i++)
+        {
+            for (uint64 hit = 0; hit < profileNodes.Item(i).hitCount; hit++)
+            {
+                writer.Write(first ? "" : ",");
+                writer.WriteNumber(i + 1);
+                first = false;
+            }
+        }
+
+        writer.Write("],\"timeDeltas\":[");
+        for (uint64 tick = 0; tick < tickCount + droppedTickCount; tick++)
+        {
+            writer.Write(tick == 0 ? "" : ",");
+            writer.WriteNumber(intervalMicroseconds);
+        }
+        writer.Write("]}");
+    }
+}
+#endif
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_SAMPLING_PROFILER
+namespace Js
+{
+    // Statistical profiler for script frames. A timer thread asks for a sample every interval by hammering the
+    // thread's stack limit, the same way script interrupts are requested, and the next stack probe on the script
+    // thread (function entry, calls out, and loop headers in the interpreter) walks the stack into a call tree.
+    // Samples are thus taken at safepoints; a sample that had to wait for a probe is weighted with every tick that
+    // elapsed in the meantime, so the time still adds up. Ticks during which no script is running are not counted.
+    //
+    // Nothing is allocated while sampling. The call tree and the table pinning the sampled function bodies are
+    // sized when the profiler is created, and the ticks of samples that don't fit are only counted as dropped.
+    class SamplingProfiler
+    {
+    public:
+        enum OutputFormat
+        {
+            // One "outer;...;inner count" line per distinct stack, as flame graph tools expect.
+            OutputFormat_CollapsedStacks = 0,
+            // A .cpuprofile JSON document, as Chrome DevTools loads it.
+            OutputFormat_CpuProfile = 1
+        };
+
+        typedef void (CALLBACK *WriteCallback)(void *callbackState, const char *chunk, size_t length);
+
+        static const uint MaxNodeCount = 64 * 1024;
+        static const uint MaxFunctionCount = 16 * 1024;
+        static const uint MaxStackDepth = 1024;
+
+        SamplingProfiler(ThreadContext *threadContext, uint intervalMilliseconds);
+        ~SamplingProfiler();
+
+        static SamplingProfiler * New(ThreadContext *threadContext, uint intervalMilliseconds);
+        static void Delete(SamplingProfiler *samplingProfiler);
+
+        bool Start();
+        void Stop();
+
+        void TakeSample(ScriptContext *scriptContext, PVOID returnAddress);
+        void Write(OutputFormat format, WriteCallback callback, void *callbackState);
+
+    private:
+        struct SampleNode
+        {
+            FunctionBody *functionBody;
+            uint byteCodeOffset;
+            int startCharOfStatement;
+            // The tree is built from the sampled frame outwards, so the parent is the callee and hits land on the
+            // outermost frame of the sample. Following the parents from there yields the stack outermost first.
+            uint parent;
+            uint hitCount;
+        };
+
+        class OutputWriter;
+
+        void InitializeAllocations();
+
+        static unsigned int WINAPI StaticThreadProc(void *lpParam);
+        void ThreadProc();
+
+        uint GetOrAddNode(uint parent, FunctionBody *functionBody, uint byteCodeOffset);
+        bool PinFunctionBody(FunctionBody *functionBody);
+
+        void WriteCollapsedStacks(OutputWriter &writer);
+        void WriteCpuProfile(OutputWriter &writer);
+
+    private:
+        ThreadContext *threadContext;
+        uint intervalMilliseconds;
+        HANDLE timerThread;
+        HANDLE stopEvent;
+        volatile LONG pendingTickCount;
+
+        // Index 0 stands for "no script frame": its hits are the samples taken with only host frames on the stack.
+        SampleNode *nodes;
+        uint *nodeBuckets;
+        uint nodeCount;
+
+        // Open addressed set of the function bodies in the tree, allocated from the recycler and rooted so they
+        // are neither collected nor replaced at the same address while the profile refers to them.
+        FunctionBody **pinnedFunctions;
+        uint pinnedFunctionCount;
+
+        uint64 tickCount;
+        uint64 droppedTickCount;
+        LARGE_INTEGER startTime;
+        LARGE_INTEGER stopTime;
+    };
+}
+#endif
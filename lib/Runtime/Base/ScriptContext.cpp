@@ -25,7 +25,7 @@
 #include "Language/JavascriptStackWalker.h"
 #include "Language/AsmJsTypes.h"
 #include "Language/AsmJsModule.h"
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
 #include "Language/AsmJsEncoder.h"
 #include "Language/AsmJsCodeGenerator.h"
 #endif
@@ -64,6 +64,9 @@ namespace Js
 #if ENABLE_BACKGROUND_PARSING
         backgroundParser(nullptr),
 #endif
+#if ENABLE_PARALLEL_MODULE_PARSING
+        backgroundModuleParser(nullptr),
+#endif
 #if ENABLE_NATIVE_CODEGEN
         nativeCodeGen(nullptr),
 #endif
@@ -88,6 +91,7 @@ namespace Js
         isDiagnosticsScriptContext(false),
         m_enumerateNonUserFunctionsOnly(false),
         recycler(threadContext->EnsureRecycler()),
+        allocationAccountId(0),
         CurrentThunk(DefaultEntryThunk),
         CurrentCrossSiteThunk(CrossSite::DefaultThunk),
         DeferredParsingThunk(DefaultDeferredParsingThunk),
@@ -101,7 +105,7 @@ namespace Js
 #if DYNAMIC_INTERPRETER_THUNK
         interpreterThunkEmitter(nullptr),
 #endif
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
         asmJsInterpreterThunkEmitter(nullptr),
         asmJsCodeGenerator(nullptr),
 #endif
@@ -216,6 +220,7 @@ namespace Js
         convertPathToDictionaryCount3 = 0;
         convertPathToDictionaryCount4 = 0;
         convertPathToSimpleDictionaryCount = 0;
+        pathDeleteLastPropertyCount = 0;
         convertSimplePathToPathCount = 0;
         convertSimpleDictionaryToDictionaryCount = 0;
         convertSimpleSharedDictionaryToNonSharedCount = 0;
@@ -224,6 +229,7 @@ namespace Js
         pathTypeHandlerCount = 0;
         promoteCount = 0;
         cacheCount = 0;
+        assignTypeCopyCount = 0;
         branchCount = 0;
         maxPathLength = 0;
         memset(typeCount, 0, sizeof(typeCount));
@@ -259,6 +265,8 @@ namespace Js
         forinCache = 0;
         forinNoCache = 0;
 #endif
+        redeferredFunctionCount = 0;
+        redeferralReclaimedBytes = 0;
 
         callCount = 0;
 
@@ -454,6 +462,14 @@ namespace Js
         }
 #endif
 
+#if ENABLE_PARALLEL_MODULE_PARSING
+        if (this->backgroundModuleParser != nullptr)
+        {
+            BackgroundModuleParser::Delete(this->backgroundModuleParser);
+            this->backgroundModuleParser = nullptr;
+        }
+#endif
+
 #if ENABLE_NATIVE_CODEGEN
         if (this->nativeCodeGen != nullptr)
         {
@@ -470,7 +486,7 @@ namespace Js
         }
 #endif
 
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
         if (this->asmJsInterpreterThunkEmitter != nullptr)
         {
             HeapDelete(asmJsInterpreterThunkEmitter);
@@ -566,6 +582,12 @@ namespace Js
         }
 #endif
 
+        if (this->allocationAccountId != 0)
+        {
+            this->recycler->RemoveAllocationAccount(this->allocationAccountId);
+            this->allocationAccountId = 0;
+        }
+
 #if ENABLE_PROFILE_INFO
         HRESULT hr = S_OK;
         BEGIN_TRANSLATE_OOM_TO_HRESULT_NESTED
@@ -630,7 +652,7 @@ namespace Js
         }
 #endif
 
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
         if (this->asmJsInterpreterThunkEmitter != nullptr)
         {
             this->asmJsInterpreterThunkEmitter->Close();
@@ -781,7 +803,112 @@ namespace Js
 
     void ScriptContext::FindPropertyRecord(JavascriptString *pstName, PropertyRecord const ** propertyRecord)
     {
+        if (TryGetCachedPropertyRecord(pstName, propertyRecord))
+        {
+            return;
+        }
+
+        if (IsCachedMissingPropertyRecord(pstName))
+        {
+            *propertyRecord = nullptr;
+            return;
+        }
+
         threadContext->FindPropertyRecord(pstName, propertyRecord);
+        if (*propertyRecord != nullptr)
+        {
+            CachePropertyRecord(pstName, *propertyRecord);
+        }
+        else
+        {
+            CacheMissingPropertyRecord(pstName);
+        }
+    }
+
+    void ScriptContext::GetOrAddPropertyRecord(JavascriptString * propertyName, PropertyRecord const ** propertyRecord)
+    {
+        if (TryGetCachedPropertyRecord(propertyName, propertyRecord))
+        {
+            return;
+        }
+
+        GetOrAddPropertyRecord(propertyName->GetString(), propertyName->GetLength(), propertyRecord);
+        CachePropertyRecord(propertyName, *propertyRecord);
+    }
+
+    // Strings used as computed property names, like keys from JSON or string concatenation, are not PropertyStrings
+    // and don't know their property record. Remember the record of the last string at each slot of a small table
+    // indexed by the string's address, so that looking up the same string again doesn't hash it and search the
+    // thread's property map. The table references both, so neither can be collected and reused while cached. Only
+    // short names are cached, so that the table never keeps more than a small amount of string memory alive.
+    // A string without a record is cached as a miss, which holds only until the thread adds another record.
+    bool ScriptContext::TryGetCachedPropertyRecord(JavascriptString * propertyName, PropertyRecord const ** propertyRecord)
+    {
+        if (VirtualTableInfo<PropertyString>::HasVirtualTable(propertyName))
+        {
+            *propertyRecord = ((PropertyString *)propertyName)->GetPropertyRecord();
+            return true;
+        }
+
+        if (cache == nullptr)
+        {
+            return false;
+        }
+
+        Cache::PropertyRecordCacheEntry const& entry =
+            cache->propertyRecordCache[(((uintptr_t)propertyName) >> 4) & (Cache::PropertyRecordCacheSize - 1)];
+        if (entry.propertyName == propertyName && entry.propertyRecord != nullptr)
+        {
+            *propertyRecord = entry.propertyRecord;
+            return true;
+        }
+        return false;
+    }
+
+    bool ScriptContext::IsCachedMissingPropertyRecord(JavascriptString * propertyName)
+    {
+        if (cache == nullptr)
+        {
+            return false;
+        }
+
+        Cache::PropertyRecordCacheEntry const& entry =
+            cache->propertyRecordCache[(((uintptr_t)propertyName) >> 4) & (Cache::PropertyRecordCacheSize - 1)];
+        return entry.propertyName == propertyName && entry.propertyRecord == nullptr &&
+            entry.propertyRecordAddCount == threadContext->GetPropertyRecordAddCount();
+    }
+
+    void ScriptContext::CachePropertyRecord(JavascriptString * propertyName, PropertyRecord const * propertyRecord)
+    {
+        Assert(propertyRecord != nullptr);
+        Assert(propertyName->GetLength() == propertyRecord->GetLength() &&
+            JsUtil::CharacterBuffer<WCHAR>::StaticEquals(propertyName->GetString(), propertyRecord->GetBuffer(), propertyName->GetLength()));
+
+        if (cache == nullptr || propertyName->GetLength() > Cache::PropertyRecordCacheMaxNameLength)
+        {
+            return;
+        }
+
+        Cache::PropertyRecordCacheEntry& entry =
+            cache->propertyRecordCache[(((uintptr_t)propertyName) >> 4) & (Cache::PropertyRecordCacheSize - 1)];
+        entry.propertyName = propertyName;
+        entry.propertyRecord = propertyRecord;
+    }
+
+    void ScriptContext::CacheMissingPropertyRecord(JavascriptString * propertyName)
+    {
+        Assert(!VirtualTableInfo<PropertyString>::HasVirtualTable(propertyName));
+
+        if (cache == nullptr || propertyName->GetLength() > Cache::PropertyRecordCacheMaxNameLength)
+        {
+            return;
+        }
+
+        Cache::PropertyRecordCacheEntry& entry =
+            cache->propertyRecordCache[(((uintptr_t)propertyName) >> 4) & (Cache::PropertyRecordCacheSize - 1)];
+        entry.propertyName = propertyName;
+        entry.propertyRecord = nullptr;
+        entry.propertyRecordAddCount = threadContext->GetPropertyRecordAddCount();
     }
 
     void ScriptContext::FindPropertyRecord(__in LPCWSTR propertyName, __in int propertyNameLength, PropertyRecord const ** propertyRecord)
@@ -902,12 +1029,14 @@ namespace Js
         Output::Print(_u("    Path to SimpleMap (delete)     %8d\n"), convertPathToDictionaryCount2);
         Output::Print(_u("    Path to SimpleMap (attribute)  %8d\n"), convertPathToDictionaryCount3);
         Output::Print(_u("    Path to SimpleMap              %8d\n"), convertPathToSimpleDictionaryCount);
+        Output::Print(_u("    Path back to predecessor       %8d\n"), pathDeleteLastPropertyCount);
         Output::Print(_u("    SimplePath to Path             %8d\n"), convertSimplePathToPathCount);
         Output::Print(_u("    Shared SimpleMap to non-shared %8d\n"), convertSimpleSharedDictionaryToNonSharedCount);
         Output::Print(_u("    Deferred to Map                %8d\n"), convertDeferredToDictionaryCount);
         Output::Print(_u("    Path to Map (accessor)         %8d\n"), convertPathToDictionaryCount4);
         Output::Print(_u("    SimpleMap to Map               %8d\n"), convertSimpleDictionaryToDictionaryCount);
         Output::Print(_u("    Path Cache Hits                %8d\n"), cacheCount);
+        Output::Print(_u("    Path Types Copied by assign    %8d\n"), assignTypeCopyCount);
         Output::Print(_u("    Path Branches                  %8d\n"), branchCount);
         Output::Print(_u("    Path Promotions                %8d\n"), promoteCount);
         Output::Print(_u("    Path Length (max)              %8d\n"), maxPathLength);
@@ -1141,6 +1270,13 @@ namespace Js
         }
 #endif
 
+#if ENABLE_PARALLEL_MODULE_PARSING
+        if (PHASE_ON1(Js::ParallelModuleParsePhase))
+        {
+            this->backgroundModuleParser = BackgroundModuleParser::New(this);
+        }
+#endif
+
 #if ENABLE_NATIVE_CODEGEN
         // Create the native code gen before the profiler
         this->nativeCodeGen = NewNativeCodeGenerator(this);
@@ -1159,11 +1295,28 @@ namespace Js
     {
         SmartFPUControl defaultControl;
 
+        // Don't charge the new context's library to whichever context is current.
+        uint previousAllocationAccountId = this->recycler->GetCurrentAllocationAccount();
+        this->recycler->SetCurrentAllocationAccount(this->allocationAccountId);
+
         InitializePreGlobal();
 
         InitializeGlobalObject();
 
         InitializePostGlobal();
+
+        this->recycler->SetCurrentAllocationAccount(previousAllocationAccountId);
+    }
+
+    // Accounting is opt-in: the context only gets a recycler allocation account, and is only charged for what it
+    // allocates, once the host first asks about its memory.
+    uint ScriptContext::EnsureAllocationAccount()
+    {
+        if (this->allocationAccountId == 0)
+        {
+            this->allocationAccountId = this->recycler->AddAllocationAccount();
+        }
+        return this->allocationAccountId;
     }
 
     void ScriptContext::InitializePostGlobal()
@@ -1191,7 +1344,7 @@ if (!sourceList)
         interpreterThunkEmitter = HeapNew(InterpreterThunkEmitter, SourceCodeAllocator(), this->GetThreadContext()->GetThunkPageAllocators());
 #endif
 
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
         asmJsInterpreterThunkEmitter = HeapNew(InterpreterThunkEmitter, SourceCodeAllocator(), this->GetThreadContext()->GetThunkPageAllocators(),
             true);
 #endif
@@ -1214,7 +1367,7 @@ if (!sourceList)
     }
 
 
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
     AsmJsCodeGenerator* ScriptContext::InitAsmJsCodeGenerator()
     {
         if( !asmJsCodeGenerator )
@@ -1680,6 +1833,42 @@ if (!sourceList)
         // Invoke the parser, passing in the global function name, which we will then run to execute
         // the script.
         // TODO: yongqu handle non-global code.
+        ULONG grfscr = this->GetParseFlags(loadScriptFlag, length, sourceContextInfo);
+
+        ParseNodePtr parseTree;
+        if((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source)
+        {
+            hr = parser->ParseUtf8Source(&parseTree, script, cb, grfscr, pse, &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
+        }
+        else
+        {
+            hr = parser->ParseCesu8Source(&parseTree, utf8Script, cbNeeded, grfscr, pse, &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
+        }
+
+        if(FAILED(hr) || parseTree == nullptr)
+        {
+            return nullptr;
+        }
+
+        (*ppSourceInfo)->SetParseFlags(grfscr);
+
+        //Make sure we have the body and text information available
+        if ((loadScriptFlag & LoadScriptFlag_Utf8Source) != LoadScriptFlag_Utf8Source)
+        {
+            *sourceIndex = this->SaveSourceNoCopy(*ppSourceInfo, static_cast<charcount_t>((*ppSourceInfo)->GetCchLength()), /*isCesu8*/ true);
+        }
+        else
+        {
+            // Update the length.
+            (*ppSourceInfo)->SetCchLength(parser->GetSourceIchLim());
+            *sourceIndex = this->SaveSourceNoCopy(*ppSourceInfo, parser->GetSourceIchLim(), /* isCesu8*/ false);
+        }
+
+        return parseTree;
+    }
+
+    ULONG ScriptContext::GetParseFlags(LoadScriptFlag loadScriptFlag, size_t length, SourceContextInfo * sourceContextInfo)
+    {
         ULONG grfscr = fscrGlobalCode | ((loadScriptFlag & LoadScriptFlag_Expression) == LoadScriptFlag_Expression ? fscrReturnExpression : 0);
         if(((loadScriptFlag & LoadScriptFlag_disableDeferredParse) != LoadScriptFlag_disableDeferredParse) &&
             (length > Parser::GetDeferralThreshold(sourceContextInfo->IsSourceProfileLoaded())))
@@ -1709,41 +1898,12 @@ if (!sourceList)
             grfscr |= fscrIsModuleCode;
         }
 
-        if (isLibraryCode)
+        if ((loadScriptFlag & LoadScriptFlag_LibraryCode) == LoadScriptFlag_LibraryCode)
         {
             grfscr |= fscrIsLibraryCode;
         }
 
-        ParseNodePtr parseTree;
-        if((loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source)
-        {
-            hr = parser->ParseUtf8Source(&parseTree, script, cb, grfscr, pse, &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
-        }
-        else
-        {
-            hr = parser->ParseCesu8Source(&parseTree, utf8Script, cbNeeded, grfscr, pse, &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
-        }
-
-        if(FAILED(hr) || parseTree == nullptr)
-        {
-            return nullptr;
-        }
-
-        (*ppSourceInfo)->SetParseFlags(grfscr);
-
-        //Make sure we have the body and text information available
-        if ((loadScriptFlag & LoadScriptFlag_Utf8Source) != LoadScriptFlag_Utf8Source)
-        {
-            *sourceIndex = this->SaveSourceNoCopy(*ppSourceInfo, static_cast<charcount_t>((*ppSourceInfo)->GetCchLength()), /*isCesu8*/ true);
-        }
-        else
-        {
-            // Update the length.
-            (*ppSourceInfo)->SetCchLength(parser->GetSourceIchLim());
-            *sourceIndex = this->SaveSourceNoCopy(*ppSourceInfo, parser->GetSourceIchLim(), /* isCesu8*/ false);
-        }
-
-        return parseTree;
+        return grfscr;
     }
 
     JavascriptFunction* ScriptContext::LoadScript(const byte* script, size_t cb, SRCINFO const * pSrcInfo, CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo, const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag)
@@ -4291,20 +4451,28 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
         registeredPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesScriptContext = nullptr;
     }
 
-    JavascriptString * ScriptContext::GetLastNumberToStringRadix10(double value)
+    static uint GetNumberToStringCacheIndex(double value)
+    {
+        uint64 bits = NumberUtilities::ToSpecial(value);
+        uint hash = (uint)bits ^ (uint)(bits >> 32);
+        return (hash ^ (hash >> 16)) & (Cache::NumberToStringCacheSize - 1);
+    }
+
+    JavascriptString * ScriptContext::GetCachedNumberToStringRadix10(double value)
     {
-        if (value == lastNumberToStringRadix10)
+        Cache::NumberToStringCacheEntry const& entry = cache->numberToStringRadix10Cache[GetNumberToStringCacheIndex(value)];
+        if (entry.string != nullptr && entry.value == value)
         {
-            return cache->lastNumberToStringRadix10String;
+            return entry.string;
         }
         return nullptr;
     }
 
-    void
-        ScriptContext::SetLastNumberToStringRadix10(double value, JavascriptString * str)
+    void ScriptContext::CacheNumberToStringRadix10(double value, JavascriptString * str)
     {
-            lastNumberToStringRadix10 = value;
-            cache->lastNumberToStringRadix10String = str;
+        Cache::NumberToStringCacheEntry& entry = cache->numberToStringRadix10Cache[GetNumberToStringCacheIndex(value)];
+        entry.value = value;
+        entry.string = str;
     }
 
     bool ScriptContext::GetLastUtcTimeFromStr(JavascriptString * str, double& dbl)
@@ -4733,6 +4901,12 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
 
 #endif
 
+        if (PHASE_STATS1(Js::RedeferralPhase))
+        {
+            Output::Print(_u("Redeferral: %u functions redeferred, %u bytes of byte code released\n"),
+                redeferredFunctionCount, (uint)redeferralReclaimedBytes);
+        }
+
 #if ENABLE_NATIVE_CODEGEN
 #ifdef BGJIT_STATS
         // We do not care about small script contexts without much activity - unless t
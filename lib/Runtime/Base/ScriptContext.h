@@ -32,6 +32,7 @@ namespace Js
     struct HaltCallback;
     struct DebuggerOptionsCallback;
     class ModuleRecordBase;
+    class BackgroundModuleParser;
 }
 
 // Created for every source buffer passed by host.
@@ -365,7 +366,6 @@ namespace Js
         virtual void Dispose(bool isShutdown) override {}
         virtual void Mark(Recycler *recycler) override { AssertMsg(false, "Mark called on object that isn't TrackableObject"); }
 
-        JavascriptString * lastNumberToStringRadix10String;
         EnumeratedObjectCache enumObjCache;
         JavascriptString * lastUtcTimeFromStrString;
         EvalCacheDictionary* evalCacheDictionary;
@@ -378,6 +378,26 @@ namespace Js
         SRCINFO* noContextGlobalSourceInfo;
         SRCINFO const ** moduleSrcInfo;
         BuiltInLibraryFunctionMap* builtInLibraryFunctions;
+
+        // Property records of the strings last used as property names, indexed by the string's address
+        static const uint PropertyRecordCacheSize = 256;
+        static const charcount_t PropertyRecordCacheMaxNameLength = 64;
+        struct PropertyRecordCacheEntry
+        {
+            JavascriptString * propertyName;
+            PropertyRecord const * propertyRecord;  // nullptr if the name had no property record
+            uint propertyRecordAddCount;            // Thread's count of added property records when a miss was cached
+        };
+        PropertyRecordCacheEntry propertyRecordCache[PropertyRecordCacheSize];
+
+        // Strings of the doubles last converted with radix 10, indexed by a hash of the value
+        static const uint NumberToStringCacheSize = 64;
+        struct NumberToStringCacheEntry
+        {
+            double value;
+            JavascriptString * string;
+        };
+        NumberToStringCacheEntry numberToStringRadix10Cache[NumberToStringCacheSize];
     };
 
     class ScriptContext : public ScriptContextBase
@@ -480,7 +500,7 @@ namespace Js
             }
         }
 
-#ifdef ASMJS_PLAT
+#if defined(ASMJS_PLAT) && ENABLE_NATIVE_CODEGEN
         inline AsmJsCodeGenerator* GetAsmJsCodeGenerator() const{return asmJsCodeGenerator;}
         AsmJsCodeGenerator* InitAsmJsCodeGenerator();
 #endif
@@ -581,6 +601,7 @@ public:
         int convertPathToDictionaryCount3;
         int convertPathToDictionaryCount4;
         int convertPathToSimpleDictionaryCount;
+        int pathDeleteLastPropertyCount;
         int convertSimplePathToPathCount;
         int convertSimpleDictionaryToDictionaryCount;
         int convertSimpleSharedDictionaryToNonSharedCount;
@@ -589,6 +610,7 @@ public:
         int pathTypeHandlerCount;
         int promoteCount;
         int cacheCount;
+        int assignTypeCopyCount;
         int branchCount;
         int maxPathLength;
         int typeCount[TypeIds_Limit];
@@ -631,6 +653,9 @@ public:
         uint funcJitCodeUsed;
         uint speculativeJitCount;
 #endif
+        // Functions whose byte code was released by the GC-time redeferral pass, and the bytes that released
+        uint redeferredFunctionCount;
+        size_t redeferralReclaimedBytes;
 
 #ifdef REJIT_STATS
         // Used to store bailout stats
@@ -740,6 +765,7 @@ private:
 
         JsUtil::Stack<Var>* operationStack;
         Recycler* recycler;
+        uint allocationAccountId;
         RecyclerJavascriptNumberAllocator numberAllocator;
 
         ScriptConfiguration config;
@@ -754,12 +780,17 @@ private:
 #ifdef ASMJS_PLAT
         InterpreterThunkEmitter* asmJsInterpreterThunkEmitter;
         AsmJsCodeGenerator* asmJsCodeGenerator;
+#endif
+        NativeCodeGenerator* nativeCodeGen;
+#endif
+#if ENABLE_PARALLEL_MODULE_PARSING
+        BackgroundModuleParser *backgroundModuleParser;
+#endif
+#ifdef ASMJS_PLAT
         typedef JsUtil::BaseDictionary<void *, SList<AsmJsScriptFunction *>*, ArenaAllocator> AsmFunctionMap;
         AsmFunctionMap* asmJsEnvironmentMap;
         ArenaAllocator* debugTransitionAlloc;
 #endif
-        NativeCodeGenerator* nativeCodeGen;
-#endif
 
         DateTime::DaylightTimeHelper daylightTimeHelper;
         DateTime::Utility dateTimeUtility;
@@ -786,7 +817,6 @@ private:
 
         JsUtil::BaseDictionary<uint, JavascriptString *, ArenaAllocator> integerStringMap;
 
-        double lastNumberToStringRadix10;
         double lastUtcTimeFromStr;
 
 #if ENABLE_PROFILE_INFO
@@ -903,6 +933,9 @@ private:
         bool IsFinalized() const { return isFinalized; }
         void SetIsFinalized() { isFinalized = true; }
         bool IsActuallyClosed() const { return isScriptContextActuallyClosed; }
+        // The recycler allocation account charged while this context is current, 0 until EnsureAllocationAccount.
+        uint GetAllocationAccountId() const { return allocationAccountId; }
+        uint EnsureAllocationAccount();
 #if ENABLE_NATIVE_CODEGEN
         bool IsClosedNativeCodeGenerator() const
         {
@@ -1236,6 +1269,11 @@ private:
         JsUtil::List<const RecyclerWeakReference<Js::PropertyRecord const>*>* FindPropertyIdNoCase(__in LPCWSTR pszPropertyName, __in int propertyNameLength);
 
         void FindPropertyRecord(JavascriptString* pstName, PropertyRecord const** propertyRecord);
+        void GetOrAddPropertyRecord(JavascriptString* propertyName, PropertyRecord const** propertyRecord);
+        bool TryGetCachedPropertyRecord(JavascriptString* propertyName, PropertyRecord const** propertyRecord);
+        void CachePropertyRecord(JavascriptString* propertyName, PropertyRecord const* propertyRecord);
+        bool IsCachedMissingPropertyRecord(JavascriptString* propertyName);
+        void CacheMissingPropertyRecord(JavascriptString* propertyName);
         PropertyRecord const * GetPropertyName(PropertyId propertyId);
         PropertyRecord const * GetPropertyNameLocked(PropertyId propertyId);
         void GetOrAddPropertyRecord(JsUtil::CharacterBuffer<WCHAR> const& propName, PropertyRecord const** propertyRecord);
@@ -1264,6 +1302,7 @@ private:
 
         ParseNodePtr ParseScript(Parser* parser, const byte* script, size_t cb, SRCINFO const * pSrcInfo,
             CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo, const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag, uint* sourceIndex);
+        ULONG GetParseFlags(LoadScriptFlag loadScriptFlag, size_t length, SourceContextInfo * sourceContextInfo);
         JavascriptFunction* LoadScript(const byte* script, size_t cb, SRCINFO const * pSrcInfo,
             CompileScriptException * pse, Utf8SourceInfo** ppSourceInfo, const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag);
 
@@ -1312,6 +1351,9 @@ private:
 #if ENABLE_BACKGROUND_PARSING
         BackgroundParser * GetBackgroundParser() const { return backgroundParser; }
 #endif
+#if ENABLE_PARALLEL_MODULE_PARSING
+        BackgroundModuleParser * GetBackgroundModuleParser() const { return backgroundModuleParser; }
+#endif
 
         void OnScriptStart(bool isRoot, bool isScript);
         void OnScriptEnd(bool isRoot, bool isForcedEnd);
@@ -1477,8 +1519,8 @@ private:
         void ClearPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesCaches();
 
     public:
-        JavascriptString * GetLastNumberToStringRadix10(double value);
-        void SetLastNumberToStringRadix10(double value, JavascriptString * str);
+        JavascriptString * GetCachedNumberToStringRadix10(double value);
+        void CacheNumberToStringRadix10(double value, JavascriptString * str);
         bool GetLastUtcTimeFromStr(JavascriptString * str, double& dbl);
         void SetLastUtcTimeFromStr(JavascriptString * str, double value);
         bool IsNoContextSourceContextInfo(SourceContextInfo *sourceContextInfo) const
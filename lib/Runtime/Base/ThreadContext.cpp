@@ -22,6 +22,8 @@
 #include "Language/InterpreterStackFrame.h"
 #include "Language/JavascriptStackWalker.h"
 #include "Base/ScriptMemoryDumper.h"
+#include "Base/SamplingProfiler.h"
+#include "Language/PerfMapInterpreterThunkEmitter.h"
 
 // SIMD_JS
 #include "Library/SimdLib.h"
@@ -126,11 +128,19 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     jobProcessor(nullptr),
 #endif
     interruptPoller(nullptr),
+#if ENABLE_SAMPLING_PROFILER
+    samplingProfiler(nullptr),
+#endif
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+    perfMapInterpreterThunkEmitter(nullptr),
+#endif
     expirableCollectModeGcCount(-1),
     expirableObjectList(nullptr),
     expirableObjectDisposeList(nullptr),
     numExpirableObjects(0),
     disableExpiration(false),
+    isRedeferring(false),
+    enteringInterpreterFunction(nullptr),
     callRootLevel(0),
     nextTypeId((Js::TypeId)Js::Constants::ReservedTypeIds),
     entryExitRecord(nullptr),
@@ -186,6 +196,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     wellKnownHostTypeHTMLAllCollectionTypeId(Js::TypeIds_Undefined),
     isProfilingUserCode(true),
     loopDepth(0),
+    threadStatistics(),
     maxGlobalFunctionExecTime(0.0),
     isAllJITCodeInPreReservedRegion(true),
     tridentLoadAddress(nullptr),
@@ -209,6 +220,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 
     functionCount = 0;
     sourceInfoCount = 0;
+    propertyRecordAddCount = 0;
     scriptContextCount=0;
 
     isScriptActive = false;
@@ -349,6 +361,14 @@ ThreadContext::~ThreadContext()
     }
 #endif
 
+#if ENABLE_SAMPLING_PROFILER
+    if (this->samplingProfiler != nullptr)
+    {
+        Js::SamplingProfiler::Delete(this->samplingProfiler);
+        this->samplingProfiler = nullptr;
+    }
+#endif
+
 #ifdef LEAK_REPORT
     if (Js::Configuration::Global.flags.IsEnabled(Js::LeakReportFlag))
     {
@@ -463,6 +483,16 @@ ThreadContext::~ThreadContext()
     }
 #endif
 
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+    // Function bodies point at the thunks until the recycler is gone. Deleting the emitter unregisters the blocks'
+    // unwind info and releases their pages.
+    if (this->perfMapInterpreterThunkEmitter != nullptr)
+    {
+        Js::PerfMapInterpreterThunkEmitter::Delete(this->perfMapInterpreterThunkEmitter);
+        this->perfMapInterpreterThunkEmitter = nullptr;
+    }
+#endif
+
     // Do not require all GC callbacks to be revoked, because Trident may not revoke if there
     // is a leak, and we don't want the leak to be masked by an assert
 
@@ -1008,6 +1038,7 @@ ThreadContext::AddPropertyRecordInternal(const Js::PropertyRecord * propertyReco
 
     // Add to the map
     propertyMap->Add(propertyRecord);
+    propertyRecordAddCount++;
 
     PropertyRecordTrace(_u("Added property '%s' at 0x%08x, pid = %d\n"), propertyName, propertyRecord, propertyId);
 
@@ -1498,6 +1529,7 @@ ThreadContext::IsOnStack(void const *ptr)
     FAULTINJECT_SCRIPT_TERMINATION;
     PBYTE limit = this->stackLimitForCurrentThread;
     Assert(limit == Js::Constants::StackLimitForScriptInterrupt
+        || limit == Js::Constants::StackLimitForSamplingInterrupt
         || !this->GetStackProber()
         || limit == this->GetStackProber()->GetScriptStackLimit());
     return limit;
@@ -1510,7 +1542,7 @@ ThreadContext::SetStackLimitForCurrentThread(PBYTE limit)
 
 _NOINLINE //Win8 947081: might use wrong _AddressOfReturnAddress() if this and caller are inlined
 bool
-ThreadContext::IsStackAvailable(size_t size)
+ThreadContext::IsStackAvailable(size_t size, bool *isSampleRequested)
 {
     PBYTE sp = (PBYTE)_AddressOfReturnAddress();
     PBYTE stackLimit = this->GetStackLimitForCurrentThread();
@@ -1529,6 +1561,21 @@ ThreadContext::IsStackAvailable(size_t size)
         return true;
     }
 
+#if ENABLE_SAMPLING_PROFILER
+    if (stackLimit == Js::Constants::StackLimitForSamplingInterrupt)
+    {
+        // The sampling profiler hammered the stack limit. Only the stack probes take the sample; everyone else
+        // just wants to know how much stack there really is.
+        if (isSampleRequested != nullptr)
+        {
+            *isSampleRequested = true;
+            return false;
+        }
+        stackLimit = this->GetStackProber()->GetScriptStackLimit();
+        return (size_t)sp > size && (sp - size) > stackLimit;
+    }
+#endif
+
     if (sp <= stackLimit)
     {
         if (stackLimit == Js::Constants::StackLimitForScriptInterrupt)
@@ -1550,6 +1597,12 @@ ThreadContext::IsStackAvailableNoThrow(size_t size)
 {
     PBYTE sp = (PBYTE)_AddressOfReturnAddress();
     PBYTE stackLimit = this->GetStackLimitForCurrentThread();
+#if ENABLE_SAMPLING_PROFILER
+    if (stackLimit == Js::Constants::StackLimitForSamplingInterrupt)
+    {
+        stackLimit = this->GetStackProber()->GetScriptStackLimit();
+    }
+#endif
     bool stackAvailable = (sp > stackLimit) && ((size_t)sp > size) && ((sp - size) > stackLimit);
 
     FAULTINJECT_STACK_PROBE
@@ -1579,16 +1632,27 @@ void
 ThreadContext::ProbeStackNoDispose(size_t size, Js::ScriptContext *scriptContext, PVOID returnAddress)
 {
     AssertCanHandleStackOverflow();
-    if (!this->IsStackAvailable(size))
+    bool isSampleRequested = false;
+    if (!this->IsStackAvailable(size, &isSampleRequested))
     {
-        if (this->IsExecutionDisabled())
+#if ENABLE_SAMPLING_PROFILER
+        if (isSampleRequested)
         {
-            // The probe failed because we hammered the stack limit to trigger script interrupt.
-            Assert(this->DoInterruptProbe());
-            throw Js::ScriptAbortException();
+            // The probe failed because the sampling profiler hammered the stack limit to get a sample.
+            this->TakeSamplingProfilerSample(scriptContext, returnAddress);
         }
+        if (!isSampleRequested || !this->IsStackAvailable(size))
+#endif
+        {
+            if (this->IsExecutionDisabled())
+            {
+                // The probe failed because we hammered the stack limit to trigger script interrupt.
+                Assert(this->DoInterruptProbe());
+                throw Js::ScriptAbortException();
+            }
 
-        Js::Throw::StackOverflow(scriptContext, returnAddress);
+            Js::Throw::StackOverflow(scriptContext, returnAddress);
+        }
     }
 
     // Use every Nth stack probe as a QC trigger.
@@ -1623,8 +1687,20 @@ ThreadContext::ProbeStack(size_t size, Js::RecyclableObject * obj, Js::ScriptCon
     AssertCanHandleStackOverflowCall(obj->IsExternal() ||
         (Js::JavascriptOperators::GetTypeId(obj) == Js::TypeIds_Function &&
         Js::JavascriptFunction::FromVar(obj)->IsExternalFunction()));
-    if (!this->IsStackAvailable(size))
+    bool isSampleRequested = false;
+    if (!this->IsStackAvailable(size, &isSampleRequested))
     {
+#if ENABLE_SAMPLING_PROFILER
+        if (isSampleRequested)
+        {
+            this->TakeSamplingProfilerSample(scriptContext, nullptr);
+            if (this->IsStackAvailable(size))
+            {
+                return;
+            }
+        }
+#endif
+
         if (this->IsExecutionDisabled())
         {
             // The probe failed because we hammered the stack limit to trigger script interrupt.
@@ -1804,6 +1880,9 @@ ThreadContext::PopInterpreterFrame()
 BOOL
 ThreadContext::ExecuteRecyclerCollectionFunctionCommon(Recycler * recycler, CollectionFunction function, CollectionFlags flags)
 {
+    // Every in-thread part of a collection comes through here; the concurrent parts run on the background thread.
+    AutoThreadStatisticsTimer gcPauseTimer(&this->threadStatistics.gcPauseMicroseconds);
+    this->threadStatistics.gcPauseCount++;
     return  __super::ExecuteRecyclerCollectionFunction(recycler, function, flags);
 }
 
@@ -2406,6 +2485,8 @@ ThreadContext::PostCollectionCallBack()
 
     TryExitExpirableCollectMode();
 
+    TryRedeferFunctionBodies();
+
     // Recycler is null in the case where the ThreadContext is in the process of creating the recycler and
     // we have a GC triggered (say because the -recyclerStress flag is passed in)
     if (this->recycler != NULL && this->recycler->InCacheCleanupCollection())
@@ -2493,6 +2574,67 @@ ThreadContext::TryExitExpirableCollectMode()
     }
 }
 
+// Releases the byte code of functions that have gone -RedeferralInactiveThreshold GCs without being entered by the
+// interpreter. Like expiring jitted code this allocates (each redeferred function gets a fresh default entry point),
+// so it runs after the collection rather than in PreCollectionCallBack.
+void
+ThreadContext::TryRedeferFunctionBodies()
+{
+    if (!CONFIG_FLAG(Redeferral) || PHASE_OFF1(Js::RedeferralPhase) || this->isRedeferring || this->recycler == nullptr)
+    {
+        return;
+    }
+
+    // A threshold of zero would redefer a function between its interpreter entry and its first GC
+    const uint threshold = max(1, CONFIG_FLAG(RedeferralInactiveThreshold));
+
+    AutoRestoreValue<bool> autoRestoreIsRedeferring(&this->isRedeferring, true);
+
+    // Functions with a frame on the interpreter stack are live no matter how long ago they were entered
+    for (Js::InterpreterStackFrame* frame = this->GetLeafInterpreterFrame(); frame != nullptr; frame = frame->GetPreviousFrame())
+    {
+        frame->GetFunctionBody()->ResetRedeferralInactiveCount();
+    }
+    if (this->enteringInterpreterFunction != nullptr)
+    {
+        this->enteringInterpreterFunction->ResetRedeferralInactiveCount();
+    }
+
+    try
+    {
+        AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+
+        for (Js::ScriptContext *scriptContext = scriptContextList; scriptContext; scriptContext = scriptContext->next)
+        {
+            if (scriptContext->IsClosed() || scriptContext->IsScriptContextInSourceRundownOrDebugMode())
+            {
+                continue;
+            }
+
+            scriptContext->MapFunction([&](Js::FunctionBody* functionBody)
+            {
+                if (!functionBody->CanBeRedeferred())
+                {
+                    return;
+                }
+
+                if (functionBody->GetRedeferralInactiveCount() < threshold)
+                {
+                    functionBody->IncreaseRedeferralInactiveCount();
+                    return;
+                }
+
+                scriptContext->redeferralReclaimedBytes += functionBody->Redefer();
+                scriptContext->redeferredFunctionCount++;
+            });
+        }
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        // Whatever was redeferred before running out of memory stays redeferred; the rest is retried at the next GC
+    }
+}
+
 bool
 ThreadContext::InExpirableCollectMode()
 {
@@ -4045,6 +4187,122 @@ void ThreadContext::DisableExecution()
     return;
 }
 
+#if ENABLE_SAMPLING_PROFILER
+void ThreadContext::StartSamplingProfiler(uint intervalMilliseconds)
+{
+    Assert(this->samplingProfiler == nullptr);
+
+    AutoPtr<Js::SamplingProfiler> samplingProfiler(Js::SamplingProfiler::New(this, intervalMilliseconds));
+    if (!samplingProfiler->Start())
+    {
+        Js::Throw::OutOfMemory();
+    }
+    this->samplingProfiler = samplingProfiler.Detach();
+
+    this->RedeferFunctionBodiesWithoutLoopProbes();
+}
+
+// Byte code generated before the profiler started has no LoopBodyStart in its loops unless they may be jitted, so the
+// interpreter would only sample such a function at its calls. Drop that byte code where possible: the next call reparses
+// the function, and its loops get probes since the profiler is running. Frames already running keep their byte code.
+void ThreadContext::RedeferFunctionBodiesWithoutLoopProbes()
+{
+    if (this->isRedeferring)
+    {
+        return;
+    }
+
+    AutoRestoreValue<bool> autoRestoreIsRedeferring(&this->isRedeferring, true);
+
+    try
+    {
+        AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+
+        for (Js::ScriptContext *scriptContext = scriptContextList; scriptContext; scriptContext = scriptContext->next)
+        {
+            if (scriptContext->IsClosed() || scriptContext->IsScriptContextInSourceRundownOrDebugMode())
+            {
+                continue;
+            }
+
+            scriptContext->MapFunction([&](Js::FunctionBody* functionBody)
+            {
+                if (!functionBody->GetHasLoopWithoutLoopBodyStart() || !functionBody->CanBeRedeferred())
+                {
+                    return;
+                }
+
+                for (Js::InterpreterStackFrame* frame = this->GetLeafInterpreterFrame(); frame != nullptr; frame = frame->GetPreviousFrame())
+                {
+                    if (frame->GetFunctionBody() == functionBody)
+                    {
+                        return;
+                    }
+                }
+
+                scriptContext->redeferralReclaimedBytes += functionBody->Redefer();
+                scriptContext->redeferredFunctionCount++;
+            });
+        }
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        // Functions that keep their byte code are still sampled at their calls
+    }
+}
+
+Js::SamplingProfiler * ThreadContext::StopSamplingProfiler()
+{
+    Js::SamplingProfiler *samplingProfiler = this->samplingProfiler;
+    Assert(samplingProfiler != nullptr);
+
+    samplingProfiler->Stop();
+    this->samplingProfiler = nullptr;
+
+    // Don't leave a sample request behind for the next stack probe.
+    if (this->GetStackProber() != nullptr)
+    {
+        InterlockedCompareExchangePointer((PVOID *)&this->stackLimitForCurrentThread, this->GetStackProber()->GetScriptStackLimit(), Js::Constants::StackLimitForSamplingInterrupt);
+    }
+    return samplingProfiler;
+}
+
+// Called on the sampling profiler's timer thread.
+void ThreadContext::RequestSamplingProfilerSample()
+{
+    StackProber *stackProber = this->stackProber;
+    if (stackProber != nullptr)
+    {
+        // Only replace the normal limit: a script interrupt request wins over a sample.
+        InterlockedCompareExchangePointer((PVOID *)&this->stackLimitForCurrentThread, Js::Constants::StackLimitForSamplingInterrupt, stackProber->GetScriptStackLimit());
+    }
+}
+
+void ThreadContext::TakeSamplingProfilerSample(Js::ScriptContext *scriptContext, PVOID returnAddress)
+{
+    // Restore the normal stack limit, unless execution was disabled in the meantime.
+    InterlockedCompareExchangePointer((PVOID *)&this->stackLimitForCurrentThread, this->GetStackProber()->GetScriptStackLimit(), Js::Constants::StackLimitForSamplingInterrupt);
+
+    // The probe didn't check the real stack limit yet, and walking the stack needs a little of it.
+    if (this->samplingProfiler != nullptr && this->IsScriptActive() && this->IsStackAvailable(Js::Constants::MinStackDefault))
+    {
+        this->samplingProfiler->TakeSample(scriptContext, returnAddress);
+    }
+}
+#endif
+
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+// The thunks outlive every script context on the thread, so that their addresses are never handed out twice.
+Js::PerfMapInterpreterThunkEmitter * ThreadContext::GetPerfMapInterpreterThunkEmitter()
+{
+    if (this->perfMapInterpreterThunkEmitter == nullptr && (CONFIG_FLAG(PerfMap) || CONFIG_FLAG(PerfJitDump)))
+    {
+        this->perfMapInterpreterThunkEmitter = Js::PerfMapInterpreterThunkEmitter::New(CONFIG_FLAG(PerfJitDump));
+    }
+    return this->perfMapInterpreterThunkEmitter;
+}
+#endif
+
 void ThreadContext::EnableExecution()
 {
     Assert(this->GetStackProber());
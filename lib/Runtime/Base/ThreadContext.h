@@ -312,6 +312,26 @@ public:
 #endif
 #endif
 
+// Time spent parsing, generating byte code and collecting on the thread, as reported by JsGetRuntimeStatistics. A
+// collection triggered while parsing or generating byte code counts toward both.
+struct ThreadStatistics
+{
+    uint64 parseMicroseconds;
+    uint64 byteCodeGenMicroseconds;
+    uint64 gcPauseMicroseconds;
+    uint64 gcPauseCount;
+};
+
+class AutoThreadStatisticsTimer
+{
+private:
+    uint64 *counter;
+    Js::Tick start;
+public:
+    AutoThreadStatisticsTimer(uint64 *counter) : counter(counter), start(Js::Tick::Now()) {}
+    ~AutoThreadStatisticsTimer() { *counter += (uint64)(Js::Tick::Now() - start).ToMicroseconds(); }
+};
+
 #define AUTO_TAG_NATIVE_LIBRARY_ENTRY(function, callInfo, name) \
     AutoTagNativeLibraryEntry __tag(function, callInfo, name, _AddressOfReturnAddress())
 
@@ -663,6 +683,7 @@ private:
     ThreadServiceWrapper* threadServiceWrapper;
     uint functionCount;
     uint sourceInfoCount;
+    uint propertyRecordAddCount;
 
     Js::TypeId nextTypeId;
     uint32 polymorphicCacheState;
@@ -907,6 +928,14 @@ public:
     }
 #endif
 
+    ThreadStatistics threadStatistics;
+    ThreadStatistics GetThreadStatistics() const { return threadStatistics; }
+    void ResetThreadStatistics()
+    {
+        threadStatistics = { 0 };
+        allocationPolicyManager->ResetPeakUsage();
+    }
+
     double maxGlobalFunctionExecTime;
     double GetAndResetMaxGlobalFunctionExecTime()
     {
@@ -944,6 +973,27 @@ public:
             PHASE_ON1(Js::InterruptProbePhase);
     }
 
+    // The interpreter also probes at loop headers while the sampling profiler runs, so that hot loops get sampled.
+    // The JIT'd code keeps following DoInterruptProbe: its prologs are recognized by the stack walker on that basis.
+    bool DoInterpreterInterruptProbe(Js::FunctionBody *const func) const
+    {
+        return this->DoInterruptProbe(func) || this->IsSamplingProfilerRunning();
+    }
+
+#if ENABLE_SAMPLING_PROFILER
+    bool IsSamplingProfilerRunning() const { return this->samplingProfiler != nullptr; }
+    void StartSamplingProfiler(uint intervalMilliseconds);
+    Js::SamplingProfiler * StopSamplingProfiler();
+    void RequestSamplingProfilerSample();
+#else
+    bool IsSamplingProfilerRunning() const { return false; }
+#endif
+
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+    // nullptr unless -PerfMap or -PerfJitDump is on.
+    Js::PerfMapInterpreterThunkEmitter * GetPerfMapInterpreterThunkEmitter();
+#endif
+
     bool EvalDisabled() const
     {
         return this->TestThreadContextFlag(ThreadContextFlagEvalDisabled);
@@ -1143,6 +1193,8 @@ public:
     void InvalidatePropertyRecord(const Js::PropertyRecord * propertyRecord);
     Js::PropertyId GetNextPropertyId();
     Js::PropertyId GetMaxPropertyId();
+    // Changes whenever a property record is added; property ids are reused, so they can't tell.
+    uint GetPropertyRecordAddCount() const { return propertyRecordAddCount; }
     uint GetHighestPropertyNameIndex() const;
 
     void SetThreadServiceWrapper(ThreadServiceWrapper*);
@@ -1213,6 +1265,10 @@ public:
     Js::InterpreterStackFrame *PopInterpreterFrame();
     Js::InterpreterStackFrame *GetLeafInterpreterFrame() const { return leafInterpreterFrame; }
 
+    // The function InterpreterHelper is entering. It isn't on the interpreter stack until its frame is set up, and the
+    // allocations made meanwhile can run the redeferral pass.
+    Js::FunctionBody **GetAddressOfEnteringInterpreterFunction() { return &enteringInterpreterFunction; }
+
     Js::TempArenaAllocatorObject * GetTemporaryAllocator(LPCWSTR name);
     void ReleaseTemporaryAllocator(Js::TempArenaAllocatorObject * tempAllocator);
 
@@ -1363,7 +1419,7 @@ public:
     }
 
     static BOOLEAN IsOnStack(void const *ptr);
-    _NOINLINE bool IsStackAvailable(size_t size);
+    _NOINLINE bool IsStackAvailable(size_t size, bool *isSampleRequested = nullptr);
     _NOINLINE bool IsStackAvailableNoThrow(size_t size = Js::Constants::MinStackDefault);
     static bool IsCurrentStackAvailable(size_t size);
     void ProbeStackNoDispose(size_t size, Js::ScriptContext *scriptContext, PVOID returnAddress = nullptr);
@@ -1546,10 +1602,13 @@ public:
     int numExpirableObjects;
     int expirableCollectModeGcCount;
     bool disableExpiration;
+    bool isRedeferring;
+    Js::FunctionBody *enteringInterpreterFunction;
 
     bool InExpirableCollectMode();
     void TryEnterExpirableCollectMode();
     void TryExitExpirableCollectMode();
+    void TryRedeferFunctionBodies();
     void RegisterExpirableObject(ExpirableObject* object);
     void UnregisterExpirableObject(ExpirableObject* object);
     void DisposeExpirableObject(ExpirableObject* object);
@@ -1630,6 +1689,16 @@ private:
 
     InterruptPoller *interruptPoller;
 
+#if ENABLE_SAMPLING_PROFILER
+    Js::SamplingProfiler *samplingProfiler;
+    void TakeSamplingProfilerSample(Js::ScriptContext *scriptContext, PVOID returnAddress);
+    void RedeferFunctionBodiesWithoutLoopProbes();
+#endif
+
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+    Js::PerfMapInterpreterThunkEmitter *perfMapInterpreterThunkEmitter;
+#endif
+
     void CollectionCallBack(RecyclerCollectCallBackFlags flags);
 
     // Cache used by HostDispatch::GetBuiltInOperationFromEntryPoint
@@ -5,7 +5,6 @@
 
 #include "RuntimeByteCodePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 #if DBG_DUMP
 #include "Language/AsmJsModule.h"
 #include "ByteCode/AsmJsByteCodeDumper.h"
@@ -2418,4 +2417,3 @@ namespace Js
 }
 
 #endif
-#endif
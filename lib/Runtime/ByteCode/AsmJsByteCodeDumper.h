@@ -5,7 +5,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js {
 
 #if DBG_DUMP
@@ -44,4 +43,3 @@ namespace Js {
 #endif
 
 }
-#endif
@@ -5,7 +5,6 @@
 
 #include "RuntimeByteCodePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 #include "ByteCode/AsmJsByteCodeWriter.h"
 
 namespace Js
@@ -559,4 +558,3 @@ namespace Js
         EmptyAsm(OpCodeAsmJs::Label);
     }
 } // namespace Js
-#endif
@@ -5,7 +5,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
     struct AsmJsByteCodeWriter : public ByteCodeWriter
@@ -81,4 +80,3 @@ namespace Js
         void AddJumpOffset( Js::OpCodeAsmJs op, ByteCodeLabel labelId, uint fieldByteOffset );
     };
 }
-#endif
@@ -4,6 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 
-// {771a842c-80af-49ed-881c-1890d339426c}
+// {ae0fd3e9-3e68-4755-9521-9f6ed492864f}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0x771a842c, 0x80af, 0x49ed, { 0x88, 0x1c, 0x18, 0x90, 0xd3, 0x39, 0x42, 0x6c } };
+{ 0xae0fd3e9, 0x3e68, 0x4755, { 0x95, 0x21, 0x9f, 0x6e, 0xd4, 0x92, 0x86, 0x4f } };
@@ -2022,6 +2022,7 @@ HRESULT GenerateByteCode(__in ParseNode *pnode, __in uint32 grfscr, __in Js::Scr
                         Js::ScriptFunction ** functionRef)
 {
     HRESULT hr = S_OK;
+    AutoThreadStatisticsTimer byteCodeGenTimer(&scriptContext->GetThreadContext()->threadStatistics.byteCodeGenMicroseconds);
     ByteCodeGenerator byteCodeGenerator(scriptContext, parentScopeInfo);
     BEGIN_TRANSLATE_EXCEPTION_TO_HRESULT_NESTED
     {
@@ -21,6 +21,11 @@ namespace Js
             functionRead->GetOriginalByteCode() :
             functionRead->GetByteCode();
 
+        ByteCodeReader::Create(byteCodeBlock, startOffset);
+    }
+
+    void ByteCodeReader::Create(ByteBlock* byteCodeBlock, uint startOffset /* = 0 */)
+    {
         AssertMsg(byteCodeBlock != nullptr, "Must have valid byte-code to read");
 
         m_startLocation = byteCodeBlock->GetBuffer();
@@ -23,6 +23,7 @@ namespace Js
     public:
         void Create(FunctionBody* functionRead, uint startOffset = 0);
         void Create(FunctionBody* functionRead, uint startOffset, bool useOriginalByteCode);
+        void Create(ByteBlock* byteCodeBlock, uint startOffset = 0);
         uint GetCurrentOffset() const;
         const byte * SetCurrentOffset(int byteOffset);
         const byte * SetCurrentRelativeOffset(const byte * ip, int byteOffset);
@@ -54,13 +55,11 @@ namespace Js
         const unaligned OpLayout##layout* layout(const byte*& ip);
 #include "LayoutTypes.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 #define LAYOUT_TYPE(layout) \
         const unaligned OpLayout##layout* layout(); \
         const unaligned OpLayout##layout* layout(const byte*& ip);
 #define EXCLUDE_DUP_LAYOUT
 #include "LayoutTypesAsmJs.h"
-#endif
 
         template <typename T>
         static AuxArray<T> const * ReadAuxArray(uint offset, FunctionBody * functionBody);
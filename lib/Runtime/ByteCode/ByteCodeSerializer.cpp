@@ -750,7 +750,6 @@ public:
         uint offset;
     };
 
-#ifndef TEMP_DISABLE_ASMJS
     HRESULT RewriteAsmJsByteCodesInto(BufferBuilderList & builder, LPCWSTR clue, FunctionBody * function, ByteBlock * byteBlock)
     {
         SListCounted<AuxRecord> auxRecords(alloc);
@@ -1071,7 +1070,6 @@ public:
         RewriteAuxiliaryInto(builder, auxRecords, reader, function);
         return S_OK;
     }
-#endif
 
     HRESULT RewriteByteCodesInto(BufferBuilderList & builder, LPCWSTR clue, FunctionBody * function, ByteBlock * byteBlock)
     {
@@ -1658,7 +1656,6 @@ public:
         }
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     uint32 AddAsmJsConstantTable(BufferBuilderList & builder, FunctionBody * function)
     {
         uint32 size = 0;
@@ -1706,7 +1703,6 @@ public:
 
         return size;
     }
-#endif
 
     uint32 AddConstantTable(BufferBuilderList & builder, FunctionBody * function)
     {
@@ -1995,7 +1991,6 @@ public:
         return size;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     uint32 AddAsmJsFunctionInfo(BufferBuilderList & builder, FunctionBody * function)
     {
         uint32 size = 0;
@@ -2130,7 +2125,6 @@ public:
 #endif
         return size;
     }
-#endif
 
     HRESULT AddFunctionBody(BufferBuilderList & builder, FunctionBody * function, SRCINFO const * srcInfo)
     {
@@ -2190,10 +2184,8 @@ public:
             | (function->m_ChildCallsEval ? ffChildCallsEval : 0)
             | (function->m_hasReferenceableBuiltInArguments ? ffHasReferenceableBuiltInArguments : 0)
             | (isAnonymous ? ffIsAnonymous : 0)
-#ifndef TEMP_DISABLE_ASMJS
             | (function->m_isAsmjsMode ? ffIsAsmJsMode : 0)
             | (function->m_isAsmJsFunction ? ffIsAsmJsFunction : 0)
-#endif
             ;
 
         PrependInt32(builder, _u("BitFlags"), bitFlags);
@@ -2271,7 +2263,6 @@ public:
                 PrependByte(builder, _u("Loop Header Array Exists"), 0);
             }
 
-#ifndef TEMP_DISABLE_ASMJS
             if (function->GetAsmJsFunctionInfo())
             {
                 PrependByte(builder, _u("Asm.js Info Exists"), 1);
@@ -2283,12 +2274,10 @@ public:
                 AddAsmJsModuleInfo(builder, function);
             }
             else
-#endif
             {
                 PrependByte(builder, _u("Asm.js Info Exists"), 0);
             }
 
-#ifndef TEMP_DISABLE_ASMJS
             if (function->GetIsAsmJsFunction())
             {
                 AddAsmJsConstantTable(builder, function);
@@ -2299,7 +2288,6 @@ public:
                 }
             }
             else
-#endif
             {
                 AddConstantTable(builder, function);
                 auto hr = RewriteByteCodesInto(builder, _u("Rewritten Byte Code"), function, function->byteCodeBlock);
@@ -2956,7 +2944,6 @@ public:
         return current;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     const byte * ReadAsmJsConstantsTable(const byte * current, FunctionBody * function)
     {
 #ifdef BYTE_CODE_MAGIC_CONSTANTS
@@ -3007,7 +2994,6 @@ public:
 
         return current;
     }
-#endif
 
     const byte * ReadConstantsTable(const byte * current, FunctionBody * function)
     {
@@ -3403,7 +3389,6 @@ public:
         return current;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     const byte * ReadAsmJsFunctionInfo(const byte * current, FunctionBody * function)
     {
 #ifdef BYTE_CODE_MAGIC_CONSTANTS
@@ -3669,7 +3654,6 @@ public:
 
         return current;
     }
-#endif
 
     // Read a function body
     HRESULT ReadFunctionBody(const byte * functionBytes, FunctionProxy ** functionProxy, Utf8SourceInfo* sourceInfo, ByteCodeCache * cache, NativeModule *nativeModule, bool deserializeThis, bool deserializeNested = true, Js::DeferDeserializeFunctionInfo* deferDeserializeFunctionInfo = NULL)
@@ -3835,10 +3819,8 @@ public:
             (*functionBody)->m_CallsEval = (bitflags & ffhasSetCallsEval) ? true : false;
             (*functionBody)->m_ChildCallsEval = (bitflags & ffChildCallsEval) ? true : false;
             (*functionBody)->m_hasReferenceableBuiltInArguments = (bitflags & ffHasReferenceableBuiltInArguments) ? true : false;
-#ifndef TEMP_DISABLE_ASMJS
             (*functionBody)->m_isAsmJsFunction = (bitflags & ffIsAsmJsFunction) ? true : false;
             (*functionBody)->m_isAsmjsMode = (bitflags & ffIsAsmJsMode) ? true : false;
-#endif
 
             if ((*functionBody)->paramScopeSlotArraySize > 0)
             {
@@ -3863,7 +3845,6 @@ public:
 
             byte asmJsInfoExists;
             current = ReadByte(current, &asmJsInfoExists);
-#ifndef TEMP_DISABLE_ASMJS
             if (asmJsInfoExists == 1)
             {
                 current = ReadAsmJsFunctionInfo(current, *functionBody);
@@ -3873,19 +3854,16 @@ public:
                 current = ReadAsmJsModuleInfo(current, *functionBody);
             }
             else
-#endif
             {
                 Assert(asmJsInfoExists == 0);
             }
 
             // Read constants table
-#ifndef TEMP_DISABLE_ASMJS
             if ((*functionBody)->GetIsAsmJsFunction())
             {
                 current = ReadAsmJsConstantsTable(current, *functionBody);
             }
             else
-#endif
             {
                 current = ReadConstantsTable(current, *functionBody);
             }
@@ -72,8 +72,9 @@ namespace Js
         DebugOnly(isInUse = true);
         m_functionWrite = functionWrite;
         m_doJitLoopBodies = doJitLoopBodies;
-        m_doInterruptProbe = functionWrite->GetScriptContext()->GetThreadContext()->DoInterruptProbe(functionWrite);
+        m_doInterruptProbe = functionWrite->GetScriptContext()->GetThreadContext()->DoInterpreterInterruptProbe(functionWrite);
         m_hasLoop = hasLoop;
+        functionWrite->SetHasLoopWithoutLoopBodyStart(false);
         m_isInDebugMode = byteCodeGenerator->IsInDebugMode();
     }
 
@@ -3102,6 +3103,10 @@ StoreCommon:
         {
             this->Unsigned1(loopBodyOpcode, loopId);
         }
+        else
+        {
+            m_functionWrite->SetHasLoopWithoutLoopBodyStart(true);
+        }
 
         return loopId;
     }
@@ -4,7 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
     class OpCodeUtilAsmJs
@@ -25,4 +24,3 @@ namespace Js
         static OpLayoutTypeAsmJs const ExtendedOpCodeAsmJsLayouts[];
     };
 };
-#endif
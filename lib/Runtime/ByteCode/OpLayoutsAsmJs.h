@@ -5,7 +5,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
     ///----------------------------------------------------------------------------
@@ -2009,4 +2008,3 @@ namespace Js
 #undef DEFINE_OPCODEINFO
 #undef DEFINE_OPCODEINFO_WMS
 }
-#endif
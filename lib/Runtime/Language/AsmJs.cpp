@@ -21,7 +21,6 @@
 //-------------------------------------------------------------------------------------------------------
 
 #include "RuntimeLanguagePch.h"
-#ifndef TEMP_DISABLE_ASMJS
 #include "ByteCode/Symbol.h"
 #include "ByteCode/FuncInfo.h"
 #include "ByteCode/ByteCodeWriter.h"
@@ -523,7 +522,7 @@ namespace Js
             lib = ParserWrapper::DotMember(base);
             base = ParserWrapper::DotBase(base);
 
-            if (m.GetScriptContext()->GetConfig()->IsSimdjsEnabled())
+            if (m.IsSimdjsEnabled())
             {
                 if (!lib || (lib->GetPropertyId() != PropertyIds::Math && lib->GetPropertyId() != PropertyIds::SIMD))
                 {
@@ -542,7 +541,7 @@ namespace Js
         if( ParserWrapper::IsNameDeclaration(base) && base->name() == m.GetStdLibArgName() )
         {
 
-            if (m.GetScriptContext()->GetConfig()->IsSimdjsEnabled())
+            if (m.IsSimdjsEnabled())
             {
                 if (lib && lib->GetPropertyId() == PropertyIds::SIMD)
                 {
@@ -1251,4 +1250,3 @@ AsmJsCompilationError:
     }
 }
 
-#endif
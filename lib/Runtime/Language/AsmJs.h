@@ -22,7 +22,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
     struct ExclusiveContext
@@ -64,4 +63,3 @@ namespace Js
     };
 }
 
-#endif
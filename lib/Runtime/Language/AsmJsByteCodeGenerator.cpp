@@ -5,7 +5,6 @@
 
 #include "RuntimeLanguagePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 #include "ByteCode/Symbol.h"
 #include "ByteCode/FuncInfo.h"
 #ifdef DBG_DUMP
@@ -3567,4 +3566,3 @@ namespace Js
     }
 
 }
-#endif
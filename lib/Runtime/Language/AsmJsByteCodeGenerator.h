@@ -4,7 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
     // Information about the expression that has been emitted
@@ -146,7 +145,11 @@ namespace Js
 
         bool IsSimdjsEnabled()
         {
+#ifdef ENABLE_SIMDJS
             return mFunction->GetFuncBody()->GetScriptContext()->GetConfig()->IsSimdjsEnabled();
+#else
+            return false;
+#endif
         }
         // try to reuse a tmp register or acquire a new one
         // also takes care of releasing tmp register
@@ -190,4 +193,3 @@ namespace Js
         }
     };
 }
-#endif
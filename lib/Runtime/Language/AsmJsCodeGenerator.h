@@ -4,7 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
+#if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
     class ScriptContext;
@@ -4,7 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLanguagePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
+#if ENABLE_NATIVE_CODEGEN
 
 #include "CodeGenAllocators.h"
 #ifdef DBG_DUMP
@@ -6,7 +6,6 @@
 #include "RuntimeLanguagePch.h"
 #include "Library/BoundFunction.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js{
     bool ASMLink::CheckArrayBuffer(ScriptContext* scriptContext, Var bufferView, const AsmJsModuleInfo * info)
     {
@@ -627,4 +626,3 @@ namespace Js{
         return false;
     }
 }
-#endif
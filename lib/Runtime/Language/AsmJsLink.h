@@ -4,7 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 
 #pragma once
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js{
 
     class ASMLink{
@@ -21,4 +20,3 @@ namespace Js{
 #endif
     };
 }
-#endif
@@ -5,7 +5,6 @@
 
 #include "RuntimeLanguagePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 #include "ByteCode/Symbol.h"
 #include "ByteCode/FuncInfo.h"
 #include "ByteCode/ByteCodeApi.h"
@@ -105,7 +104,7 @@ namespace Js
             Assert(functionBody->GetIsAsmjsMode());
             Assert(functionBody->GetIsAsmJsFunction());
             ((EntryPointInfo*)functionBody->GetDefaultEntryPointInfo())->SetIsAsmJSFunction(true);
-#if _M_IX86
+#if _M_IX86 && ENABLE_NATIVE_CODEGEN
             if (PHASE_ON1(AsmJsJITTemplatePhase) && !Configuration::Global.flags.NoNative)
             {
                 AsmJsCodeGenerator* generator = GetScriptContext()->GetAsmJsCodeGenerator();
@@ -2639,6 +2638,7 @@ namespace Js
                 case AsmJsVarType::Int:
                     value = JavascriptNumber::ToVar(asmIntVars[asmSlot->location], scriptContext);
                     break;
+#ifdef ENABLE_SIMDJS
                 case AsmJsVarType::Float32x4:
                     value = JavascriptSIMDFloat32x4::New(&asmSIMDVars[asmSlot->location], scriptContext);
                     break;
@@ -2672,6 +2672,7 @@ namespace Js
                 case AsmJsVarType::Bool8x16:
                     value = JavascriptSIMDBool8x16::New(&asmSIMDVars[asmSlot->location], scriptContext);
                     break;
+#endif
                 default:
                     Assume(UNREACHED);
                 }
@@ -2715,9 +2716,10 @@ namespace Js
             case AsmJsSymbol::ArrayView:
             {
                 AnalysisAssert(asmBuffer);
-#ifdef _M_X64
+#if defined(_M_X64) && _WIN64
                 const bool isOptimizedBuffer = true;
-#elif _M_IX86
+#elif _M_IX86 || _M_X64
+                // virtual (guard page) buffers are only used on Win64
                 const bool isOptimizedBuffer = false;
 #else
                 Assert(UNREACHED);
@@ -3099,4 +3101,3 @@ namespace Js
         return true;
     }
 };
-#endif
@@ -5,7 +5,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 #define ASMMATH_BUILTIN_SIZE (32)
 #define ASMARRAY_BUILTIN_SIZE (16)
 #define ASMSIMD_BUILTIN_SIZE (512)
@@ -318,7 +317,11 @@ namespace Js {
         bool AddStandardLibraryArrayName(PropertyId id, AsmJsTypedArrayFunction * func, AsmJSTypedArrayBuiltinFunction mathLibFunctionName);
         bool CheckByteLengthCall(ParseNode * node, ParseNode * newBufferDecl);
         bool ValidateSimdConstructor(ParseNode* pnode, AsmJsSIMDFunction* simdFunc, AsmJsSIMDValue& value);
+#ifdef ENABLE_SIMDJS
         bool IsSimdjsEnabled() { return GetScriptContext()->GetConfig()->IsSimdjsEnabled(); }
+#else
+        bool IsSimdjsEnabled() { return false; }
+#endif
     };
 
     struct AsmJsSlot
@@ -618,4 +621,3 @@ namespace Js {
         static void * ConvertFrameForJavascript(void* asmJsMemory, ScriptFunction * func);
     };
 };
-#endif
@@ -23,7 +23,6 @@
 
 #include "RuntimeLanguagePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS 
 #include "ByteCode/ByteCodeWriter.h"
 #include "ByteCode/AsmJsByteCodeWriter.h"
 #include "Language/AsmJsByteCodeGenerator.h"
@@ -1320,4 +1319,3 @@ namespace Js
         return GetReturnType().toVarType();
     }
 }
-#endif
@@ -23,7 +23,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
     typedef uint32 uint32_t;
@@ -1313,4 +1312,3 @@ namespace Js
         virtual bool SupportsArgCall(ArgSlot argCount, AsmJsType* args, AsmJsRetType& retType) override;
     };
 };
-#endif
@@ -22,7 +22,6 @@
 
 #include "RuntimeLanguagePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
 namespace Js
 {
 
@@ -174,7 +173,7 @@ namespace Js
         return JavascriptBoolean::ToVar(TRUE, scriptContext);
     }
 
-#if _M_X64
+#if _M_X64 || (defined(ASMJS_PLAT) && !ENABLE_NATIVE_CODEGEN)
 
     // returns an array containing the size of each argument
     uint *GetArgsSizesArray(ScriptFunction* func)
@@ -193,6 +192,10 @@ namespace Js
             {
                 argSize += sizeof(AsmJsSIMDValue);
             }
+            else if (info->GetArgType(i).isDouble())
+            {
+                argSize += sizeof(double);
+            }
             else
             {
                 argSize += MachPtr;
@@ -234,7 +237,7 @@ namespace Js
                     intVal = 0;
                 }
 
-                *(int64*)(argDst) = 0;
+                *(Var*)(argDst) = 0;
                 *(int32*)argDst = intVal;
 
                 argDst = argDst + MachPtr;
@@ -250,7 +253,7 @@ namespace Js
                 {
                     floatVal = (float)(JavascriptNumber::NaN);
                 }
-                *(int64*)(argDst) = 0;
+                *(Var*)(argDst) = 0;
                 *(float*)argDst = floatVal;
                 argDst = argDst + MachPtr;
             }
@@ -265,10 +268,10 @@ namespace Js
                 {
                     doubleVal = JavascriptNumber::NaN;
                 }
-                *(int64*)(argDst) = 0;
                 *(double*)argDst = doubleVal;
-                argDst = argDst + MachPtr;
+                argDst = argDst + sizeof(double);
             }
+#ifdef ENABLE_SIMDJS
             else if (info->GetArgType(i).isSIMD())
             {
                 AsmJsVarType argType = info->GetArgType(i);
@@ -360,6 +363,7 @@ namespace Js
                 *(AsmJsSIMDValue*)argDst = simdVal;
                 argDst = argDst + sizeof(AsmJsSIMDValue);
             }
+#endif
             ++origArgs;
         }
         // for convenience, lets take the opportunity to return the asm.js entrypoint address
@@ -390,6 +394,7 @@ namespace Js
             returnValue = JavascriptNumber::NewWithCheck(floatRetVal, func->GetScriptContext());
             break;
         }
+#ifdef ENABLE_SIMDJS
         case AsmJsRetType::Float32x4:
         {
             X86SIMDValue simdVal;
@@ -467,13 +472,36 @@ namespace Js
             returnValue = JavascriptSIMDUint8x16::New(&X86SIMDValue::ToSIMDValue(simdVal), func->GetScriptContext());
             break;
         }
+#endif
         default:
             Assume(UNREACHED);
         }
 
         return returnValue;
     }
+#endif
+
+#if defined(ASMJS_PLAT) && !ENABLE_NATIVE_CODEGEN
+    // Without the native backend the asm.js function is run by the asm.js interpreter directly: the arguments
+    // are unboxed into the layout the interpreter reads and the result is picked up from the ScriptContext.
+    Var AsmJsExternalEntryPoint(RecyclableObject* entryObject, CallInfo callInfo, ...)
+    {
+        ARGUMENTS(args, callInfo);
+        ScriptFunction* func = (ScriptFunction*)entryObject;
+        AsmJsFunctionInfo* info = func->GetFunctionBody()->GetAsmJsFunctionInfo();
+        ScriptContext* scriptContext = func->GetScriptContext();
 
+        // The first slot stands in for 'this'; UnboxAsmJsArguments starts writing after it
+        char* argDst = (char*)_alloca(GetStackSizeForAsmJsUnboxing(func));
+        UnboxAsmJsArguments(func, args.Values + 1, argDst, callInfo);
+        *(Var*)argDst = scriptContext->GetLibrary()->GetUndefined();
+
+        CallInfo asmCallInfo(CallFlags_Value, (ArgSlot)(info->GetArgByteSize() / sizeof(Var)) + 1);
+        JavascriptFunction::CallFunction<true>(func, InterpreterStackFrame::AsmJsInterpreterThunk, Arguments(asmCallInfo, (Var*)argDst));
+
+        return BoxAsmJsReturnValue(func, (int)scriptContext->retAsmIntDbVal, scriptContext->retAsmIntDbVal,
+            (float)scriptContext->retAsmIntDbVal, X86SIMDValue::ToX86SIMDValue(scriptContext->retAsmSimdVal).m128_value);
+    }
 #elif _M_IX86
     Var AsmJsExternalEntryPoint(RecyclableObject* entryObject, CallInfo callInfo, ...)
     {
@@ -870,4 +898,3 @@ namespace Js
 #endif
 
 }
-#endif
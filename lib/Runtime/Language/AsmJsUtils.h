@@ -22,7 +22,6 @@
 
 #pragma once
 
-#ifndef TEMP_DISABLE_ASMJS
 // Removed code from original location, if the expression is true, check if extra code needed
 #define MaybeTodo( expr ) AssertMsg( !(expr), "Unhandled scenario in asm.js" )
 
@@ -34,11 +33,11 @@ namespace Js {
 
     Var AsmJsChangeHeapBuffer(RecyclableObject * function, CallInfo callInfo, ...);
 
-#if _M_X64
+#if _M_X64 || (defined(ASMJS_PLAT) && !ENABLE_NATIVE_CODEGEN)
     int GetStackSizeForAsmJsUnboxing(ScriptFunction* func);
 #pragma warning (suppress: 25057) // Suppress unannotated buffer warning
     void * UnboxAsmJsArguments(ScriptFunction* func, Var * origArgs, char * argDst, CallInfo callInfo);
-    Var BoxAsmJsReturnValue(ScriptFunction* func, int intRetVal, double doubleRetVal, float floatRetVal);
+    Var BoxAsmJsReturnValue(ScriptFunction* func, int intRetVal, double doubleRetVal, float floatRetVal, __m128 simdRetVal);
 #endif
 
     class AsmJsCompilationException
@@ -155,4 +154,3 @@ namespace Js {
         return node->sxBin.pnode1;
     }
 };
-#endif
@@ -0,0 +1,259 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#define ASSERT_THREAD() AssertMsg(mainThreadId == GetCurrentThreadContextId(), \
+    "Cannot use this member of BackgroundModuleParser from thread other than the creating context's current thread")
+
+#if ENABLE_PARALLEL_MODULE_PARSING
+namespace Js
+{
+    ModuleParseJob::ModuleParseJob(BackgroundModuleParser *const manager, SourceTextModuleRecord *const moduleRecord, Parser *const parser,
+        LPCUTF8 source, size_t cbSource, ULONG grfscr, SourceContextInfo *const sourceContextInfo)
+        : JsUtil::Job(manager),
+        moduleRecord(moduleRecord),
+        parser(parser),
+        source(source),
+        cbSource(cbSource),
+        grfscr(grfscr),
+        sourceContextInfo(sourceContextInfo),
+        parseTree(nullptr),
+        hr(S_OK),
+        processed(false),
+        nextJob(nullptr)
+    {
+        Assert(parser->IsBackgroundParser());
+    }
+
+    void ModuleParseJob::Parse()
+    {
+        // Probe this thread's stack, not the limit the main thread's thread context keeps
+        StackProber stackProber;
+        stackProber.Initialize();
+        parser->SetBackgroundStackLimit(stackProber.GetScriptStackLimit());
+
+        try
+        {
+            hr = parser->ParseUtf8Source(&parseTree, source, cbSource, grfscr, &se, &sourceContextInfo->nextLocalFunctionId, sourceContextInfo);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            hr = E_OUTOFMEMORY;
+            se.ProcessError(nullptr, E_OUTOFMEMORY, nullptr);
+        }
+        catch (Js::StackOverflowException)
+        {
+            hr = VBSERR_OutOfStack;
+            se.ProcessError(nullptr, VBSERR_OutOfStack, nullptr);
+        }
+        catch (Js::ScriptAbortException)
+        {
+            hr = E_ABORT;
+            se.ProcessError(nullptr, E_ABORT, nullptr);
+        }
+
+        if (SUCCEEDED(hr) && parseTree == nullptr)
+        {
+            hr = E_FAIL;
+        }
+    }
+
+    void ModuleParseJob::SetProcessed(bool succeeded)
+    {
+        if (!succeeded && SUCCEEDED(hr))
+        {
+            // The job was aborted before it ran, because the job processor is going away.
+            hr = E_ABORT;
+            parseTree = nullptr;
+        }
+        processed = true;
+    }
+
+    BackgroundModuleParser::BackgroundModuleParser(ScriptContext *scriptContext)
+        : JsUtil::WaitableJobManager(scriptContext->GetThreadContext()->GetJobProcessor()),
+        scriptContext(scriptContext),
+        pendingJobsHead(nullptr),
+        pendingJobsTail(nullptr),
+        pendingSourceCount(0),
+        isCompleting(false)
+    {
+        Processor()->AddManager(this);
+
+        // Regex literals are scanned with the thread's standard chars; make sure they exist before a job thread asks.
+        ThreadContext *threadContext = scriptContext->GetThreadContext();
+        threadContext->GetStandardChars((utf8char_t*)0);
+        threadContext->GetStandardChars((char16*)0);
+
+#if DBG
+        this->mainThreadId = GetCurrentThreadContextId();
+#endif
+    }
+
+    BackgroundModuleParser::~BackgroundModuleParser()
+    {
+        // Aborts the jobs still in the queue and waits for the ones being parsed.
+        Processor()->RemoveManager(this);
+
+        // The parsers belong to the module records and are released with them.
+        ModuleParseJob *job = pendingJobsHead;
+        while (job != nullptr)
+        {
+            ModuleParseJob *next = job->GetNext();
+            HeapDelete(job);
+            job = next;
+        }
+        pendingJobsHead = nullptr;
+        pendingJobsTail = nullptr;
+    }
+
+    BackgroundModuleParser * BackgroundModuleParser::New(ScriptContext *scriptContext)
+    {
+        return HeapNew(BackgroundModuleParser, scriptContext);
+    }
+
+    void BackgroundModuleParser::Delete(BackgroundModuleParser *backgroundModuleParser)
+    {
+        HeapDelete(backgroundModuleParser);
+    }
+
+    bool BackgroundModuleParser::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData)
+    {
+        ModuleParseJob *moduleParseJob = static_cast<ModuleParseJob*>(job);
+        moduleParseJob->Parse();
+        return SUCCEEDED(moduleParseJob->GetHR());
+    }
+
+    void BackgroundModuleParser::JobProcessed(JsUtil::Job *const job, const bool succeeded)
+    {
+        // This is called from inside the lock. The job stays on the pending list until the main thread picks it up.
+        static_cast<ModuleParseJob*>(job)->SetProcessed(succeeded);
+    }
+
+    bool BackgroundModuleParser::CanParseInBackground(SourceContextInfo *sourceContextInfo)
+    {
+        ASSERT_THREAD();
+
+        if (!Processor()->ProcessesInBackground() || sourceContextInfo->IsDynamic())
+        {
+            // Dynamic source contexts are shared with eval and new Function on this thread.
+            return false;
+        }
+
+        if (scriptContext->IsScriptContextInSourceRundownOrDebugMode())
+        {
+            // The parser reports to the debugger from the parse.
+            return false;
+        }
+
+        if (IsSourceContextInUse(sourceContextInfo))
+        {
+            // Function ids are handed out per source context, so only one of its scripts can be parsed at a time.
+            Processor()->PrioritizeManagerAndWait(this);
+        }
+        return true;
+    }
+
+    bool BackgroundModuleParser::IsSourceContextInUse(SourceContextInfo *sourceContextInfo)
+    {
+        AutoCriticalSection lock(Processor()->GetCriticalSection());
+        for (ModuleParseJob *job = pendingJobsHead; job != nullptr; job = job->GetNext())
+        {
+            if (!job->IsProcessed() && job->GetSourceContextInfo() == sourceContextInfo)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool BackgroundModuleParser::IsJobProcessed(ModuleParseJob *const job)
+    {
+        AutoCriticalSection lock(Processor()->GetCriticalSection());
+        return job->IsProcessed();
+    }
+
+    void BackgroundModuleParser::AddJob(ModuleParseJob *const job)
+    {
+        ASSERT_THREAD();
+
+        if (pendingJobsTail == nullptr)
+        {
+            pendingJobsHead = job;
+        }
+        else
+        {
+            pendingJobsTail->SetNext(job);
+        }
+        pendingJobsTail = job;
+
+        AutoCriticalSection lock(Processor()->GetCriticalSection());
+        Processor()->AddJob(job);
+    }
+
+    void BackgroundModuleParser::OnModuleFetched(SourceTextModuleRecord *moduleRecord)
+    {
+        ASSERT_THREAD();
+
+        if (moduleRecord->WasParsed() || moduleRecord->IsParsePending() || moduleRecord->IsAwaitingSource() ||
+            moduleRecord->GetErrorObject() != nullptr)
+        {
+            // Either the host already gave us this module's source, or it won't again.
+            return;
+        }
+        moduleRecord->SetIsAwaitingSource(true);
+        pendingSourceCount++;
+    }
+
+    void BackgroundModuleParser::OnModuleSourceReceived(SourceTextModuleRecord *moduleRecord)
+    {
+        ASSERT_THREAD();
+
+        if (!moduleRecord->IsAwaitingSource())
+        {
+            return;
+        }
+        moduleRecord->SetIsAwaitingSource(false);
+        Assert(pendingSourceCount != 0);
+        pendingSourceCount--;
+    }
+
+    void BackgroundModuleParser::CompleteParsedModules()
+    {
+        ASSERT_THREAD();
+
+        if (isCompleting)
+        {
+            // The host parsed a module from inside a fetch callback. The outer call picks up its job.
+            return;
+        }
+        AutoRestoreValue<bool> autoIsCompleting(&isCompleting, true);
+
+        while (pendingJobsHead != nullptr)
+        {
+            ModuleParseJob *job = pendingJobsHead;
+            if (!IsJobProcessed(job))
+            {
+                if (pendingSourceCount != 0)
+                {
+                    // The host still owes us module sources. Go get them while the job threads keep parsing.
+                    return;
+                }
+                Processor()->PrioritizeManagerAndWait(this);
+                Assert(IsJobProcessed(job));
+            }
+
+            pendingJobsHead = job->GetNext();
+            if (pendingJobsHead == nullptr)
+            {
+                pendingJobsTail = nullptr;
+            }
+
+            // This can call back into the host to fetch the module's imports, which may queue more jobs.
+            job->GetModuleRecord()->OnBackgroundParseCompleted(job);
+            HeapDelete(job);
+        }
+    }
+}
+#endif
@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_PARALLEL_MODULE_PARSING
+namespace Js
+{
+    class SourceTextModuleRecord;
+    class BackgroundModuleParser;
+
+    // The source of one imported module, parsed on a job processor thread into the module record's own parser.
+    // Nothing here may touch the recycler: the Utf8SourceInfo and the parser are set up on the main thread before
+    // the job is queued, and the parse tree is handed back to the module record on the main thread.
+    struct ModuleParseJob sealed : public JsUtil::Job
+    {
+        ModuleParseJob(BackgroundModuleParser *const manager, SourceTextModuleRecord *const moduleRecord, Parser *const parser,
+            LPCUTF8 source, size_t cbSource, ULONG grfscr, SourceContextInfo *const sourceContextInfo);
+
+        SourceTextModuleRecord *GetModuleRecord() const { return moduleRecord; }
+        SourceContextInfo *GetSourceContextInfo() const { return sourceContextInfo; }
+        ParseNodePtr GetParseTree() const { return parseTree; }
+        CompileScriptException *GetPSE() { return &se; }
+        ULONG GetParseFlags() const { return grfscr; }
+        HRESULT GetHR() const { return hr; }
+        bool IsProcessed() const { return processed; }
+
+        ModuleParseJob *GetNext() const { return nextJob; }
+        void SetNext(ModuleParseJob *job) { nextJob = job; }
+
+        void Parse();
+        void SetProcessed(bool succeeded);
+
+    private:
+        SourceTextModuleRecord *moduleRecord;
+        Parser *parser;
+        LPCUTF8 source;
+        size_t cbSource;
+        ULONG grfscr;
+        SourceContextInfo *sourceContextInfo;
+        ParseNodePtr parseTree;
+        CompileScriptException se;
+        HRESULT hr;
+        bool processed;
+        ModuleParseJob *nextJob;
+    };
+
+    // Parses the modules of an import graph in parallel. The host hands us module sources one at a time, from the
+    // fetches that finishing each parent's parse kicks off, so a job is queued per imported module and the main thread
+    // only picks the trees back up (in the order the sources arrived) once there is nothing left for it to wait on
+    // from the host. Byte code generation still happens on the main thread, at declaration instantiation.
+    class BackgroundModuleParser sealed : public JsUtil::WaitableJobManager
+    {
+    public:
+        BackgroundModuleParser(ScriptContext *scriptContext);
+        ~BackgroundModuleParser();
+
+        static BackgroundModuleParser * New(ScriptContext *scriptContext);
+        static void Delete(BackgroundModuleParser *backgroundModuleParser);
+
+        virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
+        virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
+
+        bool CanParseInBackground(SourceContextInfo *sourceContextInfo);
+        void AddJob(ModuleParseJob *const job);
+
+        void OnModuleFetched(SourceTextModuleRecord *moduleRecord);
+        void OnModuleSourceReceived(SourceTextModuleRecord *moduleRecord);
+        void CompleteParsedModules();
+
+    private:
+        bool IsSourceContextInUse(SourceContextInfo *sourceContextInfo);
+        bool IsJobProcessed(ModuleParseJob *const job);
+
+    private:
+        ScriptContext *scriptContext;
+        ModuleParseJob *pendingJobsHead;
+        ModuleParseJob *pendingJobsTail;
+        uint pendingSourceCount;
+        bool isCompleting;
+
+#if DBG
+        ThreadContextId mainThreadId;
+#endif
+    };
+}
+#endif
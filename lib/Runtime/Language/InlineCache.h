@@ -743,6 +743,23 @@ namespace Js
             return true;
         }
 
+        void ReplaceInitialType(DynamicType* type)
+        {
+            // Only legal while the cache hasn't been finalized, because until then it can't have been used by the JIT-ed code.
+            Assert(IsConsistent());
+            Assert(this->content.isPopulated);
+            Assert(this->content.updateAfterCtor);
+            Assert(IsNormal());
+            Assert(type->GetIsShared());
+            Assert(type->GetTypeHandler()->GetPropertyCount() == 0);
+            Assert(type->GetScriptContext() == this->content.scriptContext);
+            this->content.type = type;
+            this->content.typeIsFinal = false;
+            this->content.slotCount = type->GetTypeHandler()->GetSlotCapacity();
+            this->content.inlineSlotCount = type->GetTypeHandler()->GetInlineSlotCapacity();
+            Assert(IsConsistent());
+        }
+
         void UpdateInlineSlotCount()
         {
             Assert(IsConsistent());
@@ -34,7 +34,7 @@
 #define EXDEF4_WMS(process, op, func, y, t)
 #endif
 
-#if defined(INTERPRETER_ASMJS) && !defined(TEMP_DISABLE_ASMJS)
+#ifdef INTERPRETER_ASMJS
 #include "InterpreterHandlerAsmJs.inl"
 #else
 
@@ -108,7 +108,12 @@ EXDEF2_WMS(A1toA1Mem,               NewWithObject,              JavascriptOperat
   DEF2_WMS(A2I1toA1Mem,             NewConcatStrMulti,          JavascriptOperators::NewConcatStrMulti)
   DEF2_WMS(A2I1toXXMem,             SetConcatStrMultiItem,      JavascriptOperators::SetConcatStrMultiItem)
   DEF2_WMS(A3I1toXXMem,             SetConcatStrMultiItem2,     JavascriptOperators::SetConcatStrMultiItem2)
+#if QUICKENING_LOOP
+  DEF3_WMS(CUSTOM,                  Add_A,                      OP_AddAndQuicken, Reg3)
+#else
   DEF2_WMS(A2toA1Mem,               Add_A,                      JavascriptMath::Add)
+#endif
+  DEF3_WMS(CUSTOM,                  Add_A_TaggedInt,            OP_AddTaggedInt, Reg3)
   DEF2_WMS(A2toA1Mem,               Div_A,                      JavascriptMath::Divide)
   DEF2_WMS(A2toA1MemProfiled,       ProfiledDiv_A,              PROFILEDOP(ProfiledDivide<true>, ProfiledDivide<false>))
   DEF2_WMS(A2toA1Mem,               Mul_A,                      JavascriptMath::Multiply)
@@ -154,7 +159,9 @@ EXDEF2_WMS(A2toXX,                  SetComputedNameVar,         JavascriptOperat
   DEF2_WMS(CUSTOM_L_Arg,            ArgOut_A,                   OP_ArgOut_A)
   DEF3_WMS(CUSTOM_L_Arg2,           ProfiledArgOut_A,           PROFILEDOP(OP_ProfiledArgOut_A, OP_ArgOut_A), ProfiledArg)
 
-  DEF3_WMS(CUSTOM_L_Value,          LdFld,                      OP_GetProperty, ElementCP)
+  DEF3_WMS(CUSTOM_L_Value,          LdFld,                      QUICKENEDOP(OP_GetPropertyAndQuicken, OP_GetProperty), ElementCP)
+  DEF3_WMS(CUSTOM_L_Value,          LdFld_Local,                OP_GetPropertyLocal, ElementCP)
+  DEF3_WMS(CUSTOM_L_Value,          LdFld_Polymorphic,          OP_GetPropertyPolymorphic, ElementCP)
   DEF3_WMS(CUSTOM_L_Value,          LdLocalFld,                 OP_GetLocalProperty, ElementP)
 EXDEF3_WMS(CUSTOM_L_Value,          LdSuperFld,                 OP_GetSuperProperty, ElementC2)
   DEF3_WMS(CUSTOM_L_Value,          LdFldForTypeOf,             OP_GetPropertyForTypeOf, ElementCP)
@@ -174,12 +181,13 @@ EXDEF3_WMS(CUSTOM_L_Value,          LdLocalMethodFld,           OP_GetLocalMetho
 EXDEF3_WMS(CUSTOM_L_Value,          ProfiledLdLocalMethodFld,   PROFILEDOP(OP_ProfiledGetLocalMethodProperty, OP_GetLocalMethodProperty), ElementP)
   DEF3_WMS(CUSTOM_L_Value,          LdRootMethodFld,            OP_GetRootMethodProperty, ElementRootCP)
   DEF3_WMS(CUSTOM_L_Value,          ProfiledLdRootMethodFld,    PROFILEDOP(OP_ProfiledGetRootMethodProperty, OP_GetRootMethodProperty), ElementRootCP)
-  DEF3_WMS(CUSTOM_L_Value,          DeleteFld,                  OP_DeleteFld, ElementC)
+EXDEF3_WMS(CUSTOM_L_Value,          DeleteFld,                  OP_DeleteFld, ElementC)
 EXDEF3_WMS(CUSTOM_L_Value,          DeleteLocalFld,             OP_DeleteLocalFld, ElementU)
-  DEF3_WMS(CUSTOM_L_Value,          DeleteRootFld,              OP_DeleteRootFld, ElementC)
-  DEF3_WMS(CUSTOM_L_Value,          DeleteFldStrict,            OP_DeleteFldStrict, ElementC)
-  DEF3_WMS(CUSTOM_L_Value,          DeleteRootFldStrict,        OP_DeleteRootFldStrict, ElementC)
-  DEF3_WMS(CUSTOM,                  StFld,                      OP_SetProperty, ElementCP)
+EXDEF3_WMS(CUSTOM_L_Value,          DeleteRootFld,              OP_DeleteRootFld, ElementC)
+EXDEF3_WMS(CUSTOM_L_Value,          DeleteFldStrict,            OP_DeleteFldStrict, ElementC)
+EXDEF3_WMS(CUSTOM_L_Value,          DeleteRootFldStrict,        OP_DeleteRootFldStrict, ElementC)
+  DEF3_WMS(CUSTOM,                  StFld,                      QUICKENEDOP(OP_SetPropertyAndQuicken, OP_SetProperty), ElementCP)
+  DEF3_WMS(CUSTOM,                  StFld_Local,                OP_SetPropertyLocal, ElementCP)
   DEF3_WMS(CUSTOM,                  StLocalFld,                 OP_SetLocalProperty, ElementP)
 EXDEF3_WMS(CUSTOM_L_Value,          StSuperFld,                 OP_SetSuperProperty, ElementC2)
   DEF3_WMS(CUSTOM,                  ProfiledStFld,              PROFILEDOP(OP_ProfiledSetProperty, OP_SetProperty), ElementCP)
@@ -255,7 +263,9 @@ EXDEF2_WMS(SET_ELEM_LOCALSLOTNonVar,StLocalObjSlotChkUndecl,    OP_StObjSlotChkU
 EXDEF2_WMS(SET_ELEM_ENVSLOTNonVar,  StEnvObjSlot,               OP_StEnvObjSlot)
 EXDEF2_WMS(SET_ELEM_SLOTNonVar,     StObjSlotChkUndecl,         OP_StObjSlotChkUndecl)
 EXDEF2_WMS(SET_ELEM_ENVSLOTNonVar,  StEnvObjSlotChkUndecl,      OP_StEnvObjSlotChkUndecl)
-  DEF3_WMS(CUSTOM_L_Value,          LdElemI_A,                  OP_GetElementI, ElementI)
+  DEF3_WMS(CUSTOM_L_Value,          LdElemI_A,                  QUICKENEDOP(OP_GetElementIAndQuicken, OP_GetElementI), ElementI)
+  DEF3_WMS(CUSTOM_L_Value,          LdElemI_A_NativeIntArray,   OP_GetElementINativeIntArray, ElementI)
+  DEF3_WMS(CUSTOM_L_Value,          LdElemI_A_VarArray,         OP_GetElementIVarArray, ElementI)
   DEF3_WMS(CUSTOM_L_Value,          ProfiledLdElemI_A,          PROFILEDOP(OP_ProfiledGetElementI, OP_GetElementI), ProfiledElementI)
   DEF2_WMS(GET_ELEM_IMem,           LdMethodElem,               JavascriptOperators::OP_GetMethodElement)
   DEF3_WMS(CUSTOM,                  StElemI_A,                  OP_SetElementI, ElementI)
@@ -345,8 +355,8 @@ EXDEF3_WMS(CUSTOM,                  ConsoleScopedStFld,         OP_ConsoleSetPro
   DEF2_WMS(GET_ELEM_IMem_Strict,    DeleteElemIStrict_A,        JavascriptOperators::OP_DeleteElementI)
   DEF3_WMS(CUSTOM_L_Value,          ScopedLdInst,               OP_ScopedLdInst, ElementScopedC2)
   DEF3_WMS(CUSTOM,                  ScopedInitFunc,             OP_ScopedInitFunc, ElementScopedC)
-  DEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFld,            OP_ScopedDeleteFld, ElementScopedC)
-  DEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFldStrict,      OP_ScopedDeleteFldStrict, ElementScopedC)
+EXDEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFld,            OP_ScopedDeleteFld, ElementScopedC)
+EXDEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFldStrict,      OP_ScopedDeleteFldStrict, ElementScopedC)
   DEF3_WMS(CUSTOM,                  LdElemUndef,                OP_LdElementUndefined, ElementU)
 EXDEF3_WMS(CUSTOM,                  LdLocalElemUndef,           OP_LdLocalElementUndefined, ElementRootU)
   DEF2_WMS(XXtoA1,                  NewScObjectSimple,          OP_NewScObjectSimple)
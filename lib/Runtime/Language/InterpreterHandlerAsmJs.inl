@@ -4,7 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 
 
-#ifndef TEMP_DISABLE_ASMJS
 // See  Lib\Runtime\Language\InterpreterProcessOpCodeAsmJs.h  for Handler Process
 //         (   HandlerProcess , OpCodeAsmJs ,        HandlerFunction       , LayoutAsmJs , Type  )
 //         (        |         ,     |       ,              |               ,      |      ,   |   )
@@ -632,4 +631,3 @@ EXDEF2    (NOPASMJS          , NopEx        , Empty
 
 
 
-#endif
@@ -8,7 +8,7 @@
 // It allows for configurable copies of the loop that do extra work without
 // impacting the mainline performance. (for example the debug loop can simply
 // check a bit without concern for impacting the nondebug mode.)
-#if defined(INTERPRETER_ASMJS) && !defined(TEMP_DISABLE_ASMJS)
+#ifdef INTERPRETER_ASMJS
 #define INTERPRETER_OPCODE OpCodeAsmJs
 #else
 #define INTERPRETER_OPCODE OpCode
@@ -25,6 +25,13 @@
 #define INTERPRETERPROFILE 0
 #define PROFILEDOP(prof, unprof) unprof
 #endif
+#ifdef PROVIDE_QUICKENING
+#define QUICKENING_LOOP 1
+#define QUICKENEDOP(quick, generic) quick
+#else
+#define QUICKENING_LOOP 0
+#define QUICKENEDOP(quick, generic) generic
+#endif
 
 //two layers of macros are necessary to get arguments to the invocation of the top level macro expanded.
 #define CONCAT_TOKENS_AGAIN(loopName, fnSuffix) loopName ## fnSuffix
@@ -510,4 +517,6 @@ SWAP_BP_FOR_OPCODE:
 #undef DEBUGGING_LOOP
 #undef INTERPRETERPROFILE
 #undef PROFILEDOP
+#undef QUICKENING_LOOP
+#undef QUICKENEDOP
 #undef INTERPRETER_OPCODE
@@ -3,7 +3,6 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 
-#ifndef TEMP_DISABLE_ASMJS
 #define PROCESS_FALLTHROUGH_ASM(name, func) \
     case OpCodeAsmJs::name:
 #define PROCESS_FALLTHROUGH_ASM_COMMON(name, func, suffix) \
@@ -1975,5 +1974,3 @@ if (switchProfileMode) \
 #define PROCESS_SIMD_U16_1I1toU16_1(name, func) PROCESS_SIMD_U16_1I1toU16_1_COMMON(name, func,)
 
 
-
-#endif
\ No newline at end of file
@@ -927,7 +927,6 @@ namespace Js
         , (uint32)~7 //TYPE_FLOAT64
     };
 
-#ifndef TEMP_DISABLE_ASMJS
     typedef void(InterpreterStackFrame::*ArrFunc)(uint32, RegSlot);
 
     const ArrFunc InterpreterStackFrame::StArrFunc[8] =
@@ -953,7 +952,6 @@ namespace Js
         &InterpreterStackFrame::OP_LdArr<float>,
         &InterpreterStackFrame::OP_LdArr<double>,
     };
-#endif
 
     Var InterpreterStackFrame::InnerScopeFromRegSlot(RegSlot reg) const
     {
@@ -1100,7 +1098,7 @@ namespace Js
         newInstance->paramClosure = nullptr;
         newInstance->innerScopeArray = nullptr;
 
-        bool doInterruptProbe = newInstance->scriptContext->GetThreadContext()->DoInterruptProbe(this->executeFunction);
+        bool doInterruptProbe = newInstance->scriptContext->GetThreadContext()->DoInterpreterInterruptProbe(this->executeFunction);
 #if ENABLE_NATIVE_CODEGEN
         bool doJITLoopBody =
             !this->executeFunction->GetScriptContext()->GetConfig()->IsNoNative() &&
@@ -1453,7 +1451,6 @@ namespace Js
     }
 
 #ifdef _M_IX86
-#ifndef TEMP_DISABLE_ASMJS
     int InterpreterStackFrame::GetAsmJsArgSize(AsmJsCallStackLayout* stack)
     {
         JavascriptFunction * func = stack->functionObject;
@@ -1609,7 +1606,6 @@ namespace Js
         }
 #endif
 #endif
-#endif
 
 #if DYNAMIC_INTERPRETER_THUNK
 #ifdef _M_IX86
@@ -1733,6 +1729,16 @@ namespace Js
         Assert(threadContext->IsInScript());
 
         FunctionBody* executeFunction = JavascriptFunction::FromVar(function)->GetFunctionBody();
+        if (!isAsmJs && executeFunction->IsDeferredParseFunction())
+        {
+            // The body was redeferred while this function object's type still pointed at the interpreter thunk.
+            // Reparse it now; UpdateUndeferredBody fixes up the type's entry point for the next call.
+            JavascriptFunction::DeferredParse(&function);
+            executeFunction = JavascriptFunction::FromVar(function)->GetFunctionBody();
+        }
+
+        // Setting up the frame allocates, so a GC can run the redeferral pass before the frame is on the interpreter stack
+        AutoRestoreValue<FunctionBody *> autoRestoreEnteringFunction(threadContext->GetAddressOfEnteringInterpreterFunction(), executeFunction);
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (!isAsmJs && executeFunction->IsInDebugMode() != functionScriptContext->IsScriptContextInDebugMode()) // debug mode mismatch
         {
@@ -1793,6 +1799,7 @@ namespace Js
 #endif
 
         executeFunction->IncreaseInterpretedCount();
+        executeFunction->ResetRedeferralInactiveCount();
 #ifdef BGJIT_STATS
         functionScriptContext->interpretedCount++;
         functionScriptContext->maxFuncInterpret = max(functionScriptContext->maxFuncInterpret, executeFunction->GetInterpretedCount());
@@ -1912,7 +1919,15 @@ namespace Js
             newInstance = setup.InitializeAllocation(allocation, executeFunction->GetHasImplicitArgIns() && !isAsmJs, doProfile, loopHeaderArray, stackAddr);
 #endif
 
-            newInstance->m_reader.Create(executeFunction);
+            if (executeFunction->DoInterpreterQuickening())
+            {
+                newInstance->m_reader.Create(executeFunction->EnsureQuickenedByteCode());
+                newInstance->m_flags |= InterpreterStackFrameFlags_QuickenedByteCode;
+            }
+            else
+            {
+                newInstance->m_reader.Create(executeFunction);
+            }
         }
         //
         // Execute the function's byte-code, returning the return-value:
@@ -1984,7 +1999,6 @@ namespace Js
         return aReturn;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
 #if _M_IX86
     int InterpreterStackFrame::AsmJsInterpreter(AsmJsCallStackLayout* stack)
     {
@@ -2043,7 +2057,7 @@ namespace Js
         return retVal;
     }
 
-#elif _M_X64
+#elif _M_X64 && ENABLE_NATIVE_CODEGEN
 
     typedef double(*AsmJsInterpreterDoubleEP)(AsmJsCallStackLayout*, void *);
     typedef float(*AsmJsInterpreterFloatEP)(AsmJsCallStackLayout*, void *);
@@ -2136,6 +2150,63 @@ namespace Js
         return AsmJsInterpreter<X86SIMDValue>(layout).m128_value;
     }
 #endif
+
+#if defined(ASMJS_PLAT) && !ENABLE_NATIVE_CODEGEN
+    // Without the native backend there are no asm.js interpreter thunks, so asm.js functions are entered
+    // through this JavascriptMethod. The arguments following the 'this' slot are the raw asm.js values, laid
+    // out the way AlignMemoryForAsmJs reads them. The result is returned in the ScriptContext, as on x86.
+    // It must not be inlined, since it takes the addresses of its own return address and arguments.
+#ifdef _MSC_VER
+#pragma optimize("", off)
+#endif
+    _NOINLINE
+    Var InterpreterStackFrame::AsmJsInterpreterThunk(RecyclableObject* function, CallInfo callInfo, ...)
+    {
+        ARGUMENTS(args, callInfo);
+        void* returnAddress = _ReturnAddress();
+        void* addressOfReturnAddress = _AddressOfReturnAddress();
+
+        ScriptFunction* scriptFunction = ScriptFunction::FromVar(function);
+        ScriptContext* scriptContext = scriptFunction->GetScriptContext();
+        AsmJsFunctionInfo* asmInfo = scriptFunction->GetFunctionBody()->GetAsmJsFunctionInfo();
+
+        CallInfo asmCallInfo(CallFlags_Value, UInt16Math::Add(asmInfo->GetArgCount(), 1));
+        ArgumentReader asmArgs(&asmCallInfo, args.Values + 1);
+        InterpreterStackFrame* newInstance = (InterpreterStackFrame*)InterpreterHelper(scriptFunction, asmArgs, returnAddress, addressOfReturnAddress, true);
+
+        switch (asmInfo->GetReturnType().which())
+        {
+        case AsmJsRetType::Int32x4:
+        case AsmJsRetType::Bool32x4:
+        case AsmJsRetType::Bool16x8:
+        case AsmJsRetType::Bool8x16:
+        case AsmJsRetType::Float32x4:
+        case AsmJsRetType::Float64x2:
+        case AsmJsRetType::Int16x8:
+        case AsmJsRetType::Int8x16:
+        case AsmJsRetType::Uint32x4:
+        case AsmJsRetType::Uint16x8:
+        case AsmJsRetType::Uint8x16:
+            scriptContext->retAsmSimdVal = newInstance->m_localSimdSlots[0];
+            break;
+        case AsmJsRetType::Double:
+            scriptContext->retAsmIntDbVal = newInstance->m_localDoubleSlots[0];
+            break;
+        case AsmJsRetType::Float:
+            scriptContext->retAsmIntDbVal = (double)newInstance->m_localFloatSlots[0];
+            break;
+        case AsmJsRetType::Signed:
+        case AsmJsRetType::Void:
+            scriptContext->retAsmIntDbVal = (double)newInstance->m_localIntSlots[0];
+            break;
+        default:
+            Assume(UNREACHED);
+        }
+        return scriptContext->GetLibrary()->GetUndefined();
+    }
+#ifdef _MSC_VER
+#pragma optimize("", on)
+#endif
 #endif
 
     ///----------------------------------------------------------------------------
@@ -2356,7 +2427,6 @@ namespace Js
         return op;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     template<>
     OpCodeAsmJs InterpreterStackFrame::ReadByteOp<OpCodeAsmJs>(const byte *& ip
 #if DBG_DUMP
@@ -2390,7 +2460,6 @@ namespace Js
 #endif
         return op;
     }
-#endif
 
     _NOINLINE
     Var InterpreterStackFrame::ProcessThunk(void* address, void* addressOfReturnAddress)
@@ -2533,6 +2602,7 @@ namespace Js
                 double val = JavascriptConversion::ToNumber( value, scriptContext );
                 localDoubleSlots[import.location] = val;
             }
+#ifdef ENABLE_SIMDJS
             else if (scriptContext->GetConfig()->IsSimdjsEnabled() && type.isSIMD())
             {
                 // e.g. var g = f4(imports.v);
@@ -2596,6 +2666,7 @@ namespace Js
                 }
                 localSimdSlots[import.location] = val;
             }
+#endif
 
             // check for implicit call after converting to number
             if (this->CheckAndResetImplicitCall(prevDisableImplicitFlags, saveImplicitcallFlags))
@@ -2687,7 +2758,7 @@ namespace Js
             localFunctionTables[i] = funcTableArray;
         }
 // Do MTJRC/MAIC:0 check
-#if ENABLE_DEBUG_CONFIG_OPTIONS
+#if ENABLE_DEBUG_CONFIG_OPTIONS && ENABLE_NATIVE_CODEGEN
         if ((PHASE_ON1(Js::AsmJsJITTemplatePhase) && CONFIG_FLAG(MaxTemplatizedJitRunCount) == 0) || (!PHASE_ON1(Js::AsmJsJITTemplatePhase) && CONFIG_FLAG(MaxAsmJsInterpreterRunCount) == 0))
         {
             if (PHASE_TRACE1(AsmjsEntryPointInfoPhase))
@@ -2849,7 +2920,6 @@ namespace Js
         Output::Print(_u("\n"));
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     // Function memory allocation should be done the same way as
     // T AsmJsCommunEntryPoint(Js::ScriptFunction* func, ...)  (AsmJSJitTemplate.cpp)
     // update any changes there
@@ -2989,14 +3059,14 @@ namespace Js
         // Move the arguments to the right location
         ArgSlot argCount = info->GetArgCount();
 
-#if _M_X64
+#if _M_X64 && ENABLE_NATIVE_CODEGEN
         uint homingAreaSize = 0;
 #endif
 
         uintptr_t argAddress = (uintptr_t)m_inParams;
         for (ArgSlot i = 0; i < argCount; i++)
         {
-#if _M_X64
+#if _M_X64 && ENABLE_NATIVE_CODEGEN
             // 3rd Argument should be at the end of the homing area.
             Assert(i != 3 || argAddress == (uintptr_t)m_inParams + homingAreaSize);
             if (i < 3)
@@ -3114,7 +3184,6 @@ namespace Js
             m_localSlots[0] = JavascriptOperators::OP_LdUndef( scriptContext );
         }
     }
-#endif
 
     ///----------------------------------------------------------------------------
     ///
@@ -3139,14 +3208,20 @@ namespace Js
 #include "InterpreterLoop.inl"
 #undef INTERPRETERLOOPNAME
 
-#ifndef TEMP_DISABLE_ASMJS
+// Only frames running the function's private byte code copy use this loop, so the quickening handlers
+// (and their type checks) stay out of the generic interpreter loop.
+#define INTERPRETERLOOPNAME ProcessQuickened
+#define PROVIDE_QUICKENING
+#include "InterpreterLoop.inl"
+#undef PROVIDE_QUICKENING
+#undef INTERPRETERLOOPNAME
+
 #define INTERPRETERLOOPNAME ProcessAsmJs
 #define INTERPRETER_ASMJS
 #include "InterpreterProcessOpCodeAsmJs.h"
 #include "InterpreterLoop.inl"
 #undef INTERPRETER_ASMJS
 #undef INTERPRETERLOOPNAME
-#endif
 
 // For now, always collect profile data when debugging,
 // otherwise the backend will be confused if there's no profile data.
@@ -3208,7 +3283,6 @@ namespace Js
                 this->ehBailoutData = nullptr;
             }
         }
-#ifndef TEMP_DISABLE_ASMJS
         FunctionBody *const functionBody = GetFunctionBody();
         if( functionBody->GetIsAsmjsMode() )
         {
@@ -3254,7 +3328,6 @@ namespace Js
                 return ProcessAsmJsModule();
             }
         }
-#endif
 
 #if ENABLE_PROFILE_INFO
         switchProfileMode = false;
@@ -3279,7 +3352,7 @@ namespace Js
         while(true)
         {
             Assert(!switchProfileMode);
-            result = ProcessUnprofiled();
+            result = ProcessUnprofiledOrQuickened();
             Assert(!(switchProfileMode && result));
             if(switchProfileMode)
             {
@@ -3325,10 +3398,17 @@ namespace Js
         }
         return result;
 #else
-        return ProcessUnprofiled();
+        return ProcessUnprofiledOrQuickened();
 #endif
     }
 
+    Var InterpreterStackFrame::ProcessUnprofiledOrQuickened()
+    {
+        // Frames that read the private byte code copy run the loop that quickens it. Every loop handles the quickened
+        // opcodes themselves, so such a frame may still switch loops (to start profiling, for instance).
+        return (m_flags & InterpreterStackFrameFlags_QuickenedByteCode) ? ProcessQuickened() : ProcessUnprofiled();
+    }
+
 
 
     template <class T>
@@ -3572,8 +3652,49 @@ namespace Js
 
     }
 
-#ifndef TEMP_DISABLE_ASMJS
-#if _M_X64
+#if !ENABLE_NATIVE_CODEGEN
+    void InterpreterStackFrame::OP_CallAsmInternal(RecyclableObject * function)
+    {
+        AsmJsFunctionInfo* asmInfo = ((ScriptFunction*)function)->GetFunctionBody()->GetAsmJsFunctionInfo();
+        ScriptContext * scriptContext = function->GetScriptContext();
+        const ArgSlot argSlotCount = (ArgSlot)(asmInfo->GetArgByteSize() / sizeof(Var));
+
+        // The out params already hold the 'this' slot followed by the raw asm.js arguments
+        CallInfo callInfo(CallFlags_Value, argSlotCount + 1);
+        JavascriptFunction::CallFunction<true>(function, InterpreterStackFrame::AsmJsInterpreterThunk, Arguments(callInfo, m_outParams));
+
+        switch (asmInfo->GetReturnType().which())
+        {
+        case AsmJsRetType::Void:
+        case AsmJsRetType::Signed:
+            m_localIntSlots[0] = (int)scriptContext->retAsmIntDbVal;
+            break;
+        case AsmJsRetType::Double:
+            m_localDoubleSlots[0] = scriptContext->retAsmIntDbVal;
+            break;
+        case AsmJsRetType::Float:
+            m_localFloatSlots[0] = (float)scriptContext->retAsmIntDbVal;
+            break;
+        case AsmJsRetType::Float32x4:
+        case AsmJsRetType::Int32x4:
+        case AsmJsRetType::Bool32x4:
+        case AsmJsRetType::Bool16x8:
+        case AsmJsRetType::Bool8x16:
+        case AsmJsRetType::Float64x2:
+        case AsmJsRetType::Int16x8:
+        case AsmJsRetType::Int8x16:
+        case AsmJsRetType::Uint32x4:
+        case AsmJsRetType::Uint16x8:
+        case AsmJsRetType::Uint8x16:
+            m_localSimdSlots[0] = scriptContext->retAsmSimdVal;
+            break;
+        default:
+            Assume(UNREACHED);
+        }
+        PopOut(argSlotCount + 1);
+        Assert(function);
+    }
+#elif _M_X64
     void InterpreterStackFrame::OP_CallAsmInternal(RecyclableObject * function)
     {
         AsmJsFunctionInfo* asmInfo = ((ScriptFunction*)function)->GetFunctionBody()->GetAsmJsFunctionInfo();
@@ -3770,7 +3891,6 @@ namespace Js
     {
         __debugbreak();
     }
-#endif
 #endif
 
     template <class T>
@@ -4105,6 +4225,79 @@ namespace Js
         OP_GetProperty_NoFastPath(instance, playout);
     }
 
+    template <class T>
+    void InterpreterStackFrame::OP_GetPropertyAndQuicken(unaligned T* playout)
+    {
+        Var instance = GetReg(playout->Instance);
+        if (RecyclableObject::Is(instance))
+        {
+            Var value;
+            if (GetInlineCache(playout->inlineCacheIndex)->TryGetProperty<true, false, false, false, false>(
+                    instance, RecyclableObject::FromVar(instance), GetPropertyIdFromCacheId(playout->inlineCacheIndex), &value, GetScriptContext(), nullptr))
+            {
+                QuickenOpCode(playout, OpCode::LdFld_Local);
+                SetReg(playout->Value, value);
+                return;
+            }
+        }
+
+        OP_GetProperty_NoFastPath(instance, playout);
+
+        // A miss that left a polymorphic cache behind won't settle on a single type again.
+        if (m_functionBody->GetPolymorphicInlineCache(playout->inlineCacheIndex) != nullptr)
+        {
+            QuickenOpCode(playout, OpCode::LdFld_Polymorphic);
+        }
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_GetPropertyLocal(unaligned T* playout)
+    {
+        // Type check and direct inline or aux slot load; no PropertyValueInfo, prototype or accessor checks.
+        // The proto and accessor layouts never hold a type where u.local.type is, so no layout check is needed either.
+        Var instance = GetReg(playout->Instance);
+        if (RecyclableObject::Is(instance))
+        {
+            const InlineCache *const inlineCache = GetInlineCache(playout->inlineCacheIndex);
+            Type *const type = RecyclableObject::FromVar(instance)->GetType();
+            if (type == inlineCache->u.local.type)
+            {
+                SetReg(playout->Value, DynamicObject::FromVar(instance)->GetInlineSlot(inlineCache->u.local.slotIndex));
+                return;
+            }
+            if (TypeWithAuxSlotTag(type) == inlineCache->u.local.type)
+            {
+                SetReg(playout->Value, DynamicObject::FromVar(instance)->GetAuxSlot(inlineCache->u.local.slotIndex));
+                return;
+            }
+        }
+
+        DeoptQuickenedOpCode(playout, OpCode::LdFld);
+        OP_GetPropertyAndQuicken(playout);
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_GetPropertyPolymorphic(unaligned T* playout)
+    {
+        // Polymorphic inline caches are indexed by a hash of the type, so this is a single probe for a local slot hit.
+        Var instance = GetReg(playout->Instance);
+        if (RecyclableObject::Is(instance))
+        {
+            PolymorphicInlineCache *const polymorphicInlineCache = m_functionBody->GetPolymorphicInlineCache(playout->inlineCacheIndex);
+            Var value;
+            if (polymorphicInlineCache != nullptr &&
+                polymorphicInlineCache->TryGetProperty<true, false, false, false, false, false>(
+                    instance, RecyclableObject::FromVar(instance), GetPropertyIdFromCacheId(playout->inlineCacheIndex), &value, GetScriptContext(), nullptr, nullptr))
+            {
+                SetReg(playout->Value, value);
+                return;
+            }
+        }
+
+        // Prototype, accessor and missing hits and cache fills all go through the full path; the site stays polymorphic.
+        OP_GetProperty_NoFastPath(instance, playout);
+    }
+
     template <class T>
     void InterpreterStackFrame::OP_GetSuperProperty(unaligned T* playout)
     {
@@ -4547,6 +4740,55 @@ namespace Js
         DoSetProperty(playout, GetReg(playout->Instance), PropertyOperation_None);
     }
 
+    template <class T>
+    void InterpreterStackFrame::OP_SetPropertyAndQuicken(unaligned T* playout)
+    {
+        Var instance = GetReg(playout->Instance);
+        InlineCache *inlineCache;
+
+        // Only stores to an existing local slot are quickened. Stores that add the property hit through
+        // typeWithoutProperty on the generic path instead, which StFld_Local doesn't check.
+        if (!TaggedNumber::Is(instance)
+            && TrySetPropertyLocalFastPath(playout, GetPropertyIdFromCacheId(playout->inlineCacheIndex), instance, inlineCache))
+        {
+            if (GetJavascriptFunction()->GetConstructorCache()->NeedsUpdateAfterCtor())
+            {
+                // See DoSetProperty
+                inlineCache->Clear();
+            }
+            else
+            {
+                QuickenOpCode(playout, OpCode::StFld_Local);
+            }
+            return;
+        }
+
+        DoSetProperty_NoFastPath(playout, instance, PropertyOperation_None);
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_SetPropertyLocal(unaligned T* playout)
+    {
+        Var instance = GetReg(playout->Instance);
+        InlineCache *const inlineCache = GetInlineCache(playout->inlineCacheIndex);
+        if (!TaggedNumber::Is(instance) &&
+            inlineCache->TrySetProperty<true, false, false, false>(
+                RecyclableObject::FromVar(instance), GetPropertyIdFromCacheId(playout->inlineCacheIndex), GetReg(playout->Value), GetScriptContext(), nullptr, PropertyOperation_None))
+        {
+            if (GetJavascriptFunction()->GetConstructorCache()->NeedsUpdateAfterCtor())
+            {
+                // See DoSetProperty. This isn't a guard miss, so put the generic store back without counting a deopt;
+                // OP_SetPropertyAndQuicken quickens it again once the constructor cache no longer needs updating.
+                inlineCache->Clear();
+                RevertQuickenedOpCode(playout, OpCode::StFld);
+            }
+            return;
+        }
+
+        DeoptQuickenedOpCode(playout, OpCode::StFld);
+        OP_SetPropertyAndQuicken(playout);
+    }
+
     template <class T>
     void InterpreterStackFrame::OP_SetLocalProperty(unaligned T* playout)
     {
@@ -5023,6 +5265,174 @@ namespace Js
         SetReg(playout->Value, element);
     }
 
+    template <typename T>
+    inline void InterpreterStackFrame::QuickenOpCode(const unaligned T* playout, OpCode quickenedOp)
+    {
+        if (m_flags & InterpreterStackFrameFlags_QuickenedByteCode)
+        {
+            // A single byte opcode always immediately precedes its layout, after any layout size prefix, so the
+            // quickened form can be written in place as long as it shares the generic opcode's layout.
+            Assert(OpCodeUtil::IsSmallEncodedOpcode(quickenedOp));
+            byte *const opCodeByte = (byte *)playout - 1;
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+            if (*opCodeByte != (byte)quickenedOp && PHASE_TRACE(Js::QuickeningPhase, m_functionBody))
+            {
+                Output::Print(_u("Quickening - Func %s - %s quickened to %s\n"), m_functionBody->GetDisplayName(),
+                    OpCodeUtil::GetOpCodeName((OpCode)*opCodeByte), OpCodeUtil::GetOpCodeName(quickenedOp));
+                Output::Flush();
+            }
+#endif
+            *opCodeByte = (byte)quickenedOp;
+        }
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::RevertQuickenedOpCode(const unaligned T* playout, OpCode genericOp)
+    {
+        Assert(OpCodeUtil::IsSmallEncodedOpcode(genericOp));
+        byte *const opCodeByte = (byte *)playout - 1;
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        if (PHASE_TRACE(Js::QuickeningPhase, m_functionBody))
+        {
+            Output::Print(_u("Quickening - Func %s - %s reverted to %s\n"), m_functionBody->GetDisplayName(),
+                OpCodeUtil::GetOpCodeName((OpCode)*opCodeByte), OpCodeUtil::GetOpCodeName(genericOp));
+            Output::Flush();
+        }
+#endif
+        *opCodeByte = (byte)genericOp;
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::DeoptQuickenedOpCode(const unaligned T* playout, OpCode genericOp)
+    {
+        RevertQuickenedOpCode(playout, genericOp);
+
+        // Stop quickening once a function keeps flipping between forms. Frames that start after this point read the
+        // function's original byte code instead of the private copy.
+        if (m_functionBody->IncreaseQuickeningDeoptCount() >= (uint32)CONFIG_FLAG(QuickeningDeoptLimit))
+        {
+            m_flags &= ~InterpreterStackFrameFlags_QuickenedByteCode;
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+            if (PHASE_TRACE(Js::QuickeningPhase, m_functionBody))
+            {
+                Output::Print(_u("Quickening - Func %s - Disabled after %u deopts\n"),
+                    m_functionBody->GetDisplayName(), m_functionBody->GetQuickeningDeoptCount());
+                Output::Flush();
+            }
+#endif
+        }
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::OP_AddAndQuicken(const unaligned T* playout)
+    {
+        Var aLeft = GetReg(playout->R1);
+        Var aRight = GetReg(playout->R2);
+        if (TaggedInt::IsPair(aLeft, aRight))
+        {
+            QuickenOpCode(playout, OpCode::Add_A_TaggedInt);
+            SetReg(playout->R0, TaggedInt::Add(aLeft, aRight, GetScriptContext()));
+            return;
+        }
+        SetReg(playout->R0, JavascriptMath::Add_Full(aLeft, aRight, GetScriptContext()));
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::OP_AddTaggedInt(const unaligned T* playout)
+    {
+        Var aLeft = GetReg(playout->R1);
+        Var aRight = GetReg(playout->R2);
+        if (!TaggedInt::IsPair(aLeft, aRight))
+        {
+            DeoptQuickenedOpCode(playout, OpCode::Add_A);
+            SetReg(playout->R0, JavascriptMath::Add_Full(aLeft, aRight, GetScriptContext()));
+            return;
+        }
+        SetReg(playout->R0, TaggedInt::Add(aLeft, aRight, GetScriptContext()));
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::OP_GetElementIAndQuicken(const unaligned T* playout)
+    {
+        Var instance = GetReg(playout->Instance);
+        if (!TaggedNumber::Is(instance) && TaggedInt::Is(GetReg(playout->Element)))
+        {
+            // Only exact vtable matches qualify, which excludes cross-site, copy-on-access and ES5 arrays.
+            if (VirtualTableInfo<JavascriptNativeIntArray>::HasVirtualTable(instance))
+            {
+                QuickenOpCode(playout, OpCode::LdElemI_A_NativeIntArray);
+            }
+            else if (VirtualTableInfo<JavascriptArray>::HasVirtualTable(instance))
+            {
+                QuickenOpCode(playout, OpCode::LdElemI_A_VarArray);
+            }
+        }
+        OP_GetElementI(playout);
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::OP_GetElementINativeIntArray(const unaligned T* playout)
+    {
+        Var instance = GetReg(playout->Instance);
+        if (TaggedNumber::Is(instance) || !VirtualTableInfo<JavascriptNativeIntArray>::HasVirtualTable(instance))
+        {
+            DeoptQuickenedOpCode(playout, OpCode::LdElemI_A);
+            OP_GetElementI(playout);
+            return;
+        }
+
+        // Out of bounds indices and holes stay quickened and just take the generic path.
+        Var varIndex = GetReg(playout->Element);
+        if (TaggedInt::Is(varIndex))
+        {
+            SparseArraySegment<int32> *const head =
+                static_cast<SparseArraySegment<int32> *>(JavascriptNativeIntArray::FromVar(instance)->GetHead());
+            Assert(head->left == 0);
+            const uint32 offset = (uint32)TaggedInt::ToInt32(varIndex);
+            if (offset < head->length)
+            {
+                const int32 value = head->elements[offset];
+                if (!SparseArraySegment<int32>::IsMissingItem(&value))
+                {
+                    SetReg(playout->Value, JavascriptNumber::ToVar(value, GetScriptContext()));
+                    return;
+                }
+            }
+        }
+        OP_GetElementI(playout);
+    }
+
+    template <typename T>
+    void InterpreterStackFrame::OP_GetElementIVarArray(const unaligned T* playout)
+    {
+        Var instance = GetReg(playout->Instance);
+        if (TaggedNumber::Is(instance) || !VirtualTableInfo<JavascriptArray>::HasVirtualTable(instance))
+        {
+            DeoptQuickenedOpCode(playout, OpCode::LdElemI_A);
+            OP_GetElementI(playout);
+            return;
+        }
+
+        Var varIndex = GetReg(playout->Element);
+        if (TaggedInt::Is(varIndex))
+        {
+            SparseArraySegment<Var> *const head =
+                static_cast<SparseArraySegment<Var> *>(JavascriptArray::FromVar(instance)->GetHead());
+            Assert(head->left == 0);
+            const uint32 offset = (uint32)TaggedInt::ToInt32(varIndex);
+            if (offset < head->length)
+            {
+                const Var element = head->elements[offset];
+                if (!SparseArraySegment<Var>::IsMissingItem(&element))
+                {
+                    SetReg(playout->Value, element);
+                    return;
+                }
+            }
+        }
+        OP_GetElementI(playout);
+    }
+
     template <typename T>
     void InterpreterStackFrame::OP_SetElementI(const unaligned T* playout, PropertyOperationFlags flags)
     {
@@ -8123,7 +8533,6 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
         return this->localClosure;
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     template <typename T2>
     void InterpreterStackFrame::OP_StArr(uint32 index, RegSlot value)
     {
@@ -8134,7 +8543,6 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
             *(T2*)(buffer + index) = (T2)GetRegRaw<T2>(value);
         }
     }
-#endif
 
     template<> inline double InterpreterStackFrame::GetArrayViewOverflowVal()
     {
@@ -8159,7 +8567,6 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
         m_localSlots[playout->Value] = arr[index];
     }
 
-#ifndef TEMP_DISABLE_ASMJS
     template <typename T2>
     void InterpreterStackFrame::OP_LdArr(uint32 index, RegSlot value)
     {
@@ -8168,7 +8575,6 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
         T2 val = index < (arr->GetByteLength()) ? *(T2*)(buffer + index) : GetArrayViewOverflowVal<T2>();
         SetRegRaw<T2>(value, val);
     }
-#endif
 
     template <class T, typename T2>
     void InterpreterStackFrame::OP_StSlotPrimitive(const unaligned T* playout)
@@ -26,6 +26,7 @@ namespace Js
         InterpreterStackFrameFlags_WithinFinallyBlock = 4,
         InterpreterStackFrameFlags_FromBailOut = 8,
         InterpreterStackFrameFlags_ProcessingBailOutFromEHCode = 0x10,
+        InterpreterStackFrameFlags_QuickenedByteCode = 0x20,
         InterpreterStackFrameFlags_All = 0xFFFF,
     };
     struct InterpreterStackFrame   /* Stack allocated, no virtuals */
@@ -275,7 +276,7 @@ namespace Js
         static int GetDynamicRetType(AsmJsCallStackLayout * stack);
         static DWORD GetAsmIntDbValOffSet(AsmJsCallStackLayout * stack);
         _NOINLINE   static int  AsmJsInterpreter(AsmJsCallStackLayout * stack);
-#elif _M_X64
+#elif _M_X64 && ENABLE_NATIVE_CODEGEN
         template <typename T>
         static T AsmJsInterpreter(AsmJsCallStackLayout* layout);
         static void * GetAsmJsInterpreterEntryPoint(AsmJsCallStackLayout* stack);
@@ -288,6 +289,10 @@ namespace Js
 
 #endif
 
+#if defined(ASMJS_PLAT) && !ENABLE_NATIVE_CODEGEN
+        static Var AsmJsInterpreterThunk(RecyclableObject* function, CallInfo callInfo, ...);
+#endif
+
 #ifdef ASMJS_PLAT
         static void InterpreterAsmThunk(AsmJsCallStackLayout* layout);
 #endif
@@ -325,29 +330,36 @@ namespace Js
         Var ProcessAsmJs();
         Var ProcessProfiled();
         Var ProcessUnprofiled();
+        Var ProcessQuickened();
+        Var ProcessUnprofiledOrQuickened();
 
         const byte* ProcessProfiledExtendedOpCodePrefix(const byte* ip);
         const byte* ProcessUnprofiledExtendedOpCodePrefix(const byte* ip);
+        const byte* ProcessQuickenedExtendedOpCodePrefix(const byte* ip);
         const byte* ProcessWithDebuggingExtendedOpCodePrefix(const byte* ip);
         const byte* ProcessAsmJsExtendedOpCodePrefix(const byte* ip);
 
         const byte* ProcessProfiledMediumLayoutPrefix(const byte* ip, Var&);
         const byte* ProcessUnprofiledMediumLayoutPrefix(const byte* ip, Var&);
+        const byte* ProcessQuickenedMediumLayoutPrefix(const byte* ip, Var&);
         const byte* ProcessWithDebuggingMediumLayoutPrefix(const byte* ip, Var&);
         const byte* ProcessAsmJsMediumLayoutPrefix(const byte* ip, Var&);
 
         const byte* ProcessProfiledExtendedMediumLayoutPrefix(const byte* ip);
         const byte* ProcessUnprofiledExtendedMediumLayoutPrefix(const byte* ip);
+        const byte* ProcessQuickenedExtendedMediumLayoutPrefix(const byte* ip);
         const byte* ProcessWithDebuggingExtendedMediumLayoutPrefix(const byte* ip);
         const byte* ProcessAsmJsExtendedMediumLayoutPrefix(const byte* ip);
 
         const byte* ProcessProfiledLargeLayoutPrefix(const byte* ip, Var&);
         const byte* ProcessUnprofiledLargeLayoutPrefix(const byte* ip, Var&);
+        const byte* ProcessQuickenedLargeLayoutPrefix(const byte* ip, Var&);
         const byte* ProcessWithDebuggingLargeLayoutPrefix(const byte* ip, Var&);
         const byte* ProcessAsmJsLargeLayoutPrefix(const byte* ip, Var&);
 
         const byte* ProcessProfiledExtendedLargeLayoutPrefix(const byte* ip);
         const byte* ProcessUnprofiledExtendedLargeLayoutPrefix(const byte* ip);
+        const byte* ProcessQuickenedExtendedLargeLayoutPrefix(const byte* ip);
         const byte* ProcessWithDebuggingExtendedLargeLayoutPrefix(const byte* ip);
         const byte* ProcessAsmJsExtendedLargeLayoutPrefix(const byte* ip);
 
@@ -427,6 +439,9 @@ namespace Js
         template <class T> void OP_GetSuperProperty(unaligned T* playout);
         template <class T> void OP_GetPropertyForTypeOf(unaligned T* playout);
         template <class T> void OP_GetProperty_NoFastPath(Var instance, unaligned T* playout);
+        template <class T> void OP_GetPropertyAndQuicken(unaligned T* playout);
+        template <class T> void OP_GetPropertyLocal(unaligned T* playout);
+        template <class T> void OP_GetPropertyPolymorphic(unaligned T* playout);
         template <class T> void OP_ProfiledGetProperty(unaligned T* playout);
         template <class T> void OP_ProfiledGetLocalProperty(unaligned T* playout);
         template <class T> void OP_ProfiledGetSuperProperty(unaligned T* playout);
@@ -456,6 +471,8 @@ namespace Js
 #endif
 
         template <class T> void OP_SetProperty(unaligned T* playout);
+        template <class T> void OP_SetPropertyAndQuicken(unaligned T* playout);
+        template <class T> void OP_SetPropertyLocal(unaligned T* playout);
         template <class T> void OP_SetLocalProperty(unaligned T* playout);
         template <class T> void OP_SetSuperProperty(unaligned T* playout);
         template <class T> void OP_ProfiledSetProperty(unaligned T* playout);
@@ -505,6 +522,16 @@ namespace Js
         template <bool doProfile> Var ProfileModulus(Var aLeft, Var aRight, ScriptContext* scriptContext, ProfileId profileId);
         template <bool doProfile> Var ProfiledSwitch(Var exp, ProfileId profileId);
 
+        // Byte code quickening
+        template <typename T> void QuickenOpCode(const unaligned T* playout, OpCode quickenedOp);
+        template <typename T> void RevertQuickenedOpCode(const unaligned T* playout, OpCode genericOp);
+        template <typename T> void DeoptQuickenedOpCode(const unaligned T* playout, OpCode genericOp);
+        template <typename T> void OP_AddAndQuicken(const unaligned T* playout);
+        template <typename T> void OP_AddTaggedInt(const unaligned T* playout);
+        template <typename T> void OP_GetElementIAndQuicken(const unaligned T* playout);
+        template <typename T> void OP_GetElementINativeIntArray(const unaligned T* playout);
+        template <typename T> void OP_GetElementIVarArray(const unaligned T* playout);
+
         // Non-patching Fastpath operations
         template <typename T> void OP_GetElementI(const unaligned T* playout);
         template <typename T> void OP_ProfiledGetElementI(const unaligned OpLayoutDynamicProfile<T>* playout);
@@ -299,16 +299,7 @@ CommonNumber:
         {
             // For all other types, convert the key into a string and use that as the property name
             JavascriptString * propName = JavascriptConversion::ToString(key, scriptContext);
-
-            if (VirtualTableInfo<Js::PropertyString>::HasVirtualTable(propName))
-            {
-                PropertyString * propertyString = (PropertyString *)propName;
-                *propertyRecord = propertyString->GetPropertyRecord();
-            }
-            else
-            {
-                scriptContext->GetOrAddPropertyRecord(propName->GetString(), propName->GetLength(), propertyRecord);
-            }
+            scriptContext->GetOrAddPropertyRecord(propName, propertyRecord);
         }
     }
 
@@ -147,6 +147,7 @@ namespace Js
         if (this->functionBody)
         {
             this->byteCodeOffset = walker.GetByteCodeOffset();
+            this->functionBody->SetIsReferencedByStackTrace();
         }
         else
         {
@@ -201,6 +202,13 @@ namespace Js
 
         m_throwingFunction = StackScriptFunction::EnsureBoxed(BOX_PARAM(function, returnAddress, _u("throw")));
         m_throwingFunctionByteCodeOffset = byteCodeOffset;
+
+        FunctionBody *const functionBody = m_throwingFunction->GetFunctionBody();
+        if (functionBody != nullptr)
+        {
+            // Keep the statement maps the offset is resolved against; see FunctionBody::CanBeRedeferred
+            functionBody->SetIsReferencedByStackTrace();
+        }
     }
 
 #if ENABLE_DEBUG_STACK_BACK_TRACE
@@ -119,6 +119,16 @@ namespace Js
         else
         {
             JavascriptString* indexStr = JavascriptConversion::ToString(indexVar, scriptContext);
+            if (scriptContext->TryGetCachedPropertyRecord(indexStr, propertyRecord))
+            {
+                if ((*propertyRecord)->IsNumeric())
+                {
+                    *index = (*propertyRecord)->GetNumericValue();
+                    return IndexType_Number;
+                }
+                return IndexType_PropertyId;
+            }
+
             char16 const * propertyName = indexStr->GetString();
             charcount_t const propertyLength = indexStr->GetLength();
 
@@ -130,10 +140,25 @@ namespace Js
                     return IndexType_Number;
                 }
 
+                // Names that have a property record already are cached for the next lookup with the same string.
+                // Others stay strings, so that looking up a missing property doesn't create a record for it, and
+                // are cached as misses, so that looking the same string up again doesn't search the thread's map.
+                scriptContext->FindPropertyRecord(indexStr, propertyRecord);
+                if (*propertyRecord != nullptr)
+                {
+                    return IndexType_PropertyId;
+                }
+
                 *propertyNameString = indexStr;
                 return IndexType_JavascriptString;
             }
-            return GetIndexTypeFromString(propertyName, propertyLength, scriptContext, index, propertyRecord, createIfNotFound);
+
+            IndexType indexType = GetIndexTypeFromString(propertyName, propertyLength, scriptContext, index, propertyRecord, createIfNotFound);
+            if (indexType == IndexType_PropertyId && *propertyRecord != nullptr)
+            {
+                scriptContext->CachePropertyRecord(indexStr, *propertyRecord);
+            }
+            return indexType;
         }
     }
 
@@ -6145,6 +6170,14 @@ CommonNumber:
 
         Assert(constructorCache->GetGuardValueAsType() != nullptr);
 
+        if (!finalizeCachedType && TryGrowConstructorCacheInlineSlots(constructorCache, instance, constructorBody))
+        {
+#if DBG_DUMP
+            TraceUpdateConstructorCache(constructorCache, constructorBody, true, _u("with an initial type with more inline slots"));
+#endif
+            return;
+        }
+
         if (DynamicType::Is(RecyclableObject::FromVar(instance)->GetTypeId()))
         {
             DynamicObject *object = DynamicObject::FromVar(instance);
@@ -6284,6 +6317,61 @@ CommonNumber:
         }
     }
 
+    bool JavascriptOperators::TryGrowConstructorCacheInlineSlots(ConstructorCache* constructorCache, Var instance, FunctionBody* constructorBody)
+    {
+        // The first objects a constructor creates start out on a type with a fixed number of inline slots. Whatever they
+        // end up with beyond that goes to aux slots, and once the cached type is finalized its inline slot capacity can only
+        // shrink. So while the cache is still updated after each constructor call, if the objects created so far have
+        // outgrown the cached type's inline slots (in the constructor or after it), start the next objects on a new initial
+        // type with room for the longest of them. Finalizing the cached type then shrinks that to the slots actually used.
+        const int inlineSlotCountLimit = CONFIG_FLAG(ConstructorInlineSlotCountLimit);
+        if (inlineSlotCountLimit <= 0 || !constructorCache->IsNormal() ||
+            !DynamicType::Is(RecyclableObject::FromVar(instance)->GetTypeId()))
+        {
+            return false;
+        }
+
+        DynamicObject* object = DynamicObject::FromVar(instance);
+        DynamicType* cachedType = constructorCache->GetType();
+        if (!object->GetTypeHandler()->IsPathTypeHandler() || object->GetPrototype() != cachedType->GetPrototype())
+        {
+            return false;
+        }
+
+        uint16 maxPathLength = 0;
+        if (!PathTypeHandlerBase::FromTypeHandler(object->GetTypeHandler())->GetMaxPathLengthFromRoot(&maxPathLength))
+        {
+            return false;
+        }
+
+        const PropertyIndex inlineSlotCapacity = cachedType->GetTypeHandler()->GetInlineSlotCapacity();
+        if (maxPathLength <= inlineSlotCapacity || inlineSlotCapacity >= inlineSlotCountLimit)
+        {
+            return false;
+        }
+
+        const uint16 requestedInlineSlotCapacity = static_cast<uint16>(min(static_cast<int>(maxPathLength), inlineSlotCountLimit));
+        DynamicType* newType = constructorBody->GetScriptContext()->GetLibrary()->CreateObjectType(cachedType->GetPrototype(), requestedInlineSlotCapacity);
+        if (newType->GetTypeHandler()->GetInlineSlotCapacity() <= inlineSlotCapacity)
+        {
+            return false;
+        }
+
+        constructorCache->ReplaceInitialType(newType);
+        PHASE_PRINT_TESTTRACE1(Js::ConstructorCachePhase, _u("Inline slot capacity grown for constructor %s\n"), constructorBody->GetDisplayName());
+
+#if DBG_DUMP
+        if (Js::Configuration::Global.flags.Trace.IsEnabled(Js::InlineSlotsPhase))
+        {
+            char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+
+            Output::Print(_u("Inline slot capacity grown: Function:%04s Before:%d After:%d\n"),
+                constructorBody->GetDebugNumberSet(debugStringBuffer), inlineSlotCapacity, newType->GetTypeHandler()->GetInlineSlotCapacity());
+        }
+#endif
+        return true;
+    }
+
     void JavascriptOperators::TraceUseConstructorCache(const ConstructorCache* ctorCache, const JavascriptFunction* ctor, bool isHit)
     {
 #if DBG_DUMP
@@ -0,0 +1,243 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+#include "PlatformAgnostic/PerfMap.h"
+#include "Language/PerfMapInterpreterThunkEmitter.h"
+
+// From libgcc: makes C++ exceptions thrown by the interpreter unwind through the thunks.
+extern "C" void __register_frame(void *begin);
+extern "C" void __deregister_frame(void *begin);
+
+namespace Js
+{
+    //
+    // On entry the stack is [return address] [function] [callInfo] [arg0] ..., with the function and the call info also
+    // in rdi and rsi. Push a copy of callInfo.Count + 2 slots, keeping the stack 16 byte aligned at the call, so that
+    // InterpreterThunk finds the same layout above its own return address.
+    //
+    const BYTE PerfMapInterpreterThunkEmitter::Thunk[] = {
+        0x55,                                                          // push        rbp
+        0x48, 0x89, 0xE5,                                              // mov         rbp, rsp
+        0x89, 0xF1,                                                    // mov         ecx, esi
+        0x81, 0xE1, 0xFF, 0xFF, 0xFF, 0x00,                            // and         ecx, 0FFFFFFh          ;callInfo.Count
+        0x8D, 0x41, 0x02,                                              // lea         eax, [rcx+2]           ;slots to copy
+        0xA8, 0x01,                                                    // test        al, 1
+        0x74, 0x04,                                                    // je          $copy
+        0x48, 0x83, 0xEC, 0x08,                                        // sub         rsp, 8
+        // $copy:
+        0xFF, 0x74, 0xC5, 0x08,                                        // push        qword ptr [rbp+rax*8+8]
+        0xFF, 0xC8,                                                    // dec         eax
+        0x75, 0xF8,                                                    // jne         $copy
+        0x31, 0xC0,                                                    // xor         eax, eax               ;no vector registers for the varargs callee
+        0x48, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // mov         rcx, <InterpreterThunk>
+        0xFF, 0xD1,                                                    // call        rcx
+        0xC9,                                                          // leave
+        0xC3,                                                          // ret
+        0xCC                                                           // int         3                      ;pad to ThunkSize
+    };
+
+    PerfMapInterpreterThunkEmitter::PerfMapInterpreterThunkEmitter(bool useJitDump)
+        : blocks(nullptr)
+    {
+        this->isPerfMapOpen = PlatformAgnostic::PerfMap::EnsureOpen(
+            useJitDump ? PlatformAgnostic::PerfMap::Format_JitDump : PlatformAgnostic::PerfMap::Format_PerfMap);
+    }
+
+    PerfMapInterpreterThunkEmitter::~PerfMapInterpreterThunkEmitter()
+    {
+        ThunkBlock *block = this->blocks;
+        while (block != nullptr)
+        {
+            ThunkBlock *next = block->next;
+            __deregister_frame(block->unwindInfo);
+            HeapDeleteArray(UnwindInfoSize, block->unwindInfo);
+            ::VirtualFree(block->code, 0, MEM_RELEASE);
+            HeapDelete(block);
+            block = next;
+        }
+        this->blocks = nullptr;
+    }
+
+    PerfMapInterpreterThunkEmitter * PerfMapInterpreterThunkEmitter::New(bool useJitDump)
+    {
+        return HeapNew(PerfMapInterpreterThunkEmitter, useJitDump);
+    }
+
+    void PerfMapInterpreterThunkEmitter::Delete(PerfMapInterpreterThunkEmitter *emitter)
+    {
+        HeapDelete(emitter);
+    }
+
+    JavascriptMethod PerfMapInterpreterThunkEmitter::GetNextThunk(FunctionBody *functionBody)
+    {
+        CompileAssert(sizeof(Thunk) == ThunkSize);
+
+        if (!this->isPerfMapOpen)
+        {
+            // Nobody would be able to tell the thunks apart.
+            return nullptr;
+        }
+
+        ThunkBlock *block = this->blocks;
+        if (block == nullptr || block->thunkCount == BlockSize / ThunkSize)
+        {
+            block = this->AllocateBlock();
+            if (block == nullptr)
+            {
+                return nullptr;
+            }
+        }
+
+        // AllocateBlock already wrote every thunk in the block, so handing one out needs no protection change.
+        BYTE *thunk = block->code + block->thunkCount * ThunkSize;
+        block->thunkCount++;
+
+        LogThunk(thunk, functionBody);
+        return (JavascriptMethod)thunk;
+    }
+
+    PerfMapInterpreterThunkEmitter::ThunkBlock * PerfMapInterpreterThunkEmitter::AllocateBlock()
+    {
+        BYTE *code = (BYTE *)::VirtualAlloc(nullptr, BlockSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (code == nullptr)
+        {
+            return nullptr;
+        }
+
+        // The thunks differ only in their address, so fill the whole block up front and make it executable once.
+        JavascriptMethod interpreterThunk = InterpreterStackFrame::InterpreterThunk;
+        memset(code, 0xCC, BlockSize);
+        for (uint i = 0; i < BlockSize / ThunkSize; i++)
+        {
+            BYTE *thunk = code + i * ThunkSize;
+            js_memcpy_s(thunk, ThunkSize, Thunk, ThunkSize);
+            js_memcpy_s(thunk + ThunkTargetOffset, sizeof(interpreterThunk), &interpreterThunk, sizeof(interpreterThunk));
+        }
+
+        DWORD oldProtect;
+        if (!::VirtualProtect(code, BlockSize, PAGE_EXECUTE_READ, &oldProtect))
+        {
+            ::VirtualFree(code, 0, MEM_RELEASE);
+            return nullptr;
+        }
+        ::FlushInstructionCache(::GetCurrentProcess(), code, BlockSize);
+
+        ThunkBlock *block = HeapNewNoThrow(ThunkBlock);
+        BYTE *unwindInfo = HeapNewNoThrowArray(BYTE, UnwindInfoSize);
+        if (block == nullptr || unwindInfo == nullptr)
+        {
+            if (block != nullptr)
+            {
+                HeapDelete(block);
+            }
+            if (unwindInfo != nullptr)
+            {
+                HeapDeleteArray(UnwindInfoSize, unwindInfo);
+            }
+            ::VirtualFree(code, 0, MEM_RELEASE);
+            return nullptr;
+        }
+
+        WriteUnwindInfo(unwindInfo, code, BlockSize);
+        __register_frame(unwindInfo);
+
+        block->code = code;
+        block->unwindInfo = unwindInfo;
+        block->thunkCount = 0;
+        block->next = this->blocks;
+        this->blocks = block;
+        return block;
+    }
+
+    //
+    // An .eh_frame with one CIE and one FDE covering the whole block, terminated by a zero length entry. The FDE gives
+    // the rules that hold after the thunk's prolog: that's where the thunk is when an exception unwinds through it,
+    // from the return address of its call. The prolog and epilog instructions themselves are described wrongly.
+    //
+    void PerfMapInterpreterThunkEmitter::WriteUnwindInfo(BYTE *buffer, BYTE *code, size_t codeSize)
+    {
+        BYTE *current = buffer;
+        auto writeByte = [&](BYTE value) { *current++ = value; };
+        auto writeUInt32 = [&](uint32 value) { js_memcpy_s(current, sizeof(value), &value, sizeof(value)); current += sizeof(value); };
+        auto writeUInt64 = [&](uint64 value) { js_memcpy_s(current, sizeof(value), &value, sizeof(value)); current += sizeof(value); };
+        auto endEntry = [&](BYTE *entry)
+        {
+            // Pad with DW_CFA_nop so the next entry's length field is 4 byte aligned, then fill in this one's length.
+            while ((current - buffer) % 4 != 0)
+            {
+                writeByte(0x00);
+            }
+            uint32 length = (uint32)(current - entry - sizeof(uint32));
+            js_memcpy_s(entry, sizeof(length), &length, sizeof(length));
+        };
+
+        BYTE *cie = current;
+        writeUInt32(0);                 // length
+        writeUInt32(0);                 // CIE id
+        writeByte(1);                   // version
+        writeByte('z');                 // augmentation "zR"
+        writeByte('R');
+        writeByte(0);
+        writeByte(1);                   // code alignment factor
+        writeByte(0x78);                // data alignment factor -8
+        writeByte(16);                  // return address register rip
+        writeByte(1);                   // augmentation data length
+        writeByte(0x00);                // FDE pointer encoding DW_EH_PE_absptr
+        writeByte(0x0C);                // DW_CFA_def_cfa rsp, 8
+        writeByte(7);
+        writeByte(8);
+        writeByte(0x90);                // DW_CFA_offset rip, cfa - 8
+        writeByte(1);
+        endEntry(cie);
+
+        BYTE *fde = current;
+        writeUInt32(0);                 // length
+        writeUInt32((uint32)(current - cie)); // CIE pointer
+        writeUInt64((uint64)code);      // initial location
+        writeUInt64(codeSize);          // address range
+        writeByte(0);                   // augmentation data length
+        writeByte(0x0C);                // DW_CFA_def_cfa rbp, 16
+        writeByte(6);
+        writeByte(16);
+        writeByte(0x86);                // DW_CFA_offset rbp, cfa - 16
+        writeByte(2);
+        endEntry(fde);
+
+        writeUInt32(0);
+        Assert(current - buffer <= UnwindInfoSize);
+    }
+
+    void PerfMapInterpreterThunkEmitter::LogThunk(BYTE *thunk, FunctionBody *functionBody)
+    {
+        const uint MaxNameLength = 256;
+        const uint MaxSourceNameLength = 512;
+
+        const char16 *displayName = functionBody->GetExternalDisplayName();
+        const char16 *sourceName = functionBody->GetSourceName();
+        utf8char_t displayNameUtf8[MaxNameLength * 3 + 1];
+        utf8char_t sourceNameUtf8[MaxSourceNameLength * 3 + 1];
+        utf8::EncodeTrueUtf8IntoAndNullTerminate(displayNameUtf8, displayName,
+            (charcount_t)min(wcslen(displayName), (size_t)MaxNameLength));
+        utf8::EncodeTrueUtf8IntoAndNullTerminate(sourceNameUtf8, sourceName,
+            (charcount_t)min(wcslen(sourceName), (size_t)MaxSourceNameLength));
+
+        char name[sizeof(displayNameUtf8) + sizeof(sourceNameUtf8) + 32];
+        int length = sprintf_s(name, sizeof(name), "JS:%s %s:%u", (char *)displayNameUtf8, (char *)sourceNameUtf8,
+            functionBody->GetLineNumber() + 1);
+        for (int i = 0; i < length; i++)
+        {
+            // The perf map is line based.
+            if ((unsigned char)name[i] < ' ')
+            {
+                name[i] = ' ';
+            }
+        }
+
+        PlatformAgnostic::PerfMap::LogCodeLoad(thunk, ThunkSize, name);
+    }
+}
+#endif
@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_PERF_MAP_INTERPRETER_THUNK
+namespace Js
+{
+    // Without a dynamic interpreter thunk, every interpreted function is entered through InterpreterThunk and a native
+    // profiler sees a single symbol for all of them. Under -PerfMap or -PerfJitDump, each function body gets its own
+    // small thunk instead, listed under the function's name for Linux perf. The thunk copies the function, call info
+    // and arguments, calls InterpreterThunk with them and keeps its frame on the stack meanwhile, so a frame pointer
+    // based call graph shows the script function's name between its native caller and the interpreter.
+    //
+    // Thunks are never reused while the thread context lives, so an address in the map always names the same function.
+    class PerfMapInterpreterThunkEmitter
+    {
+    public:
+        static const uint ThunkSize = 48;
+        static const uint BlockSize = 64 * 1024;
+
+        PerfMapInterpreterThunkEmitter(bool useJitDump);
+        ~PerfMapInterpreterThunkEmitter();
+
+        static PerfMapInterpreterThunkEmitter * New(bool useJitDump);
+        static void Delete(PerfMapInterpreterThunkEmitter *emitter);
+
+        // Returns nullptr if no thunk could be allocated; the function then keeps the shared InterpreterThunk.
+        JavascriptMethod GetNextThunk(FunctionBody *functionBody);
+
+    private:
+        struct ThunkBlock
+        {
+            ThunkBlock *next;
+            BYTE *code;
+            BYTE *unwindInfo;
+            uint thunkCount;
+        };
+
+        static const BYTE Thunk[];
+        static const uint ThunkTargetOffset = 35;
+        static const uint UnwindInfoSize = 64;
+
+        ThunkBlock * AllocateBlock();
+        static void WriteUnwindInfo(BYTE *buffer, BYTE *code, size_t codeSize);
+        static void LogThunk(BYTE *thunk, FunctionBody *functionBody);
+
+    private:
+        ThunkBlock *blocks;
+        bool isPerfMapOpen;
+    };
+}
+#endif
@@ -17,6 +17,11 @@ namespace Js
         scriptContext(scriptContext),
         parseTree(nullptr),
         parser(nullptr),
+#if ENABLE_PARALLEL_MODULE_PARSING
+        parserPageAllocator(nullptr),
+        isParsePending(false),
+        isAwaitingSource(false),
+#endif
         pSourceInfo(nullptr),
         rootFunction(nullptr),
         requestedModuleList(nullptr),
@@ -80,6 +85,30 @@ namespace Js
                 parser = nullptr;
             }
         }
+#if ENABLE_PARALLEL_MODULE_PARSING
+        if (parserPageAllocator != nullptr)
+        {
+            HeapDelete(parserPageAllocator);
+            parserPageAllocator = nullptr;
+        }
+#endif
+    }
+
+    void SourceTextModuleRecord::ReleaseParser()
+    {
+        this->parseTree = nullptr;
+        if (this->parser != nullptr)
+        {
+            AllocatorDelete(ArenaAllocator, scriptContext->GeneralAllocator(), this->parser);
+            this->parser = nullptr;
+        }
+#if ENABLE_PARALLEL_MODULE_PARSING
+        if (this->parserPageAllocator != nullptr)
+        {
+            HeapDelete(this->parserPageAllocator);
+            this->parserPageAllocator = nullptr;
+        }
+#endif
     }
 
     HRESULT SourceTextModuleRecord::ParseSource(__in_bcount(sourceLength) byte* sourceText, uint32 sourceLength, SRCINFO * srcInfo, Var* exceptionVar, bool isUtf8)
@@ -89,12 +118,18 @@ namespace Js
         HRESULT hr = NOERROR;
         ScriptContext* scriptContext = GetScriptContext();
         CompileScriptException se;
-        ArenaAllocator* allocator = scriptContext->GeneralAllocator();
         *exceptionVar = nullptr;
         if (!scriptContext->GetConfig()->IsES6ModuleEnabled())
         {
             return E_NOTIMPL;
         }
+#if ENABLE_PARALLEL_MODULE_PARSING
+        BackgroundModuleParser* backgroundModuleParser = scriptContext->GetBackgroundModuleParser();
+        if (backgroundModuleParser != nullptr)
+        {
+            backgroundModuleParser->OnModuleSourceReceived(this);
+        }
+#endif
         // Host indicates that the current module failed to load.
         if (sourceText == nullptr)
         {
@@ -106,47 +141,71 @@ namespace Js
         }
         else
         {
-            try
+            srcInfo->moduleID = moduleId;
+#if ENABLE_PARALLEL_MODULE_PARSING
+            if (isUtf8 && TryParseSourceInBackground(sourceText, sourceLength, srcInfo))
             {
-                AUTO_NESTED_HANDLED_EXCEPTION_TYPE((ExceptionType)(ExceptionType_OutOfMemory | ExceptionType_StackOverflow));
-                this->parser = (Parser*)AllocatorNew(ArenaAllocator, allocator, Parser, scriptContext);
-                srcInfo->moduleID = moduleId;
-
-                LoadScriptFlag loadScriptFlag = (LoadScriptFlag)(LoadScriptFlag_Expression | LoadScriptFlag_Module |
-                    (isUtf8 ? LoadScriptFlag_Utf8Source : LoadScriptFlag_None));
-                this->parseTree = scriptContext->ParseScript(parser, sourceText, sourceLength, srcInfo, &se, &pSourceInfo, _u("module"), loadScriptFlag, &sourceIndex);
-                if (parseTree == nullptr)
-                {
-                    hr = E_FAIL;
-                }
+                // Syntax errors and the module's imports are processed when the parse tree comes back.
+                backgroundModuleParser->CompleteParsedModules();
+                return NOERROR;
             }
-            catch (Js::OutOfMemoryException)
-            {
-                hr = E_OUTOFMEMORY;
-                se.ProcessError(nullptr, E_OUTOFMEMORY, nullptr);
-            }
-            catch (Js::StackOverflowException)
-            {
-                hr = VBSERR_OutOfStack;
-                se.ProcessError(nullptr, VBSERR_OutOfStack, nullptr);
-            }
-            if (SUCCEEDED(hr))
+#endif
+            hr = ParseSourceInternal(sourceText, sourceLength, srcInfo, isUtf8, &se);
+        }
+        hr = OnParseCompleted(hr, &se, exceptionVar);
+#if ENABLE_PARALLEL_MODULE_PARSING
+        if (backgroundModuleParser != nullptr)
+        {
+            backgroundModuleParser->CompleteParsedModules();
+        }
+#endif
+        return hr;
+    }
+
+    HRESULT SourceTextModuleRecord::ParseSourceInternal(byte* sourceText, uint32 sourceLength, SRCINFO const * srcInfo, bool isUtf8, CompileScriptException* se)
+    {
+        HRESULT hr = NOERROR;
+        ScriptContext* scriptContext = GetScriptContext();
+        ArenaAllocator* allocator = scriptContext->GeneralAllocator();
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE((ExceptionType)(ExceptionType_OutOfMemory | ExceptionType_StackOverflow));
+            this->parser = (Parser*)AllocatorNew(ArenaAllocator, allocator, Parser, scriptContext);
+
+            LoadScriptFlag loadScriptFlag = (LoadScriptFlag)(LoadScriptFlag_Expression | LoadScriptFlag_Module |
+                (isUtf8 ? LoadScriptFlag_Utf8Source : LoadScriptFlag_None));
+            this->parseTree = scriptContext->ParseScript(parser, sourceText, sourceLength, srcInfo, se, &pSourceInfo, _u("module"), loadScriptFlag, &sourceIndex);
+            if (parseTree == nullptr)
             {
-                hr = PostParseProcess();
+                hr = E_FAIL;
             }
         }
+        catch (Js::OutOfMemoryException)
+        {
+            hr = E_OUTOFMEMORY;
+            se->ProcessError(nullptr, E_OUTOFMEMORY, nullptr);
+        }
+        catch (Js::StackOverflowException)
+        {
+            hr = VBSERR_OutOfStack;
+            se->ProcessError(nullptr, VBSERR_OutOfStack, nullptr);
+        }
+        return hr;
+    }
+
+    HRESULT SourceTextModuleRecord::OnParseCompleted(HRESULT hr, CompileScriptException* se, Var* exceptionVar)
+    {
+        if (SUCCEEDED(hr))
+        {
+            hr = PostParseProcess();
+        }
         if (FAILED(hr))
         {
             if (*exceptionVar == nullptr)
             {
-                *exceptionVar = JavascriptError::CreateFromCompileScriptException(scriptContext, &se);
-            }
-            if (this->parser)
-            {
-                this->parseTree = nullptr;
-                AllocatorDelete(ArenaAllocator, allocator, this->parser);
-                this->parser = nullptr;
+                *exceptionVar = JavascriptError::CreateFromCompileScriptException(scriptContext, se);
             }
+            ReleaseParser();
             if (this->errorObject == nullptr)
             {
                 this->errorObject = *exceptionVar;
@@ -156,6 +215,86 @@ namespace Js
         return hr;
     }
 
+#if ENABLE_PARALLEL_MODULE_PARSING
+    bool SourceTextModuleRecord::TryParseSourceInBackground(byte* sourceText, uint32 sourceLength, SRCINFO const * srcInfo)
+    {
+        // The root module is parsed right away so that the host gets its syntax errors back from this call.
+        BackgroundModuleParser* backgroundModuleParser = scriptContext->GetBackgroundModuleParser();
+        if (isRootModule || backgroundModuleParser == nullptr || !backgroundModuleParser->CanParseInBackground(srcInfo->sourceContextInfo))
+        {
+            return false;
+        }
+
+        ModuleParseJob* job = nullptr;
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            ThreadContext* threadContext = scriptContext->GetThreadContext();
+            ULONG grfscr = scriptContext->GetParseFlags((LoadScriptFlag)(LoadScriptFlag_Expression | LoadScriptFlag_Module | LoadScriptFlag_Utf8Source),
+                sourceLength, srcInfo->sourceContextInfo);
+
+            // The host's buffer is only ours for the duration of this call, so the job parses the copy
+            // held by the source info. Its length is fixed up from the parser when the job comes back.
+            this->pSourceInfo = Utf8SourceInfo::New(scriptContext, sourceText, sourceLength, sourceLength, srcInfo, false);
+
+            // The parser's nodes must not come from the thread's page allocator, which isn't ours to use off thread.
+            this->parserPageAllocator = HeapNew(PageAllocator, threadContext->GetAllocationPolicyManager(), Js::Configuration::Global.flags,
+                PageAllocatorType_BGJIT, PageAllocator::DefaultMaxFreePageCount);
+            this->parserPageAllocator->SetDisableThreadAccessCheck();
+            this->parser = (Parser*)AllocatorNew(ArenaAllocator, scriptContext->GeneralAllocator(), Parser, scriptContext, FALSE, parserPageAllocator, true);
+
+            job = HeapNew(ModuleParseJob, backgroundModuleParser, this, this->parser,
+                this->pSourceInfo->GetSource(_u("SourceTextModuleRecord::TryParseSourceInBackground")), sourceLength, grfscr, srcInfo->sourceContextInfo);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            // Leave it to the foreground parse to report.
+            ReleaseParser();
+            this->pSourceInfo = nullptr;
+            return false;
+        }
+
+        this->isParsePending = true;
+        backgroundModuleParser->AddJob(job);
+        return true;
+    }
+
+    void SourceTextModuleRecord::OnBackgroundParseCompleted(ModuleParseJob* job)
+    {
+        Assert(isParsePending);
+        Assert(job->GetModuleRecord() == this);
+        isParsePending = false;
+
+        HRESULT hr = job->GetHR();
+        CompileScriptException* se = job->GetPSE();
+        CompileScriptException foregroundSe;
+        Var exceptionVar = nullptr;
+        this->parser->SetIsBackgroundParser(false);
+
+        if ((SUCCEEDED(hr) && this->parser->HasBackgroundRegExpNode()) || hr == VBSERR_OutOfStack)
+        {
+            // Regex patterns are recycler objects, so the job thread couldn't create them, and job threads may have less
+            // stack than the main thread. Parse the module again here; the source info from the first attempt is reused as is.
+            PHASE_PRINT_TESTTRACE1(Js::ParallelModuleParsePhase, _u("ParallelModuleParse: module reparsed on the main thread\n"));
+            ReleaseParser();
+            se = &foregroundSe;
+            hr = ParseSourceInternal((byte*)pSourceInfo->GetSource(_u("SourceTextModuleRecord::OnBackgroundParseCompleted")),
+                (uint32)pSourceInfo->GetCbLength(_u("SourceTextModuleRecord::OnBackgroundParseCompleted")), pSourceInfo->GetSrcInfo(), true, se);
+        }
+        else if (SUCCEEDED(hr))
+        {
+            PHASE_PRINT_TESTTRACE1(Js::ParallelModuleParsePhase, _u("ParallelModuleParse: module parsed on a job thread\n"));
+            this->parseTree = job->GetParseTree();
+            pSourceInfo->SetParseFlags(job->GetParseFlags());
+            pSourceInfo->SetCchLength(parser->GetSourceIchLim());
+            this->sourceIndex = scriptContext->SaveSourceNoCopy(pSourceInfo, parser->GetSourceIchLim(), /* isCesu8*/ false);
+            scriptContext->AddSourceSize(parser->GetSourceLength());
+        }
+
+        OnParseCompleted(hr, se, &exceptionVar);
+    }
+#endif
+
     void SourceTextModuleRecord::NotifyParentsAsNeeded()
     {
         // Notify the parent modules that this child module is either in fault state or finished.
@@ -571,6 +710,12 @@ namespace Js
                         return true;
                     }
                     moduleRecord = SourceTextModuleRecord::FromHost(moduleRecordBase);
+#if ENABLE_PARALLEL_MODULE_PARSING
+                    if (scriptContext->GetBackgroundModuleParser() != nullptr)
+                    {
+                        scriptContext->GetBackgroundModuleParser()->OnModuleFetched(moduleRecord);
+                    }
+#endif
                     childrenModuleSet->AddNew(moduleName, moduleRecord);
                     if (moduleRecord->parentModuleList == nullptr)
                     {
@@ -7,6 +7,7 @@
 namespace Js
 {
     class SourceTextModuleRecord;
+    struct ModuleParseJob;
     typedef JsUtil::BaseDictionary<LPCOLESTR, SourceTextModuleRecord*, ArenaAllocator, PowerOf2SizePolicy> ChildModuleRecordSet;
     typedef JsUtil::BaseDictionary<SourceTextModuleRecord*, SourceTextModuleRecord*, ArenaAllocator, PowerOf2SizePolicy> ParentModuleRecordSet;
     typedef JsUtil::BaseDictionary<PropertyId, uint, ArenaAllocator, PowerOf2SizePolicy> LocalExportMap;
@@ -52,6 +53,12 @@ namespace Js
 
         bool WasParsed() const { return wasParsed; }
         void SetWasParsed() { wasParsed = true; }
+#if ENABLE_PARALLEL_MODULE_PARSING
+        bool IsParsePending() const { return isParsePending; }
+        bool IsAwaitingSource() const { return isAwaitingSource; }
+        void SetIsAwaitingSource(bool isAwaiting) { isAwaitingSource = isAwaiting; }
+        void OnBackgroundParseCompleted(ModuleParseJob* job);
+#endif
         bool WasDeclarationInitialized() const { return wasDeclarationInitialized; }
         void SetWasDeclarationInitialized() { wasDeclarationInitialized = true; }
         void SetIsRootModule() { isRootModule = true; }
@@ -115,6 +122,11 @@ namespace Js
         Utf8SourceInfo* pSourceInfo;
         uint sourceIndex;
         Parser* parser;  // we'll need to keep the parser around till we are done with bytecode gen.
+#if ENABLE_PARALLEL_MODULE_PARSING
+        PageAllocator* parserPageAllocator;  // backs the parser's nodes when it was handed to a job thread.
+        bool isParsePending;     // the source is being parsed by the background module parser.
+        bool isAwaitingSource;   // fetched for a parent, but the host hasn't called ParseSource yet.
+#endif
         ScriptContext* scriptContext;
         IdentPtrList* requestedModuleList;
         ModuleImportOrExportEntryList* importRecordList;
@@ -143,6 +155,12 @@ namespace Js
 
         ModuleNameRecord namespaceRecord;
 
+        HRESULT ParseSourceInternal(byte* sourceText, uint32 sourceLength, SRCINFO const * srcInfo, bool isUtf8, CompileScriptException* se);
+        HRESULT OnParseCompleted(HRESULT hr, CompileScriptException* se, Var* exceptionVar);
+        void ReleaseParser();
+#if ENABLE_PARALLEL_MODULE_PARSING
+        bool TryParseSourceInBackground(byte* sourceText, uint32 sourceLength, SRCINFO const * srcInfo);
+#endif
         HRESULT PostParseProcess();
         HRESULT PrepareForModuleDeclarationInitialization();
         void ImportModuleListsFromParser();
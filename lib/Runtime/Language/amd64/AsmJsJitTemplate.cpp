@@ -4,13 +4,15 @@
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLanguagePch.h"
 
-#ifndef TEMP_DISABLE_ASMJS
+#if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
 #if DBG_DUMP
     FunctionBody* AsmJsJitTemplate::Globals::CurrentEncodingFunction = nullptr;
 #endif
 
+    // The template JIT only has an x86 emitter (i386/AsmJsJitTemplate.cpp). On amd64, under the Windows and the
+    // System V ABI alike, asm.js functions run in the asm.js interpreter or the full JIT, and never get here.
     void* AsmJsJitTemplate::InitTemplateData()
     {
         __debugbreak();
@@ -2827,6 +2827,7 @@ namespace Js
             return true;
         }
         SparseArraySegment<T>* next = (SparseArraySegment<T>*)GetBeginLookupSegment(itemIndex);
+        uint probeCost = 0;
         while(next != nullptr && next->left <= itemIndex)
         {
             uint32 limit = next->left + next->length;
@@ -2844,6 +2845,20 @@ namespace Js
                 break;
             }
             next = (SparseArraySegment<T>*)next->next;
+            if (!HasSegmentMap())
+            {
+                // Deleting from an array this fragmented is O(segments) without a SegmentMap, same as reading from it
+                probeCost++;
+                if (probeCost > SegmentBTree::GetLazyCrossOverLimit())
+                {
+                    SegmentBTreeRoot * segmentMap = BuildSegmentMap();
+
+                    SparseArraySegmentBase* prevOrMatchSeg;
+                    SparseArraySegmentBase* matchOrNextSeg;
+                    segmentMap->Find(itemIndex, prevOrMatchSeg, matchOrNextSeg);
+                    next = (SparseArraySegment<T>*)(prevOrMatchSeg ? prevOrMatchSeg : matchOrNextSeg);
+                }
+            }
         }
 #ifdef VALIDATE_ARRAY
         ValidateArray();
@@ -5367,6 +5382,7 @@ Case0:
     void JavascriptArray::ShiftHelper(JavascriptArray* pArr, ScriptContext * scriptContext)
     {
         Recycler * recycler = scriptContext->GetRecycler();
+        const bool isSplitHead = IsSplitHeadForShift(pArr->head);
 
         SparseArraySegment<T>* next = (SparseArraySegment<T>*)pArr->head->next;
         while (next)
@@ -5377,7 +5393,32 @@ Case0:
 
         // head and next might overlap as the next segment left is decremented
         next = (SparseArraySegment<T>*)pArr->head->next;
-        if (next && (pArr->head->size > next->left))
+        if (isSplitHead)
+        {
+            // Merging would copy the larger next segment into the head on every shift. The shifted element has left the
+            // head already, so give up the head's last slot instead, and drop the head once next reaches index 0.
+            Assert(pArr->head->size > next->left);
+            AssertMsg(pArr->head->length <= next->left, "Shift left more elements in the head than fit before the next segment");
+
+            if (next->left == 0)
+            {
+                Assert(pArr->head->length == 0);
+                pArr->head = next;
+                pArr->InvalidateLastUsedSegment();
+
+                // Missing values are only tracked in the head segment, so check the one that just became the head
+                if (pArr->HasNoMissingValues())
+                {
+                    pArr->SetHasNoMissingValues(false);
+                    pArr->ScanForMissingValues<T>();
+                }
+            }
+            else
+            {
+                pArr->head->size = next->left;
+            }
+        }
+        else if (next && (pArr->head->size > next->left))
         {
             AssertMsg(pArr->head->left == 0, "Array always points to a head starting at index 0");
             AssertMsg(pArr->head->size == next->left + 1, "Shift next->left overlaps current segment by more than 1 element");
@@ -5426,6 +5467,42 @@ Case0:
 #endif
     }
 
+    // Whether the head is the front that SplitHeadForShift split off: the array's only other segment follows it directly
+    // and is longer than it. Shift gives up the slots of such a head instead of merging the next segment into it.
+    bool JavascriptArray::IsSplitHeadForShift(SparseArraySegmentBase* head)
+    {
+        SparseArraySegmentBase* next = head->next;
+        return next != nullptr &&
+            next->next == nullptr &&
+            next->left == head->left + head->size &&
+            next->length > head->size;
+    }
+
+    template<typename T>
+    void JavascriptArray::SplitHeadForShift(JavascriptArray* pArr, Recycler * recycler)
+    {
+        // Shift moves every element of the head segment down by one. Split a large head so that the following shifts only
+        // move its first elements, while ShiftHelper renumbers the rest. The rest becomes the head again once the front is
+        // used up, so splitting off about the square root of the length keeps the amortized cost of a shift at O(sqrt(n)).
+        SparseArraySegment<T>* head = (SparseArraySegment<T>*)pArr->head;
+        Assert(head->next == nullptr && head->length >= ShiftSplitHeadMinLength);
+
+        uint32 frontLength = 64;
+        while ((uint64)frontLength * frontLength < head->length)
+        {
+            frontLength *= 2;
+        }
+
+        // Both halves of a head without missing values have none, so HasNoMissingValues stays valid for the new head.
+        // Unshift doesn't split a head. On a split head it already only moves the front, which it grows by the unshifted count.
+        pArr->head = head->SplitFront(recycler, frontLength);
+        pArr->InvalidateLastUsedSegment();
+
+#ifdef VALIDATE_ARRAY
+        pArr->ValidateArray();
+#endif
+    }
+
     Var JavascriptArray::EntryShift(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -5458,16 +5535,6 @@ Case0:
                 pArr->FillFromPrototypes(0, pArr->length); // We need find all missing value from [[proto]] object
             }
 
-            if(pArr->HasNoMissingValues() && pArr->head && pArr->head->next)
-            {
-                // This function currently does not track missing values in the head segment if there are multiple segments
-                pArr->SetHasNoMissingValues(false);
-            }
-
-            pArr->length--;
-
-            pArr->ClearSegmentMap(); // Dump segmentMap on shift (before any allocation)
-
             Recycler * recycler = scriptContext->GetRecycler();
 
             bool isIntArray = false;
@@ -5482,6 +5549,34 @@ Case0:
                 isFloatArray = true;
             }
 
+            if (pArr->head->next == nullptr && pArr->head->length >= ShiftSplitHeadMinLength && !pArr->HasSegmentMap())
+            {
+                // Split before changing the length, the allocation may throw
+                if (isIntArray)
+                {
+                    SplitHeadForShift<int32>(pArr, recycler);
+                }
+                else if (isFloatArray)
+                {
+                    SplitHeadForShift<double>(pArr, recycler);
+                }
+                else
+                {
+                    SplitHeadForShift<Var>(pArr, recycler);
+                }
+            }
+
+            if(pArr->HasNoMissingValues() && pArr->head && pArr->head->next && !IsSplitHeadForShift(pArr->head))
+            {
+                // This function currently does not track missing values in the head segment if there are multiple segments,
+                // except for a split head, which ShiftHelper never merges the next segment into
+                pArr->SetHasNoMissingValues(false);
+            }
+
+            pArr->length--;
+
+            pArr->ClearSegmentMap(); // Dump segmentMap on shift (before any allocation)
+
             if (pArr->head->length != 0)
             {
                 if(isIntArray)
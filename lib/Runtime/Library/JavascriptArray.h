@@ -116,6 +116,7 @@ namespace Js
         static uint32 const MaxArrayLength = InvalidIndex;
         static uint32 const MaxInitialDenseLength=1<<18;
         static ushort const MergeSegmentsLengthHeuristics = 128; // If the length is less than MergeSegmentsLengthHeuristics then try to merge the segments
+        static uint32 const ShiftSplitHeadMinLength = 4096; // Shift splits the front off a head segment of at least this length instead of moving all of it
         static uint64 const FiftyThirdPowerOfTwoMinusOne = 0x1FFFFFFFFFFFFF;  // 2^53-1
 
         static const Var MissingItem;
@@ -498,6 +499,10 @@ namespace Js
         template<typename T>
         static void ShiftHelper(JavascriptArray* pArr, ScriptContext * scriptContext);
 
+        template<typename T>
+        static void SplitHeadForShift(JavascriptArray* pArr, Recycler * recycler);
+        static bool IsSplitHeadForShift(SparseArraySegmentBase* head);
+
         template<typename T>
         static void UnshiftHelper(JavascriptArray* pArr, uint32 unshiftElements, Js::Var * elements);
 
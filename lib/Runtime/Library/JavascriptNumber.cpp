@@ -913,7 +913,14 @@ namespace Js
             return string;
         }
 
-        string = scriptContext->GetLastNumberToStringRadix10(value);
+        // Integral values share the strings of the tagged integers
+        int32 intValue;
+        if (TryGetInt32Value(value, &intValue))
+        {
+            return scriptContext->GetIntegerString(intValue);
+        }
+
+        string = scriptContext->GetCachedNumberToStringRadix10(value);
         if (string == nullptr)
         {
             char16 szBuffer[bufSize];
@@ -923,7 +930,7 @@ namespace Js
                 Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
             }
             string = JavascriptString::NewCopySz(szBuffer, scriptContext);
-            scriptContext->SetLastNumberToStringRadix10(value, string);
+            scriptContext->CacheNumberToStringRadix10(value, string);
         }
         return string;
     }
@@ -1015,6 +1015,31 @@ namespace Js
     {
         Assert(object != nullptr);
         Assert(scriptContext != nullptr);
+
+        DynamicObjectPropertyEnumerator enumerator;
+        PropertyString * const * strings;
+        BigPropertyIndex const * indexes;
+        int count;
+        if (TryGetCachedEnumerableProperties(object, EnumeratorFlags::None, scriptContext, &enumerator, &strings, &indexes, &count))
+        {
+            // Nothing here can run script, so the object keeps the type the cache was built for.
+            DynamicObject* dynamicObject = DynamicObject::FromVar(object);
+            JavascriptArray* cachedValuesArray = scriptContext->GetLibrary()->CreateArray(count);
+            for (int i = 0; i < count; i++)
+            {
+                Var value = dynamicObject->GetSlot(indexes[i]);
+                if (!valuesToReturn)
+                {
+                    JavascriptArray* entry = scriptContext->GetLibrary()->CreateArray(2);
+                    entry->DirectSetItemAt(0, strings[i]);
+                    entry->DirectSetItemAt(1, value);
+                    value = entry;
+                }
+                cachedValuesArray->DirectSetItemAt(i, value);
+            }
+            return cachedValuesArray;
+        }
+
         JavascriptArray* valuesArray = scriptContext->GetLibrary()->CreateArray(0);
 
         JavascriptArray* ownKeysResult = JavascriptOperators::GetOwnPropertyNames(object, scriptContext);
@@ -1104,6 +1129,20 @@ namespace Js
 
     JavascriptArray* JavascriptObject::CreateOwnEnumerableStringPropertiesHelper(RecyclableObject* object, ScriptContext* scriptContext)
     {
+        DynamicObjectPropertyEnumerator enumerator;
+        PropertyString * const * strings;
+        BigPropertyIndex const * indexes;
+        int count;
+        if (TryGetCachedEnumerableProperties(object, EnumeratorFlags::None, scriptContext, &enumerator, &strings, &indexes, &count))
+        {
+            JavascriptArray* newArr = scriptContext->GetLibrary()->CreateArray(count);
+            for (int i = 0; i < count; i++)
+            {
+                newArr->DirectSetItemAt(i, strings[i]);
+            }
+            return newArr;
+        }
+
         return CreateKeysHelper(object, scriptContext, FALSE, false, true/*includeStringsOnly*/, false);
     }
 
@@ -1112,6 +1151,36 @@ namespace Js
         return CreateKeysHelper(object, scriptContext, FALSE, true/*includeSymbolsOnly*/, true/*includeStringsOnly*/, false);
     }
 
+    // An object with a path type only has enumerable, writable and configurable data properties, each stored in the slot
+    // with its property index. Its own properties can be taken from the snapshot enumeration cache of its type, shared
+    // with for-in, and their values read straight from the slots.
+    bool JavascriptObject::TryGetCachedEnumerableProperties(RecyclableObject* object, EnumeratorFlags flags, ScriptContext* scriptContext,
+        DynamicObjectPropertyEnumerator* enumerator, PropertyString * const ** strings, BigPropertyIndex const ** indexes, int* count)
+    {
+        if (!CONFIG_FLAG(ObjectBuiltinsUseEnumerationCache) ||
+            object->GetTypeId() != TypeIds_Object ||
+            !VirtualTableInfo<DynamicObject>::HasVirtualTable(object) ||
+            object->GetScriptContext() != scriptContext)
+        {
+            return false;
+        }
+
+        DynamicObject* dynamicObject = DynamicObject::FromVar(object);
+        if (dynamicObject->HasObjectArray() || !dynamicObject->GetDynamicType()->GetTypeHandler()->IsPathTypeHandler())
+        {
+            return false;
+        }
+
+        if (!enumerator->Initialize(dynamicObject, flags | EnumeratorFlags::SnapShotSemantics, scriptContext) ||
+            !enumerator->TryGetCachedProperties(strings, indexes, count))
+        {
+            return false;
+        }
+
+        PHASE_PRINT_TESTTRACE1(Js::EnumerationCachePhase, _u("Own properties taken from the enumeration cache\n"));
+        return true;
+    }
+
     // 9.1.12 [[OwnPropertyKeys]] () in RC#4 dated April 3rd 2015.
     JavascriptArray* JavascriptObject::CreateKeysHelper(RecyclableObject* object, ScriptContext* scriptContext, BOOL includeNonEnumerable, bool includeSymbolProperties, bool includeStringProperties, bool includeSpecialProperties)
     {
@@ -1515,6 +1584,11 @@ namespace Js
 
     void JavascriptObject::AssignForGenericObjects(RecyclableObject* from, RecyclableObject* to, ScriptContext* scriptContext)
     {
+        if (TryAssignForPathTypeObjects(from, to, scriptContext))
+        {
+            return;
+        }
+
         JavascriptStaticEnumerator enumerator;
         if (!from->GetEnumerator(&enumerator, EnumeratorFlags::SnapShotSemantics | EnumeratorFlags::EnumSymbols, scriptContext))
         {
@@ -1555,6 +1629,115 @@ namespace Js
         }
     }
 
+    bool JavascriptObject::TryAssignForPathTypeObjects(RecyclableObject* from, RecyclableObject* to, ScriptContext* scriptContext)
+    {
+        DynamicObjectPropertyEnumerator enumerator;
+        PropertyString * const * strings;
+        BigPropertyIndex const * indexes;
+        int count;
+        if (!TryGetCachedEnumerableProperties(from, EnumeratorFlags::EnumSymbols, scriptContext, &enumerator, &strings, &indexes, &count))
+        {
+            return false;
+        }
+
+        DynamicObject* source = DynamicObject::FromVar(from);
+        if (count == 0 || TryAssignByCopyingType(source, to, strings, count, scriptContext))
+        {
+            return true;
+        }
+
+        DynamicType* sourceType = source->GetDynamicType();
+        Var propValue = nullptr;
+        for (int i = 0; i < count; i++)
+        {
+            PropertyId nextKey = strings[i]->GetPropertyRecord()->GetPropertyId();
+
+            // Setters on the target can change the source; its slots match the cache only while it keeps its type.
+            if (source->GetDynamicType() == sourceType)
+            {
+                propValue = source->GetSlot(indexes[i]);
+            }
+            else if (!JavascriptOperators::GetOwnProperty(from, nextKey, &propValue, scriptContext))
+            {
+                JavascriptError::ThrowTypeError(scriptContext, JSERR_Operand_Invalid_NeedObject, _u("Object.assign"));
+            }
+
+            if (!JavascriptOperators::SetProperty(to, to, nextKey, propValue, scriptContext, PropertyOperationFlags::PropertyOperation_ThrowIfNonWritable))
+            {
+                JavascriptError::ThrowTypeError(scriptContext, JSERR_Operand_Invalid_NeedObject, _u("Object.assign"));
+            }
+        }
+        return true;
+    }
+
+    // Assigning the properties of a path type object to an empty object with the same prototype walks the target down the
+    // source's type path, as long as setting the properties can't run into anything but writable data properties. The
+    // target then simply takes the source's type and a copy of its slots.
+    bool JavascriptObject::TryAssignByCopyingType(DynamicObject* from, RecyclableObject* to, PropertyString * const * strings, int count, ScriptContext* scriptContext)
+    {
+        if (to->GetTypeId() != TypeIds_Object ||
+            !VirtualTableInfo<DynamicObject>::HasVirtualTable(to) ||
+            to->GetScriptContext() != scriptContext ||
+            to->GetPrototype() != from->GetPrototype())
+        {
+            return false;
+        }
+
+        DynamicObject* target = DynamicObject::FromVar(to);
+        DynamicTypeHandler* targetTypeHandler = target->GetDynamicType()->GetTypeHandler();
+        DynamicType* sourceType = from->GetDynamicType();
+        PathTypeHandlerBase* sourceTypeHandler = PathTypeHandlerBase::FromTypeHandler(sourceType->GetTypeHandler());
+
+        if (target->HasObjectArray() ||
+            !targetTypeHandler->IsPathTypeHandler() ||
+            targetTypeHandler->GetPropertyCount() != 0 ||
+            targetTypeHandler->GetIsPrototype() ||
+            !target->IsExtensible() ||
+            targetTypeHandler->GetSlotCapacity() > sourceTypeHandler->GetSlotCapacity() ||
+            targetTypeHandler->GetInlineSlotCapacity() != sourceTypeHandler->GetInlineSlotCapacity() ||
+            targetTypeHandler->GetOffsetOfInlineSlots() != sourceTypeHandler->GetOffsetOfInlineSlots())
+        {
+            return false;
+        }
+
+        // The type must already be shared with other objects, and not carry fixed fields of a singleton instance. Internal
+        // properties (which the enumeration skips) must not be copied along.
+        if (!sourceType->GetIsShared() ||
+            !sourceTypeHandler->GetIsShared() ||
+            sourceTypeHandler->HasSingletonInstance() ||
+            sourceTypeHandler->GetPropertyCount() != count)
+        {
+            return false;
+        }
+
+        if (!JavascriptOperators::CheckIfObjectAndPrototypeChainHasOnlyWritableDataProperties(target))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            // Object.prototype.__proto__ is an accessor that passes for a writable data property.
+            if (strings[i]->GetPropertyRecord()->GetPropertyId() == PropertyIds::__proto__)
+            {
+                return false;
+            }
+        }
+
+        target->EnsureSlots(targetTypeHandler->GetSlotCapacity(), sourceTypeHandler->GetSlotCapacity(), scriptContext, sourceTypeHandler);
+        target->ReplaceType(sourceType);
+        for (int i = 0; i < count; i++)
+        {
+            // The values are the source's own, so there is no fixed field to check them against.
+            target->SetSlot(SetSlotArguments(Constants::NoProperty, i, from->GetSlot(i)));
+        }
+
+#ifdef PROFILE_TYPES
+        scriptContext->assignTypeCopyCount++;
+#endif
+        return true;
+    }
+
     void JavascriptObject::AssignForProxyObjects(RecyclableObject* from, RecyclableObject* to, ScriptContext* scriptContext)
     {
          JavascriptArray *keys = JavascriptOperators::GetOwnEnumerablePropertyNamesSymbols(from, scriptContext);
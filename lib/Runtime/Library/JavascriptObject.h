@@ -112,6 +112,10 @@ namespace Js
     private:
         static void AssignForGenericObjects(RecyclableObject* from, RecyclableObject* to, ScriptContext* scriptContext);
         static void AssignForProxyObjects(RecyclableObject* from, RecyclableObject* to, ScriptContext* scriptContext);
+        static bool TryAssignForPathTypeObjects(RecyclableObject* from, RecyclableObject* to, ScriptContext* scriptContext);
+        static bool TryAssignByCopyingType(DynamicObject* from, RecyclableObject* to, PropertyString * const * strings, int count, ScriptContext* scriptContext);
+        static bool TryGetCachedEnumerableProperties(RecyclableObject* object, EnumeratorFlags flags, ScriptContext* scriptContext,
+            DynamicObjectPropertyEnumerator* enumerator, PropertyString * const ** strings, BigPropertyIndex const ** indexes, int* count);
         static JavascriptArray* CreateKeysHelper(RecyclableObject* object, ScriptContext* scriptContext, BOOL enumNonEnumerable, bool includeSymbolProperties, bool includeStringProperties, bool includeSpecialProperties);
 
         static void ModifyGetterSetterFuncName(const PropertyRecord * propertyRecord, const PropertyDescriptor& descriptor, ScriptContext* scriptContext);
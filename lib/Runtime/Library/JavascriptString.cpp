@@ -8,6 +8,12 @@
 #include "Library/EngineInterfaceObject.h"
 #include "Library/IntlEngineInterfaceExtensionObject.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
 namespace Js
 {
     // White Space characters are defined in ES6 Section 11.2
@@ -1075,14 +1081,9 @@ case_2:
         {
             const char16* searchStr = searchString->GetString();
             const char16* inputStr = pThis->GetString();
-            if (searchLen == 1)
+            if (searchLen <= MaxShortSearchLength)
             {
-                int i = position;
-                for(; i < len && inputStr[i] != *searchStr ; i++);
-                if (i < len)
-                {
-                    result = i;
-                }
+                result = IndexOfShortString(inputStr, len, searchStr, searchLen, position);
             }
             else
             {
@@ -1173,18 +1174,9 @@ case_2:
         {
             return JavascriptNumber::ToVar(position, scriptContext);
         }
-        else if (searchLen == 1)
+        else if (searchLen <= MaxShortSearchLength)
         {
-            char16 const * current = inputStr + min(position,len - 1);
-            while (*current != *searchStr)
-            {
-                current--;
-                if (current < inputStr)
-                {
-                    return JavascriptNumber::ToVar(result, scriptContext); //return -1
-                }
-            }
-            result =  (int)(current - inputStr);
+            result = LastIndexOfShortString(inputStr, len, searchStr, searchLen, position);
             return JavascriptNumber::ToVar(result, scriptContext);
         }
 
@@ -3428,6 +3420,110 @@ case_2:
         return ((p >= inputStr) ? (int)(p - inputStr) : -1);
     }
 
+    // Searches for strings too short to pay for a Boyer-Moore table. A candidate position has to match both the first and
+    // the last character of the search string before the rest is compared; with SSE2, eight candidates are filtered at once.
+    // Only whole blocks that end within the input are loaded, and the scalar loop takes the remaining candidates.
+    int JavascriptString::IndexOfShortString(const char16* inputStr, int len, const char16* searchStr, int searchLen, int position)
+    {
+        Assert(searchLen >= 1 && searchLen <= MaxShortSearchLength);
+        Assert(position >= 0);
+
+        if (len - searchLen < position)
+        {
+            return -1;
+        }
+
+        const char16 searchFirst = searchStr[0];
+        const char16 searchLast = searchStr[searchLen - 1];
+        char16 const * p = inputStr + position;
+        char16 const * const end = inputStr + len - searchLen + 1; // one past the last candidate
+
+#if defined(_M_IX86) || defined(_M_X64)
+        const ptrdiff_t unitsPerBlock = sizeof(__m128i) / sizeof(char16);
+        const __m128i firstBlock = _mm_set1_epi16((short)searchFirst);
+        const __m128i lastBlock = _mm_set1_epi16((short)searchLast);
+        while (end - p >= unitsPerBlock)
+        {
+            __m128i matchFirst = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), firstBlock);
+            __m128i matchLast = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + searchLen - 1)), lastBlock);
+            int mask = _mm_movemask_epi8(_mm_and_si128(matchFirst, matchLast));
+            while (mask != 0)
+            {
+                DWORD bit;
+                _BitScanForward(&bit, mask);
+                char16 const * candidate = p + bit / sizeof(char16);
+                if (wmemcmp(candidate + 1, searchStr + 1, searchLen - 1) == 0)
+                {
+                    return (int)(candidate - inputStr);
+                }
+                mask &= ~(3 << bit); // both bytes of the candidate's character
+            }
+            p += unitsPerBlock;
+        }
+#endif
+
+        for (; p < end; p++)
+        {
+            if (*p == searchFirst && p[searchLen - 1] == searchLast && wmemcmp(p + 1, searchStr + 1, searchLen - 1) == 0)
+            {
+                return (int)(p - inputStr);
+            }
+        }
+        return -1;
+    }
+
+    // The same filter as IndexOfShortString, going backwards from the candidate at position.
+    int JavascriptString::LastIndexOfShortString(const char16* inputStr, int len, const char16* searchStr, int searchLen, int position)
+    {
+        Assert(searchLen >= 1 && searchLen <= MaxShortSearchLength);
+        Assert(position >= 0);
+
+        if (len < searchLen)
+        {
+            return -1;
+        }
+
+        const char16 searchFirst = searchStr[0];
+        const char16 searchLast = searchStr[searchLen - 1];
+        char16 const * p = inputStr + min(position, len - searchLen) + 1; // one past the last candidate
+
+#if defined(_M_IX86) || defined(_M_X64)
+        const ptrdiff_t unitsPerBlock = sizeof(__m128i) / sizeof(char16);
+        const __m128i firstBlock = _mm_set1_epi16((short)searchFirst);
+        const __m128i lastBlock = _mm_set1_epi16((short)searchLast);
+        while (p - inputStr >= unitsPerBlock)
+        {
+            char16 const * block = p - unitsPerBlock;
+            __m128i matchFirst = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), firstBlock);
+            __m128i matchLast = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + searchLen - 1)), lastBlock);
+            int mask = _mm_movemask_epi8(_mm_and_si128(matchFirst, matchLast));
+            while (mask != 0)
+            {
+                DWORD bit;
+                _BitScanReverse(&bit, mask);
+                uint32 index = bit / sizeof(char16);
+                char16 const * candidate = block + index;
+                if (wmemcmp(candidate + 1, searchStr + 1, searchLen - 1) == 0)
+                {
+                    return (int)(candidate - inputStr);
+                }
+                mask &= ~(3 << (index * sizeof(char16))); // both bytes of the candidate's character
+            }
+            p = block;
+        }
+#endif
+
+        while (p > inputStr)
+        {
+            p--;
+            if (*p == searchFirst && p[searchLen - 1] == searchLast && wmemcmp(p + 1, searchStr + 1, searchLen - 1) == 0)
+            {
+                return (int)(p - inputStr);
+            }
+        }
+        return -1;
+    }
+
     bool JavascriptString::BuildLastCharForwardBoyerMooreTable(JmpTable jmpTable, const char16* searchStr, int searchLen)
     {
         AssertMsg(searchLen >= 1, "Table for non-empty string");
@@ -3497,6 +3593,16 @@ case_2:
         uint stringLen = stringLenOrig - start;
         uint substringLen = substring->GetLength();
 
+        if (substringLen != 0 && substringLen <= MaxShortSearchLength)
+        {
+            if (start > stringLenOrig)
+            {
+                return (uint)-1;
+            }
+            int result = IndexOfShortString(stringOrig, stringLenOrig, substringSz, substringLen, start);
+            return result != -1 ? result : (uint)-1;
+        }
+
         if (useBoyerMoore && substringLen > 2)
         {
             JmpTable jmpTable;
@@ -147,6 +147,8 @@ namespace Js
         static bool LessThan(Var aLeft, Var aRight);
         static bool IsNegZero(JavascriptString *string);
 
+        static const int MaxShortSearchLength = 32; // Longer search strings are worth building a Boyer-Moore table for
+
         static uint strstr(JavascriptString *string, JavascriptString *substring, bool useBoyerMoore, uint start=0);
         static int strcmp(JavascriptString *string1, JavascriptString *string2);
 
@@ -162,6 +164,8 @@ namespace Js
         static int LastIndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static bool BuildLastCharForwardBoyerMooreTable(JmpTable jmpTable, const char16* searchStr, int searchLen);
         static bool BuildFirstCharBackwardBoyerMooreTable(JmpTable jmpTable, const char16* searchStr, int searchLen);
+        static int IndexOfShortString(const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
+        static int LastIndexOfShortString(const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static charcount_t ConvertToIndex(Var varIndex, ScriptContext *scriptContext);
 
         template <typename T, bool copyBuffer>
@@ -60,6 +60,7 @@ namespace Js
         SparseArraySegment<T>* GrowByMin(Recycler *recycler, uint32 minValue);
         SparseArraySegment<T>* GrowByMinMax(Recycler *recycler, uint32 minValue, uint32 maxValue);
         SparseArraySegment<T>* GrowFrontByMax(Recycler *recycler, uint32 n);
+        SparseArraySegment<T>* SplitFront(Recycler *recycler, uint32 n);
 
         void ReverseSegment(Recycler *recycler);
         void    Truncate(uint32 index);
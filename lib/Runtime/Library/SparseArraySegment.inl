@@ -489,6 +489,28 @@ namespace Js
         return newSeg;
     }
 
+    // Moves the first n elements into a new segment in front of this one, which is renumbered to start after them.
+    // The new segment always has a next pointer, so it is never a leaf.
+    template<typename T>
+    SparseArraySegment<T>* SparseArraySegment<T>::SplitFront(Recycler *recycler, uint32 n)
+    {
+        Assert(length <= size);
+        Assert(n > 0);
+        Assert(n < length);
+
+        SparseArraySegment<T> *newSeg = Allocate<false>(recycler, left, n, n, n);
+        js_memcpy_s(newSeg->elements, sizeof(T) * n, this->elements, sizeof(T) * n);
+
+        memmove(this->elements, this->elements + n, sizeof(T) * (length - n));
+        ClearElements(this->elements + length - n, n);
+        left += n;
+        length -= n;
+        EnsureSizeInBound();
+
+        newSeg->next = this;
+        return newSeg;
+    }
+
     template<typename T>
     void SparseArraySegment<T>::ClearElements(__out_ecount(len) T* elements, uint32 len)
     {
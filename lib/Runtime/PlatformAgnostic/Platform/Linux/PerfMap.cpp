@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "Common.h"
+#include "ChakraPlatform.h"
+#include "PlatformAgnostic/PerfMap.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace PlatformAgnostic
+{
+    // See tools/perf/Documentation/jitdump-specification.txt in the Linux sources.
+    static const uint32 JitDumpMagic = 0x4A695444;
+    static const uint32 JitDumpVersion = 1;
+    static const uint32 JitCodeLoad = 0;
+    static const uint32 ElfMachineX64 = 62;
+
+    struct JitDumpHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 totalSize;
+        uint32 elfMachine;
+        uint32 pad1;
+        uint32 pid;
+        uint64 timestamp;
+        uint64 flags;
+    };
+
+    struct JitDumpCodeLoadRecord
+    {
+        uint32 id;
+        uint32 totalSize;
+        uint64 timestamp;
+        uint32 pid;
+        uint32 tid;
+        uint64 vma;
+        uint64 codeAddress;
+        uint64 codeSize;
+        uint64 codeIndex;
+        // Followed by the null terminated name and a copy of the code.
+    };
+
+    static pthread_mutex_t perfMapLock = PTHREAD_MUTEX_INITIALIZER;
+    static bool perfMapIsOpen = false;
+    static int perfMapFile = -1;
+    static PerfMap::Format perfMapFormat = PerfMap::Format_PerfMap;
+    static uint64 jitDumpCodeIndex = 0;
+
+    static uint64 GetJitDumpTimestamp()
+    {
+        // perf record -k mono samples with the same clock.
+        struct timespec now;
+        if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+        {
+            return 0;
+        }
+        return (uint64)now.tv_sec * 1000000000 + now.tv_nsec;
+    }
+
+    static bool WriteAll(int file, const void *buffer, size_t size)
+    {
+        const char *current = (const char *)buffer;
+        while (size != 0)
+        {
+            ssize_t written = write(file, current, size);
+            if (written <= 0)
+            {
+                return false;
+            }
+            current += written;
+            size -= written;
+        }
+        return true;
+    }
+
+    static int OpenJitDump()
+    {
+        char fileName[64];
+        sprintf_s(fileName, sizeof(fileName), "jit-%u.dump", (uint32)GetCurrentProcessId());
+        int file = open(fileName, O_CREAT | O_TRUNC | O_RDWR, 0666);
+        if (file == -1)
+        {
+            return -1;
+        }
+
+        // perf record only learns about the dump through this executable mapping of it, which must stay alive.
+        long pageSize = sysconf(_SC_PAGESIZE);
+        void *marker = mmap(nullptr, pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, file, 0);
+        if (marker == MAP_FAILED)
+        {
+            close(file);
+            return -1;
+        }
+
+        JitDumpHeader header = {};
+        header.magic = JitDumpMagic;
+        header.version = JitDumpVersion;
+        header.totalSize = sizeof(header);
+        header.elfMachine = ElfMachineX64;
+        header.pid = (uint32)GetCurrentProcessId();
+        header.timestamp = GetJitDumpTimestamp();
+        if (!WriteAll(file, &header, sizeof(header)))
+        {
+            munmap(marker, pageSize);
+            close(file);
+            return -1;
+        }
+        return file;
+    }
+
+    static int OpenPerfMap()
+    {
+        char fileName[64];
+        sprintf_s(fileName, sizeof(fileName), "/tmp/perf-%u.map", (uint32)GetCurrentProcessId());
+        return open(fileName, O_CREAT | O_TRUNC | O_WRONLY, 0666);
+    }
+
+    bool PerfMap::EnsureOpen(Format format)
+    {
+        pthread_mutex_lock(&perfMapLock);
+        if (!perfMapIsOpen)
+        {
+            perfMapIsOpen = true;
+            perfMapFormat = format;
+            perfMapFile = format == Format_JitDump ? OpenJitDump() : OpenPerfMap();
+        }
+        bool isOpen = perfMapFile != -1;
+        pthread_mutex_unlock(&perfMapLock);
+        return isOpen;
+    }
+
+    void PerfMap::LogCodeLoad(const void *address, size_t size, const char *name)
+    {
+        pthread_mutex_lock(&perfMapLock);
+        if (perfMapFile != -1)
+        {
+            if (perfMapFormat == Format_JitDump)
+            {
+                size_t nameSize = strlen(name) + 1;
+                JitDumpCodeLoadRecord record;
+                record.id = JitCodeLoad;
+                record.totalSize = (uint32)(sizeof(record) + nameSize + size);
+                record.timestamp = GetJitDumpTimestamp();
+                record.pid = (uint32)GetCurrentProcessId();
+                record.tid = (uint32)GetCurrentThreadId();
+                record.vma = (uint64)address;
+                record.codeAddress = (uint64)address;
+                record.codeSize = size;
+                record.codeIndex = jitDumpCodeIndex++;
+
+                WriteAll(perfMapFile, &record, sizeof(record));
+                WriteAll(perfMapFile, name, nameSize);
+                WriteAll(perfMapFile, address, size);
+            }
+            else
+            {
+                char line[48];
+                int length = sprintf_s(line, sizeof(line), "%llx %llx ", (unsigned long long)address, (unsigned long long)size);
+                WriteAll(perfMapFile, line, length);
+                WriteAll(perfMapFile, name, strlen(name));
+                WriteAll(perfMapFile, "\n", 1);
+            }
+        }
+        pthread_mutex_unlock(&perfMapLock);
+    }
+} // namespace PlatformAgnostic
@@ -148,6 +148,8 @@ namespace Js
     class JavascriptNumberObject;
     
     class ScriptContextProfiler;
+    class SamplingProfiler;
+    class HeapSnapshotWriter;
 
     struct RestrictedErrorStrings;
     class JavascriptError;
@@ -234,6 +236,7 @@ namespace Js
     struct InterpreterStackFrame;
     struct ScriptEntryExitRecord;
     class JavascriptStackWalker;
+    class PerfMapInterpreterThunkEmitter;
     struct AsmJsCallStackLayout;
     class JavascriptCallStackLayout;
     class Throw;
@@ -502,6 +505,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 
 #include "Language/ModuleRecordBase.h"
 #include "Language/SourceTextModuleRecord.h"
+#include "Language/BackgroundModuleParser.h"
 //#include "Language/ModuleNamespace.h"
 #include "Types/ScriptFunctionType.h"
 #include "Library/ScriptFunction.h"
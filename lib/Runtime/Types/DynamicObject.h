@@ -60,7 +60,9 @@ namespace Js
         friend class JavascriptLibrary;  // for ReplaceType
         friend class ScriptFunction; // for ReplaceType;
         friend class JSON::JSONParser; //for ReplaceType
+        friend class JavascriptObject; // for ReplaceType
         friend class ModuleNamespace; // for slot setting.
+        friend class HeapSnapshotWriter; // for auxSlots
 
 #if ENABLE_OBJECT_SOURCE_TRACKING
     public:
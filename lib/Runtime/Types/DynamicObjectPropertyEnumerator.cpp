@@ -56,9 +56,17 @@ namespace Js
             {
                 ScriptContext* scriptContext = this->object->GetScriptContext();
                 ThreadContext * threadContext = scriptContext->GetThreadContext();
-                CachedData * data = (CachedData *)threadContext->GetDynamicObjectEnumeratorCache(this->initialType);
+                CachedData * firstData = (CachedData *)threadContext->GetDynamicObjectEnumeratorCache(this->initialType);
 
-                if (data == nullptr || data->scriptContext != this->requestContext || data->enumNonEnumerable != GetEnumNonEnumerable() || data->enumSymbols != GetEnumSymbols())
+                // Keep one entry per set of flags, so that for example Object.assign, which includes symbols, and for-in
+                // don't keep replacing each other's entry for the same type. The entries are only kept for one request context.
+                CachedData * data = firstData;
+                while (data != nullptr && (data->scriptContext != this->requestContext || data->enumNonEnumerable != GetEnumNonEnumerable() || data->enumSymbols != GetEnumSymbols()))
+                {
+                    data = data->next;
+                }
+
+                if (data == nullptr)
                 {
                     data = RecyclerNewStructPlus(scriptContext->GetRecycler(),
                         this->initialPropertyCount * sizeof(PropertyString *) + this->initialPropertyCount * sizeof(BigPropertyIndex) + this->initialPropertyCount * sizeof(PropertyAttributes), CachedData);
@@ -70,7 +78,10 @@ namespace Js
                     data->completed = false;
                     data->enumNonEnumerable = GetEnumNonEnumerable();
                     data->enumSymbols = GetEnumSymbols();
+                    data->cachedAllProperties = false;
+                    data->next = firstData != nullptr && firstData->scriptContext == this->requestContext ? firstData : nullptr;
                     threadContext->AddDynamicObjectEnumeratorCache(this->initialType, data);
+                    PHASE_PRINT_TESTTRACE1(Js::EnumerationCachePhase, _u("Enumeration cache entry created %s symbols\n"), GetEnumSymbols() ? _u("with") : _u("without"));
                 }
                 this->cachedData = data;
                 this->cachedDataType = this->initialType;
@@ -147,6 +158,7 @@ namespace Js
             else
             {
                 cachedData->completed = true;
+                cachedData->cachedAllProperties = (propertyStringName == nullptr);
             }
         }
         else
@@ -213,4 +225,29 @@ namespace Js
         }
         return nullptr;
     }
-}
\ No newline at end of file
+
+    bool DynamicObjectPropertyEnumerator::TryGetCachedProperties(PropertyString * const ** strings, BigPropertyIndex const ** indexes, int * count)
+    {
+        if (this->object == nullptr || this->cachedData == nullptr || this->cachedDataType != this->object->GetDynamicType())
+        {
+            return false;
+        }
+
+        // Fill the rest of the cache; the properties already in it are just stepped over.
+        PropertyId propertyId;
+        while (!cachedData->completed)
+        {
+            MoveAndGetNextWithCache(propertyId, nullptr);
+        }
+
+        if (!cachedData->cachedAllProperties)
+        {
+            return false;
+        }
+
+        *strings = cachedData->strings;
+        *indexes = cachedData->indexes;
+        *count = cachedData->cachedCount;
+        return true;
+    }
+}
@@ -29,6 +29,8 @@ namespace Js
             bool completed;
             bool enumNonEnumerable;
             bool enumSymbols;
+            bool cachedAllProperties;   // completed at the end of the properties, not at one we could not cache
+            CachedData * next;          // entry for the same type with other flags
         } *cachedData;
 
         DynamicType * GetTypeToEnumerate() const;
@@ -50,6 +52,10 @@ namespace Js
         void Clear();
         Var MoveAndGetNext(PropertyId& propertyId, PropertyAttributes * attributes);
 
+        // Completes the type's snapshot cache and returns the names and property indexes of all the properties the
+        // enumerator would yield. Returns false if there is no cache for the object's type or it can't hold them all.
+        bool TryGetCachedProperties(PropertyString * const ** strings, BigPropertyIndex const ** indexes, int * count);
+
         static uint32 GetOffsetOfCachedDataType() { return offsetof(DynamicObjectPropertyEnumerator, cachedDataType); }
         static uint32 GetOffsetOfObject() { return offsetof(DynamicObjectPropertyEnumerator, object); }
         static uint32 GetOffsetOfObjectIndex() { return offsetof(DynamicObjectPropertyEnumerator, objectIndex); }
@@ -301,9 +301,6 @@ namespace Js
 
     BOOL PathTypeHandlerBase::DeleteProperty(DynamicObject* instance, PropertyId propertyId, PropertyOperationFlags flags)
     {
-#ifdef PROFILE_TYPES
-        instance->GetScriptContext()->convertPathToDictionaryCount2++;
-#endif
         // Check numeric propertyId only if objectArray available
         ScriptContext* scriptContext = instance->GetScriptContext();
         uint32 indexVal;
@@ -312,9 +309,76 @@ namespace Js
             return PathTypeHandlerBase::DeleteItem(instance, indexVal, flags);
         }
 
+        PropertyIndex index = PathTypeHandlerBase::GetPropertyIndex(propertyId);
+        if (index == Constants::NoSlot)
+        {
+            // Nothing to delete; don't give up the path type for it.
+            return true;
+        }
+
+        if (TryDeleteLastProperty(instance, propertyId, index))
+        {
+            return true;
+        }
+
+#ifdef PROFILE_TYPES
+        scriptContext->convertPathToDictionaryCount2++;
+#endif
         return  ConvertToSimpleDictionaryType(instance, GetPathLength())->DeleteProperty(instance, propertyId, flags);
     }
 
+    bool PathTypeHandlerBase::TryDeleteLastProperty(DynamicObject* instance, PropertyId propertyId, PropertyIndex index)
+    {
+        // Deleting the property added last (the common "add a temporary field, then delete it" pattern) takes the
+        // object back to the type it had before the property was added, instead of converting it to a dictionary
+        // type. All properties on a path type are configurable data properties, so the delete itself can't fail.
+        if (!CONFIG_FLAG(DeleteLastPropertyOnPathTypes) || index != GetPathLength() - 1 || predecessorType == nullptr)
+        {
+            return false;
+        }
+
+        // Prototypes have types of their own, and the predecessor may be shared with any number of other objects.
+        if (GetIsPrototype())
+        {
+            return false;
+        }
+
+        DynamicTypeHandler * predecessorTypeHandler = predecessorType->GetTypeHandler();
+        if (!predecessorTypeHandler->IsPathTypeHandler() ||
+            PathTypeHandlerBase::FromTypeHandler(predecessorTypeHandler)->GetPathLength() != index ||
+            predecessorType->GetPrototype() != instance->GetPrototype())
+        {
+            return false;
+        }
+
+        // The slots stay where they are, so the predecessor must lay them out the same way.
+        if (predecessorTypeHandler->GetSlotCapacity() != GetSlotCapacity() ||
+            predecessorTypeHandler->GetInlineSlotCapacity() != GetInlineSlotCapacity() ||
+            predecessorTypeHandler->GetOffsetOfInlineSlots() != GetOffsetOfInlineSlots())
+        {
+            return false;
+        }
+
+        // A type that isn't shared yet may carry fixed field assumptions about the one instance that reached it.
+        if (!predecessorType->GetIsShared() || !predecessorTypeHandler->GetIsShared())
+        {
+            return false;
+        }
+
+        ScriptContext* scriptContext = instance->GetScriptContext();
+        InvalidateFixedFieldAt(propertyId, index, scriptContext);
+        SetSlotUnchecked(instance, index, scriptContext->GetLibrary()->GetUndefined());
+
+        ReplaceInstanceType(instance, predecessorType);
+        SetPropertyUpdateSideEffect(instance, propertyId, nullptr, SideEffects_Any);
+        PHASE_PRINT_TESTTRACE1(Js::TypeHandlerTransitionPhase, _u("Moving back to the predecessor PathTypeHandler after deleting the last property\n"));
+
+#ifdef PROFILE_TYPES
+        scriptContext->pathDeleteLastPropertyCount++;
+#endif
+        return true;
+    }
+
     BOOL PathTypeHandlerBase::IsFixedProperty(const DynamicObject* instance, PropertyId propertyId)
     {
         if (!FixPropsOnPathTypes())
@@ -163,6 +163,8 @@ namespace Js
 
         DynamicType* PromoteType(DynamicObject* instance, const PropertyRecord* propertyId, PropertyIndex* propertyIndex);
 
+        bool TryDeleteLastProperty(DynamicObject* instance, PropertyId propertyId, PropertyIndex index);
+
         DictionaryTypeHandler* ConvertToDictionaryType(DynamicObject* instance);
         ES5ArrayTypeHandler* ConvertToES5ArrayType(DynamicObject* instance);
 
@@ -202,6 +204,7 @@ namespace Js
     public:
         virtual void ShrinkSlotAndInlineSlotCapacity(uint16 newInlineSlotCapacity) = 0;
         virtual bool GetMaxPathLength(uint16 * maxPathLength) = 0;
+        bool GetMaxPathLengthFromRoot(uint16 * maxPathLength) { return GetRootPathTypeHandler()->GetMaxPathLength(maxPathLength); }
 
 #if ENABLE_TTD
     public:
@@ -58,7 +58,7 @@ namespace Js
         template <typename TPropertyIndex, typename TMapKey, bool IsNotExtensibleSupported> friend class SimpleDictionaryTypeHandlerBase;
 
         // Explicit non leaf allocator now that the key is non-leaf
-        typedef JsUtil::BaseDictionary<TMapKey, SimpleDictionaryPropertyDescriptor<TPropertyIndex>, RecyclerNonLeafAllocator, DictionarySizePolicy<PowerOf2Policy, 1>, PropertyRecordStringHashComparer, PropertyMapKeyTraits<TMapKey>::template Entry>
+        typedef JsUtil::OpenAddressingDictionary<TMapKey, SimpleDictionaryPropertyDescriptor<TPropertyIndex>, RecyclerNonLeafAllocator, PropertyRecordStringHashComparer, PropertyMapKeyTraits<TMapKey>::template Entry>
             SimplePropertyDescriptorMap;
         typedef SimplePropertyDescriptorMap PropertyDescriptorMapType; // alias used by diagnostics
 
@@ -115,7 +115,7 @@ def CreateBuildTasks = { machine, configTag, buildExtra, testExtra, runCodeAnaly
 }
 
 // Generic task to trigger clang-based cross-plat build tasks
-def CreateXPlatBuildTasks = { machine, platform, configTag, xplatBranch, nonDefaultTaskSetup ->
+def CreateXPlatBuildTasks = { machine, platform, configTag, xplatBranch, buildExtra, testExtra, nonDefaultTaskSetup ->
     [true, false].each { isPR ->
         ['debug', 'test', 'release'].each { buildType ->
             def staticBuildConfigs = [true, false]
@@ -138,8 +138,8 @@ def CreateXPlatBuildTasks = { machine, platform, configTag, xplatBranch, nonDefa
                 def staticFlag = staticBuild ? "--static" : ""
                 def icuFlag = (platform == "osx" ? "--icu=/usr/local/opt/icu4c/include" : "")
                 def compilerPaths = (platform == "osx") ? "" : "--cxx=/usr/bin/clang++-3.8 --cc=/usr/bin/clang-3.8"
-                def buildScript = "bash ./build.sh ${staticFlag} -j=`${numConcurrentCommand}` ${buildFlag} ${compilerPaths} ${icuFlag}"
-                def testScript = "bash test/runtests.sh"
+                def buildScript = "bash ./build.sh ${staticFlag} -j=`${numConcurrentCommand}` ${buildFlag} ${compilerPaths} ${icuFlag} ${buildExtra ?: ''}"
+                def testScript = "bash test/runtests.sh ${testExtra ?: ''}"
 
                 def newJob = job(jobName) {
                     steps {
@@ -282,11 +282,14 @@ if (isXPlatCompatibleBranch) {
     def osString = 'Ubuntu16.04'
 
     // PR and CI checks
-    CreateXPlatBuildTasks(osString, "linux", "ubuntu", branch, null)
+    CreateXPlatBuildTasks(osString, "linux", "ubuntu", branch, null, null, null)
+
+    // SIMD.js is only built on request with clang; build and test it with the PR checks too
+    CreateXPlatBuildTasks(osString, "linux", "ubuntu_simdjs", branch, '--simdjs', '--simdjs', null)
 
     // daily builds
     if (isXPlatDailyBranch) {
-        CreateXPlatBuildTasks(osString, "linux", "daily_ubuntu", branch,
+        CreateXPlatBuildTasks(osString, "linux", "daily_ubuntu", branch, null, null,
             /* nonDefaultTaskSetup */ { newJob, isPR, config ->
                 DailyBuildTaskSetup(newJob, isPR,
                     "Ubuntu ${config}",
@@ -302,11 +305,11 @@ if (isXPlatCompatibleBranch) {
     def osString = 'OSX'
 
     // PR and CI checks
-    CreateXPlatBuildTasks(osString, "osx", "osx", branch, null)
+    CreateXPlatBuildTasks(osString, "osx", "osx", branch, null, null, null)
 
     // daily builds
     if (isXPlatDailyBranch) {
-        CreateXPlatBuildTasks(osString, "osx", "daily_osx", branch,
+        CreateXPlatBuildTasks(osString, "osx", "daily_osx", branch, null, null,
             /* nonDefaultTaskSetup */ { newJob, isPR, config ->
                 DailyBuildTaskSetup(newJob, isPR,
                     "OSX ${config}",
@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Deleting elements from arrays with enough segments to build a segment map on the way.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var segmentCount = 500;
+var stride = 1000;
+
+function testDelete(makeValue) {
+    var a = [];
+    for (var i = segmentCount - 1; i >= 0; i--) {
+        a[i * stride] = makeValue(i);
+        a[i * stride + 1] = makeValue(i + 1);
+    }
+
+    for (var i = segmentCount - 1; i >= 0; i -= 3) {
+        assert.isTrue(delete a[i * stride + 1], "Delete element " + (i * stride + 1));
+    }
+    assert.isTrue(delete a[7], "Delete a hole");
+
+    for (var i = 0; i < segmentCount; i++) {
+        var deleted = (segmentCount - 1 - i) % 3 == 0;
+        assert.areEqual(makeValue(i), a[i * stride], "Element " + (i * stride));
+        assert.areEqual(deleted ? undefined : makeValue(i + 1), a[i * stride + 1], "Element " + (i * stride + 1));
+        assert.areEqual(!deleted, (i * stride + 1) in a, "Element " + (i * stride + 1) + " is present");
+    }
+    assert.areEqual((segmentCount - 1) * stride + 2, a.length, "Length");
+
+    delete a[a.length - 1];
+    assert.areEqual((segmentCount - 1) * stride + 2, a.length, "Deleting the last element leaves the length alone");
+
+    var count = 0;
+    a.forEach(function () { count++; });
+    assert.areEqual(segmentCount + segmentCount - Math.ceil(segmentCount / 3), count, "Element count");
+}
+
+var tests = [
+    {
+        name: "Int array",
+        body: function () {
+            testDelete(function (i) { return i; });
+        }
+    },
+    {
+        name: "Float array",
+        body: function () {
+            testDelete(function (i) { return i + 0.5; });
+        }
+    },
+    {
+        name: "Var array",
+        body: function () {
+            testDelete(function (i) { return "s" + i; });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
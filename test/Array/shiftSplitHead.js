@@ -0,0 +1,295 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Shifting from arrays with a large head segment, checked against a model that doesn't use array builtins.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function Model(array) {
+    this.items = {};
+    this.start = 0;
+    this.length = array.length;
+    for (var i = 0; i < array.length; i++) {
+        if (i in array) {
+            this.items[i] = array[i];
+        }
+    }
+}
+
+Model.prototype.has = function (index) {
+    return this.items.hasOwnProperty(this.start + index);
+};
+
+Model.prototype.get = function (index) {
+    return this.items[this.start + index];
+};
+
+Model.prototype.set = function (index, value) {
+    this.items[this.start + index] = value;
+};
+
+Model.prototype.shift = function () {
+    var first = this.get(0);
+    delete this.items[this.start];
+    this.start++;
+    this.length--;
+    return first;
+};
+
+Model.prototype.push = function (value) {
+    this.set(this.length++, value);
+};
+
+Model.prototype.unshift = function (value) {
+    this.start--;
+    this.length++;
+    this.set(0, value);
+};
+
+function compare(array, model) {
+    assert.areEqual(model.length, array.length, "Length");
+    for (var i = 0; i < model.length; i++) {
+        assert.areEqual(model.get(i), array[i], "Element " + i);
+        assert.areEqual(model.has(i), i in array, "Element " + i + " is present");
+    }
+}
+
+function testShift(makeValue, length) {
+    var array = [];
+    for (var i = 0; i < length; i++) {
+        array.push(makeValue(i));
+    }
+    var model = new Model(array);
+
+    for (var i = 0; i < 300; i++) {
+        assert.areEqual(model.shift(), array.shift(), "Shift " + i);
+        if (i % 3 == 0) {
+            array.push(makeValue(length + i));
+            model.push(makeValue(length + i));
+        }
+        if (i % 50 == 0) {
+            array.unshift(makeValue(-i));
+            model.unshift(makeValue(-i));
+        }
+        if (i % 70 == 0) {
+            array[i] = makeValue(i * 7);
+            model.set(i, makeValue(i * 7));
+        }
+    }
+    compare(array, model);
+
+    var copy = array.slice(10, 20);
+    for (var i = 0; i < copy.length; i++) {
+        assert.areEqual(model.get(10 + i), copy[i], "Slice element " + i);
+    }
+    assert.areEqual(model.get(model.length - 1), array.pop(), "Pop");
+    model.length--;
+
+    array.splice(100, 2, makeValue(1), makeValue(2), makeValue(3));
+    assert.areEqual(model.length + 1, array.length, "Length after splice");
+    assert.areEqual(makeValue(3), array[102], "Inserted by splice");
+    assert.areEqual(model.get(102), array[103], "Element after splice");
+
+    array.reverse();
+    assert.areEqual(model.get(0), array[array.length - 1], "Reverse");
+
+    var count = 0;
+    while (array.length > 0) {
+        array.shift();
+        count++;
+    }
+    assert.areEqual(model.length + 1, count, "Shifts to drain the array");
+    assert.areEqual(undefined, array.shift(), "Shift from an empty array");
+}
+
+var tests = [
+    {
+        name: "Int array",
+        body: function () {
+            testShift(function (i) { return i; }, 5000);
+        }
+    },
+    {
+        name: "Float array",
+        body: function () {
+            testShift(function (i) { return i + 0.5; }, 5000);
+        }
+    },
+    {
+        name: "Var array",
+        body: function () {
+            testShift(function (i) { return "s" + i; }, 5000);
+        }
+    },
+    {
+        name: "Large int array",
+        body: function () {
+            testShift(function (i) { return i; }, 20000);
+        }
+    },
+    {
+        name: "Holes in the head, and elements converted to other kinds after the split",
+        body: function () {
+            var holes = [];
+            for (var i = 0; i < 5000; i++) {
+                holes[i] = i;
+            }
+            delete holes[1];
+            delete holes[200];
+            var model = new Model(holes);
+            for (var i = 0; i < 150; i++) {
+                assert.areEqual(model.shift(), holes.shift(), "Shift " + i);
+            }
+            holes[10] = 1.5;
+            model.set(10, 1.5);
+            holes[4000] = "s";
+            model.set(4000, "s");
+            for (var i = 0; i < 150; i++) {
+                assert.areEqual(model.shift(), holes.shift(), "Shift after conversion " + i);
+            }
+            compare(holes, model);
+        }
+    },
+    {
+        name: "Holes are filled from the prototype",
+        body: function () {
+            var fromProto = [];
+            for (var i = 0; i < 5000; i++) {
+                fromProto[i] = i;
+            }
+            delete fromProto[0];
+            delete fromProto[3];
+            Array.prototype[3] = "proto";
+            try {
+                assert.areEqual(undefined, fromProto.shift(), "Shift hole without a prototype element");
+                assert.areEqual(1, fromProto.shift(), "Shift 1");
+                assert.areEqual(2, fromProto.shift(), "Shift 2");
+                assert.areEqual("proto", fromProto.shift(), "Shift hole with a prototype element");
+            } finally {
+                delete Array.prototype[3];
+            }
+            assert.areEqual(4, fromProto.shift(), "Shift 4");
+            assert.areEqual(4995, fromProto.length, "Length");
+        }
+    },
+    {
+        name: "Holes made after the split are seen once the rest becomes the head",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 5000; i++) {
+                array.push(i);
+            }
+            array.shift();
+            delete array[1000];
+            array[4998] = undefined;
+            delete array[4998];
+            var model = new Model(array);
+            for (var i = 0; i < 500; i++) {
+                assert.areEqual(model.shift(), array.shift(), "Shift " + i);
+            }
+            compare(array, model);
+            assert.areEqual(-1, array.indexOf(1001), "indexOf the deleted element");
+            assert.areEqual(array.length - 2, Object.keys(array).length, "Holes are not enumerated");
+        }
+    },
+    {
+        name: "Sparse array with a large head",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 5000; i++) {
+                array.push(i);
+            }
+            array[100000] = "far";
+            array[200000] = "farther";
+            var model = new Model([]);
+            for (var i = 0; i < 5000; i++) {
+                model.set(i, i);
+            }
+            model.set(100000, "far");
+            model.set(200000, "farther");
+            model.length = 200001;
+            for (var i = 0; i < 300; i++) {
+                assert.areEqual(model.shift(), array.shift(), "Shift " + i);
+            }
+            assert.areEqual(model.length, array.length, "Length");
+            assert.areEqual("far", array[100000 - 300], "Far element moved down");
+            assert.areEqual("farther", array[200000 - 300], "Farther element moved down");
+            assert.isFalse((100000 - 301) in array, "Hole before the far element");
+        }
+    },
+    {
+        name: "Sparse array that becomes dense after the split",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 5000; i++) {
+                array.push(i);
+            }
+            array.shift();
+            array[6000] = "far";
+            var model = new Model(array);
+            while (array.length > 1000) {
+                assert.areEqual(model.shift(), array.shift(), "Shift at length " + array.length);
+            }
+            compare(array, model);
+        }
+    },
+    {
+        name: "Multiple adjacent segments",
+        body: function () {
+            var array = [];
+            array[5000] = 0;
+            for (var i = 4999; i >= 0; i -= 1000) {
+                for (var j = i; j > i - 1000; j--) {
+                    array[j] = j;
+                }
+            }
+            var model = new Model(array);
+            while (array.length > 0) {
+                assert.areEqual(model.shift(), array.shift(), "Shift at length " + array.length);
+            }
+            assert.areEqual(0, model.length, "Model drained");
+        }
+    },
+    {
+        name: "Popping the rest shorter than the split head",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 5000; i++) {
+                array.push(i + 0.5);
+            }
+            var model = new Model(array);
+            assert.areEqual(model.shift(), array.shift(), "First shift");
+            while (array.length > 10) {
+                assert.areEqual(model.get(model.length - 1), array.pop(), "Pop at length " + array.length);
+                model.length--;
+            }
+            while (array.length > 0) {
+                assert.areEqual(model.shift(), array.shift(), "Shift at length " + array.length);
+            }
+        }
+    },
+    {
+        name: "Unshift onto a split head",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 5000; i++) {
+                array.push("s" + i);
+            }
+            var model = new Model(array);
+            for (var i = 0; i < 1000; i++) {
+                if (i % 3 == 0) {
+                    array.unshift("u" + i, "v" + i);
+                    model.unshift("v" + i);
+                    model.unshift("u" + i);
+                } else {
+                    assert.areEqual(model.shift(), array.shift(), "Shift " + i);
+                }
+            }
+            compare(array, model);
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
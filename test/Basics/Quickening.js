@@ -0,0 +1,177 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function print(value)
+{
+    WScript.Echo(value);
+}
+
+//
+// The interpreter rewrites Add_A, LdElemI_A, LdFld and StFld into type-specialized forms once it has seen
+// their operand types or inline cache state, and reverts them when that changes. Each function below is called with a stable shape first
+// and then with operands that must fail the specialized form's guard.
+//
+
+function add(a, b)
+{
+    return a + b;
+}
+
+var sum = 0;
+for (var i = 0; i < 100; i++)
+{
+    sum = add(sum, i);
+}
+print(sum);
+print(add(0x3fffffff, 0x3fffffff));
+print(add(0x7fffffff, 1));
+print(add(-0x80000000, -1));
+print(add(1, "2"));
+print(add(1.5, 2));
+print(add({ valueOf: function () { return 40; } }, 2));
+print(add(1, 2));
+
+function sumElements(a)
+{
+    var total = 0;
+    for (var i = 0; i < a.length; i++)
+    {
+        total = total + a[i];
+    }
+    return total;
+}
+
+function load(a, i)
+{
+    return a[i];
+}
+
+var ints = [1, 2, 3, 4, 5];
+var vars = [1, "2", 3, {}, 5];
+print(sumElements(ints));
+print(sumElements(vars));
+print(sumElements(ints));
+
+// Holes and out of bounds indices have to look at the prototype chain
+var holey = [1, , 3];
+Array.prototype[1] = "proto";
+Array.prototype[7] = "protoOutOfBounds";
+print(load(holey, 1));
+print(load(holey, 7));
+print(load(holey, -1));
+print(load(holey, 2));
+delete Array.prototype[1];
+delete Array.prototype[7];
+print(load(holey, 1));
+
+// Native int arrays that get converted while their loads are quickened
+var converted = [10, 20, 30];
+print(load(converted, 1));
+converted[1] = 20.5;
+print(load(converted, 1));
+converted[1] = "twenty";
+print(load(converted, 1));
+
+// Non-array instances and non-int indices after quickening
+print(load([7, 8, 9], 0));
+print(load("abc", 1));
+print(load(new Int32Array([4, 5, 6]), 2));
+print(load({ 0: "object" }, 0));
+print(load([7, 8, 9], "1"));
+print(load([7, 8, 9], 1.5));
+print(load((function () { return arguments; })(11, 12), 1));
+
+var getterArray = [1, 2, 3];
+Object.defineProperty(getterArray, 1, { get: function () { return "getter"; } });
+print(load(getterArray, 1));
+print(load([1, 2, 3], 1));
+
+// Flip a single site between forms often enough to hit the deopt limit
+var mixed = [[1, 2], ["a", "b"], [1.5, 2.5], "xy"];
+var flips = "";
+for (var i = 0; i < 40; i++)
+{
+    flips += load(mixed[i % mixed.length], i % 2);
+}
+print(flips);
+
+// Property loads and stores: monomorphic local slots, shape changes, polymorphic sites, accessors
+function Point(x, y)
+{
+    this.x = x;
+    this.y = y;
+}
+
+function getX(o)
+{
+    return o.x;
+}
+
+function setX(o, v)
+{
+    o.x = v;
+}
+
+var points = [];
+for (var i = 0; i < 10; i++)
+{
+    points.push(new Point(i, -i));
+}
+
+var xs = 0;
+for (var i = 0; i < points.length; i++)
+{
+    setX(points[i], getX(points[i]) * 2);
+    xs += getX(points[i]);
+}
+print(xs);
+
+// Aux slots, a different shape with the same property, and a property deleted from under the cache
+var wide = { a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9, j: 10, k: 11, x: "aux" };
+print(getX(wide));
+print(getX({ y: 1, x: "other shape" }));
+print(getX(points[3]));
+delete points[3].x;
+print(getX(points[3]));
+setX(points[3], "readded");
+print(getX(points[3]));
+
+// Prototype and accessor properties with the same name
+function Proto() {}
+Proto.prototype.x = "from proto";
+print(getX(new Proto()));
+var accessorCalls = 0;
+var withAccessor = { get x() { accessorCalls++; return "getter"; }, set x(v) { accessorCalls++; } };
+print(getX(withAccessor));
+setX(withAccessor, 1);
+print(accessorCalls);
+print(getX(points[4]));
+
+// Non-writable after the store has been quickened
+setX(points[5], "before freeze");
+setX(points[5], "still writable");
+Object.freeze(points[5]);
+setX(points[5], "frozen");
+print(getX(points[5]));
+
+// Polymorphic site
+var shapes = [{ x: 1 }, { a: 0, x: 2 }, { b: 0, x: 3 }, { c: 0, d: 0, x: 4 }, { e: 0, x: 5 }];
+var polySum = 0;
+for (var i = 0; i < 50; i++)
+{
+    polySum += getX(shapes[i % shapes.length]);
+}
+print(polySum);
+print(getX(Object.create(shapes[0])));
+print(getX(1));
+print(getX("str"));
+try
+{
+    getX(undefined);
+}
+catch (e)
+{
+    print(e instanceof TypeError);
+}
@@ -0,0 +1,20 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The first call runs the shared byte code; the private copy is made and quickened from the second call on
+// (-QuickeningThreshold defaults to 2).
+
+function add(a, b)
+{
+    return a + b;
+}
+
+WScript.Echo(add(1, 2));
+WScript.Echo(add(3, 4));
+WScript.Echo(add("a", "b"));
+WScript.Echo(add(5, 6));
+WScript.Echo(add(1.5, 1));
+WScript.Echo(add(7, 8));
+WScript.Echo(add("c", "d"));
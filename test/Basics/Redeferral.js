@@ -0,0 +1,102 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function print(value)
+{
+    WScript.Echo(value);
+}
+
+function collect(count)
+{
+    for (var i = 0; i < count; i++)
+    {
+        CollectGarbage();
+    }
+}
+
+//
+// With -RedeferralInactiveThreshold:1 every function that goes two GCs without being called has its byte code
+// released. Each function below is called, left cold across several GCs and called again, which must reparse it
+// into the same behavior.
+//
+
+function add(a, b)
+{
+    return a + b;
+}
+
+function counter()
+{
+    var count = 0;
+    return function inc(step)
+    {
+        count += step;
+        return count;
+    };
+}
+
+function outer(x)
+{
+    function inner(y)
+    {
+        return x * y;
+    }
+    return inner(x + 1);
+}
+
+function withDefaults(a, b = 10, ...rest)
+{
+    return a + b + rest.length;
+}
+
+function recurse(n)
+{
+    if (n === 0)
+    {
+        // Everything on the stack here must survive the collections
+        collect(4);
+        return 0;
+    }
+    return n + recurse(n - 1);
+}
+
+function callback(values)
+{
+    return values.map(function (v)
+    {
+        collect(2);
+        return v * 2;
+    });
+}
+
+print(add(1, 2));
+var inc = counter();
+print(inc(1));
+print(outer(3));
+print(withDefaults(1));
+print(add.length + " " + withDefaults.length);
+
+collect(4);
+
+print(add(3, 4));
+print(inc(2));
+print(inc(3));
+print(outer(4));
+print(withDefaults(1, 2, 3, 4));
+print(add.length + " " + withDefaults.length);
+
+var inc2 = counter();
+print(inc2(5));
+print(inc(0));
+
+print(recurse(10));
+print(callback([1, 2, 3]).join());
+
+collect(4);
+
+print(recurse(5));
+print(callback([4, 5]).join());
+print(add.toString().indexOf("return a + b") > 0);
+print(new Function("a", "return a * 3;")(7));
@@ -0,0 +1,103 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs with -recyclerStress, so every allocation collects and the redeferral pass runs in the middle of parsing,
+// frame setup and execution.
+
+function print(value)
+{
+    WScript.Echo(value);
+}
+
+function collect(count)
+{
+    for (var i = 0; i < count; i++)
+    {
+        CollectGarbage();
+    }
+}
+
+// Redeferred between its parse and its first call: setting up the frame allocates the scope and the arguments
+// object, and each of those allocations collects.
+function setupAllocates(a, b)
+{
+    var captured = [a, b, arguments.length];
+    function read()
+    {
+        return captured.join("-");
+    }
+    return read();
+}
+
+print(setupAllocates(1, 2));
+collect(4);
+print(setupAllocates(3, 4));
+for (var i = 0; i < 3; i++)
+{
+    collect(2);
+    print(setupAllocates(i, "x"));
+}
+
+// Reparsing a redeferred function recreates the proxies of its nested functions. Closures created before the
+// redeferral, called or not, must keep working next to the ones created after it.
+function makeClosures(base)
+{
+    function called(x)
+    {
+        return base + x;
+    }
+    function neverCalled(x)
+    {
+        return base * x;
+    }
+    var arrow = (x) => called(x) + 1;
+    return [called, neverCalled, arrow];
+}
+
+var before = makeClosures(10);
+print(before[0](1));
+collect(4);
+var after = makeClosures(20);
+print(before[0](2) + " " + before[1](2) + " " + before[2](2));
+print(after[0](3) + " " + after[1](3) + " " + after[2](3));
+collect(4);
+print(before[1](4) + " " + after[1](4));
+print(before[0].name + " " + after[1].name + " " + before[0].length);
+
+// A function with a frame in a live stack trace stays parsed, and the trace keeps its line and column.
+function captureHere()
+{
+    return new Error("captured");
+}
+
+function thrower(n)
+{
+    if (n === 0)
+    {
+        throw new Error("thrown");
+    }
+    thrower(n - 1);
+}
+
+function position(error, line)
+{
+    var match = /RedeferralStress\.js:(\d+):(\d+)/.exec(error.stack);
+    return line ? match[1] : match[1] + ":" + match[2];
+}
+
+var captured = captureHere();
+var thrown;
+try
+{
+    thrower(2);
+}
+catch (e)
+{
+    thrown = e;
+}
+collect(4);
+print(position(captured, false));
+print(position(thrown, true));
+print(captureHere().message + " " + position(captureHere(), false));
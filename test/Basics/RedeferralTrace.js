@@ -0,0 +1,32 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function cold(a)
+{
+    return a + 1;
+}
+
+function capture()
+{
+    return new Error("captured");
+}
+
+function position(error)
+{
+    return /RedeferralTrace\.js:(\d+:\d+)/.exec(error.stack)[1];
+}
+
+WScript.Echo(cold(1));
+var error = capture();
+
+// cold is released after two GCs; capture has a frame in a live stack trace, so it stays
+WScript.Echo("collect");
+CollectGarbage();
+CollectGarbage();
+CollectGarbage();
+WScript.Echo("done");
+
+WScript.Echo(cold(2));
+WScript.Echo(position(error));
@@ -0,0 +1,110 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string conversion in radix 10 gives the shortest digits that round-trip.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var known = [
+    [0.1, "0.1"],
+    [0.3, "0.3"],
+    [0.1 + 0.2, "0.30000000000000004"],
+    [1 / 3, "0.3333333333333333"],
+    [2 / 3, "0.6666666666666666"],
+    [4.35, "4.35"],
+    [5e-324, "5e-324"],
+    [1.5e-323, "1.5e-323"],
+    [2.2250738585072014e-308, "2.2250738585072014e-308"],
+    [1.7976931348623157e308, "1.7976931348623157e+308"],
+    [9007199254740993, "9007199254740992"],
+    [123456789012345680000, "123456789012345680000"],
+    [1e21, "1e+21"],
+    [1e22, "1e+22"],
+    [1e23, "1e+23"],
+    [0.000001, "0.000001"],
+    [1e-7, "1e-7"],
+    [-1.5, "-1.5"],
+    [2147483648, "2147483648"],
+    [-2147483649, "-2147483649"],
+    [4294967295.5, "4294967295.5"],
+    [1.2e-300, "1.2e-300"],
+    [5.0e-310, "5e-310"],
+    [3.14159e200, "3.14159e+200"],
+];
+
+function digitCount(s) {
+    var mantissa = s.replace("-", "").split("e")[0].replace(".", "").replace(/^0+/, "").replace(/0+$/, "");
+    return mantissa.length;
+}
+
+var seed = 12345;
+function next() {
+    seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+    return seed;
+}
+
+var tests = [
+    {
+        name: "Known values through String, toString, concatenation and JSON.stringify",
+        body: function () {
+            for (var i = 0; i < known.length; i++) {
+                assert.areEqual(known[i][1], String(known[i][0]), "String");
+                assert.areEqual(known[i][1], known[i][0].toString(), "toString");
+                assert.areEqual(known[i][1], "" + known[i][0], "Concatenation");
+                assert.areEqual("[" + known[i][1].replace("+", "") + "]", JSON.stringify([known[i][0]]).replace("+", ""), "JSON.stringify");
+            }
+        }
+    },
+    {
+        name: "Integral values computed as doubles",
+        body: function () {
+            var half = 0.5;
+            for (var i = -1000; i <= 1000; i += 7) {
+                var value = (i + half) - half;
+                assert.areEqual(i.toString(), value.toString(), "Integral double " + i);
+            }
+            assert.areEqual("0", (-half + half).toString(), "Zero");
+            assert.areEqual("0", (-0).toString(), "Negative zero");
+        }
+    },
+    {
+        name: "Random values round-trip, no shorter string does, and converting them again gives the same strings",
+        body: function () {
+            var buffer = new ArrayBuffer(8);
+            var doubles = new Float64Array(buffer);
+            var words = new Uint32Array(buffer);
+
+            var values = [];
+            for (var i = 0; i < 20000; i++) {
+                words[0] = next() ^ (next() << 16);
+                words[1] = next() ^ (next() << 16);
+                var value = doubles[0];
+                if (!isFinite(value) || value === 0)
+                    continue;
+                values.push(value);
+            }
+            for (var i = 0; i < 5000; i++) {
+                values.push((next() % 1000000) / (1 + next() % 1000));
+            }
+
+            var strings = [];
+            for (var i = 0; i < values.length; i++) {
+                var s = String(values[i]);
+                strings.push(s);
+                assert.areEqual(values[i], Number(s), "Round-trip " + s);
+                var digits = digitCount(s);
+                if (digits > 1) {
+                    assert.isFalse(Number(values[i].toPrecision(digits - 1)) === values[i], "Shortest " + s);
+                }
+            }
+
+            for (var i = values.length - 1; i >= 0; i--) {
+                assert.areEqual(strings[i], String(values[i]), "Converted again " + strings[i]);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,99 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Decimal strings converted to numbers with parseFloat, Number(), JSON.parse and numeric literals.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function assertSameNumber(expected, actual, message) {
+    assert.areEqual(expected, actual, message);
+    if (expected === 0) {
+        assert.areEqual(1 / expected, 1 / actual, message + " sign of zero");
+    }
+}
+
+function checkAll(expected, s) {
+    assertSameNumber(expected, parseFloat(s), "parseFloat " + s);
+    assertSameNumber(expected, Number(s), "Number " + s);
+    assertSameNumber(expected, +s, "Unary plus " + s);
+    assertSameNumber(expected, JSON.parse(s), "JSON.parse " + s);
+    assertSameNumber(expected, JSON.parse("[" + s + "]")[0], "JSON.parse array " + s);
+    assertSameNumber(expected, eval(s), "Literal " + s);
+}
+
+var known = [
+    ["0.1", 0.1],
+    ["0.3", 0.3],
+    ["1.7976931348623157e308", Number.MAX_VALUE],
+    ["1.7976931348623158e308", Number.MAX_VALUE],
+    ["1.7976931348623159e308", Infinity],
+    ["2.2250738585072014e-308", 2.2250738585072014e-308],
+    ["2.2250738585072011e-308", 2.225073858507201e-308],
+    ["4.9406564584124654e-324", 5e-324],
+    ["2.4703282292062328e-324", 5e-324],
+    ["2.4703282292062327e-324", 0],
+    ["1e-400", 0],
+    ["1e400", Infinity],
+    ["9007199254740993", 9007199254740992],
+    ["9007199254740995", 9007199254740996],
+    ["18446744073709551615", 18446744073709552000],
+    ["1234567890123456789", 1234567890123456800],
+    ["0.1234567890123456789", 0.12345678901234568],
+    ["7.3177701707893310e15", 7317770170789331],
+    ["1.2345678901234568347913049445e+200", 1.2345678901234568e200],
+    ["123456.78", 123456.78],
+    ["-0.000001", -0.000001],
+    ["-0", -0],
+    ["5e-1", 0.5],
+    ["1448997445238699", 1448997445238699],
+];
+
+var seed = 54321;
+function next() {
+    seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+    return seed;
+}
+
+var tests = [
+    {
+        name: "Known values, including halfway cases and the ends of the double range",
+        body: function () {
+            for (var i = 0; i < known.length; i++) {
+                checkAll(known[i][1], known[i][0]);
+            }
+        }
+    },
+    {
+        name: "Random doubles written with 17 to 19 significant digits, and in the shortest form",
+        body: function () {
+            var buffer = new ArrayBuffer(8);
+            var doubles = new Float64Array(buffer);
+            var words = new Uint32Array(buffer);
+            for (var i = 0; i < 20000; i++) {
+                words[0] = next() ^ (next() << 16);
+                words[1] = next() ^ (next() << 16);
+                var value = Math.abs(doubles[0]);
+                if (!isFinite(value) || value === 0)
+                    continue;
+                var precision = 17 + i % 3;
+                assert.areEqual(value, parseFloat(value.toPrecision(precision)), "toPrecision(" + precision + ") of " + value);
+                assert.areEqual(value, Number(value.toExponential(precision - 1)), "toExponential(" + (precision - 1) + ") of " + value);
+                assert.areEqual(value, JSON.parse(String(value)), "Shortest form of " + value);
+            }
+        }
+    },
+    {
+        name: "Prices with two decimals",
+        body: function () {
+            for (var i = 0; i < 20000; i++) {
+                var cents = next() % 100000000;
+                var s = Math.floor(cents / 100) + "." + ("0" + cents % 100).slice(-2);
+                checkAll(cents / 100, s);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
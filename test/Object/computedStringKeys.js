@@ -0,0 +1,134 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Strings built at runtime and used as property names, looked up again through the same string objects.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var keys = JSON.parse('["alpha", "beta", "gamma", "10", "-1", "1.5", "4294967295", "length", "__proto__"]');
+var built = [];
+for (var i = 0; i < 600; i++) {
+    built.push("key" + String(i));
+}
+
+function makeLongName(prefix, length) {
+    return prefix + "_".repeat(length - prefix.length);
+}
+
+function run(round) {
+    var o = {};
+    for (var i = 0; i < built.length; i++) {
+        o[built[i]] = i;
+    }
+    for (var i = 0; i < built.length; i++) {
+        assert.areEqual(i, o[built[i]], "Get " + built[i]);
+        assert.isTrue(built[i] in o, "in " + built[i]);
+        assert.isTrue(o.hasOwnProperty(built[i]), "hasOwnProperty " + built[i]);
+    }
+
+    var p = {};
+    for (var i = 0; i < keys.length - 2; i++) {
+        p[keys[i]] = "v" + i;
+    }
+    assert.areEqual("v0", p.alpha, "Named property");
+    assert.areEqual("v3", p[10], "Index property");
+    assert.areEqual("v4", p[-1], "Negative number property");
+    assert.areEqual("v5", p[1.5], "Fraction property");
+    assert.areEqual("v6", p["4294967295"], "Property past the largest index");
+    assert.areEqual("10,alpha,beta,gamma,-1,1.5,4294967295", Object.keys(p).join(), "Keys");
+
+    var a = [1, 2, 3];
+    assert.areEqual(3, a[keys[7]], "Array length");
+    a[keys[3]] = "ten";
+    assert.areEqual(11, a.length, "Array length after setting an index");
+    assert.areEqual("ten", a[10], "Array element set through a string");
+
+    var q = {};
+    var proto = { fromProto: round };
+    q[keys[8]] = proto;
+    assert.areEqual(proto, Object.getPrototypeOf(q), "__proto__ sets the prototype");
+    assert.areEqual(round, q.fromProto, "Property from the new prototype");
+    assert.isFalse(q.hasOwnProperty(keys[8]), "No own __proto__ property");
+
+    delete o[built[5]];
+    assert.areEqual(undefined, o[built[5]], "Deleted property");
+    assert.isFalse(built[5] in o, "in after delete");
+    Object.defineProperty(o, built[6], { get: function () { return "getter"; } });
+    assert.areEqual("getter", o[built[6]], "Property redefined with a getter");
+
+    var fresh = "fresh" + round + "_" + Math.random();
+    assert.areEqual(undefined, o[fresh], "Name that isn't a property anywhere yet");
+    o[fresh] = "added";
+    assert.areEqual("added", o[fresh], "Added property");
+    assert.areEqual("added", o[fresh.substring(0)], "Added property through a copy of the name");
+}
+
+var tests = [
+    {
+        name: "Lookups through the same strings, across collections",
+        body: function () {
+            for (var round = 0; round < 3; round++) {
+                run(round);
+                if (typeof CollectGarbage === "function") {
+                    CollectGarbage();
+                }
+            }
+        }
+    },
+    {
+        name: "Long computed names",
+        body: function () {
+            var names = [makeLongName("short", 64), makeLongName("long", 65), makeLongName("longer", 10000)];
+            var o = {};
+            for (var i = 0; i < names.length; i++) {
+                o[names[i]] = i;
+            }
+            for (var round = 0; round < 2; round++) {
+                for (var i = 0; i < names.length; i++) {
+                    assert.areEqual(i, o[names[i]], "Get name of length " + names[i].length);
+                    assert.areEqual(i, o[names[i].substring(0)], "Get through a copy of the name of length " + names[i].length);
+                }
+            }
+            delete o[names[2]];
+            assert.isFalse(names[2] in o, "in after delete");
+            assert.areEqual("0,1", Object.keys(o).map(function (key) { return o[key]; }).join(), "Values of the remaining properties");
+        }
+    },
+    {
+        name: "Missing names that become properties through other strings",
+        body: function () {
+            var missing = [];
+            for (var i = 0; i < 20; i++) {
+                missing.push("missing" + i + "_" + Math.random());
+            }
+            var o = {};
+            var d = { removed: 0 };
+            delete d.removed;
+            for (var round = 0; round < 3; round++) {
+                for (var i = 0; i < missing.length; i++) {
+                    assert.areEqual(undefined, o[missing[i]], "Missing name " + i);
+                    assert.areEqual(undefined, d[missing[i]], "Missing name on a dictionary " + i);
+                    assert.isFalse(missing[i] in o, "in missing name " + i);
+                }
+            }
+
+            // The records are created through copies, the lookups still use the strings that missed.
+            for (var i = 0; i < missing.length; i += 2) {
+                o[missing[i].substring(0)] = i;
+                d[missing[i].substring(0)] = -i;
+            }
+            var other = {};
+            other[missing[1].substring(0)] = "other";
+            for (var i = 0; i < missing.length; i++) {
+                assert.areEqual(i % 2 === 0 ? i : undefined, o[missing[i]], "Name added through a copy " + i);
+                assert.areEqual(i % 2 === 0 ? -i : undefined, d[missing[i]], "Name added to a dictionary through a copy " + i);
+                assert.areEqual(i % 2 === 0, missing[i] in o, "in name added through a copy " + i);
+            }
+            assert.areEqual("other", other[missing[1]], "Name added on another object");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
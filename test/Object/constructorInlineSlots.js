@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects from constructors whose first objects outgrow the default inline slots.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var names = [];
+for (var i = 0; i < 40; i++) {
+    names.push("p" + i);
+}
+
+function checkObject(o, n, count) {
+    var keys = Object.keys(o);
+    assert.areEqual(count, keys.length, "Key count");
+    for (var i = 0; i < count; i++) {
+        assert.areEqual(names[i], keys[i], "Key " + i);
+        assert.areEqual(n + i, o[names[i]], "Value of " + names[i]);
+    }
+}
+
+var tests = [
+    {
+        name: "Objects that outgrow the inline slots in the constructor",
+        body: function () {
+            function Wide(n) {
+                this.p0 = n; this.p1 = n + 1; this.p2 = n + 2; this.p3 = n + 3;
+                this.p4 = n + 4; this.p5 = n + 5; this.p6 = n + 6; this.p7 = n + 7;
+                this.p8 = n + 8; this.p9 = n + 9; this.p10 = n + 10; this.p11 = n + 11;
+            }
+            Wide.prototype.fromPrototype = "proto";
+
+            var wide = [];
+            for (var i = 0; i < 10; i++) {
+                wide.push(new Wide(i * 100));
+            }
+            for (var i = 0; i < 10; i++) {
+                checkObject(wide[i], i * 100, 12);
+                assert.areEqual("proto", wide[i].fromPrototype, "Property from the prototype");
+                assert.isTrue(wide[i] instanceof Wide, "instanceof the constructor");
+            }
+
+            delete wide[9].p11;
+            assert.areEqual(undefined, wide[9].p11, "Deleted property");
+            assert.areEqual(910, wide[9].p10, "Property before the deleted one");
+        }
+    },
+    {
+        name: "Objects that keep growing after the constructor, by different amounts",
+        body: function () {
+            function Grows(n) {
+                this.p0 = n;
+                this.p1 = n + 1;
+            }
+
+            var grown = [];
+            for (var i = 0; i < 10; i++) {
+                var o = new Grows(i * 100);
+                var count = 2 + (i * 7) % 30;
+                for (var j = 2; j < count; j++) {
+                    o[names[j]] = i * 100 + j;
+                }
+                grown.push({ object: o, count: count });
+            }
+            for (var i = 0; i < 10; i++) {
+                checkObject(grown[i].object, i * 100, grown[i].count);
+            }
+
+            delete grown[0].object.p1;
+            grown[0].object.p1 = 1;
+            assert.areEqual("p0,p1", Object.keys(grown[0].object).join(), "Keys after delete and re-add");
+        }
+    },
+    {
+        name: "Changing the prototype property while the constructor cache is still being updated",
+        body: function () {
+            function Switches(n) {
+                for (var i = 0; i < 20; i++) {
+                    this[names[i]] = n + i;
+                }
+            }
+
+            var switched = [];
+            for (var i = 0; i < 6; i++) {
+                if (i === 1 || i === 4) {
+                    Switches.prototype = { marker: i };
+                }
+                switched.push(new Switches(i * 100));
+            }
+            for (var i = 0; i < 6; i++) {
+                checkObject(switched[i], i * 100, 20);
+                assert.areEqual(i < 1 ? undefined : i < 4 ? 1 : 4, switched[i].marker, "Property from the prototype");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function Wide(n) {
+    this.p0 = n; this.p1 = n + 1; this.p2 = n + 2; this.p3 = n + 3;
+    this.p4 = n + 4; this.p5 = n + 5; this.p6 = n + 6; this.p7 = n + 7;
+    this.p8 = n + 8; this.p9 = n + 9; this.p10 = n + 10; this.p11 = n + 11;
+}
+
+function Narrow(n) {
+    this.p0 = n; this.p1 = n + 1;
+}
+
+var objects = [];
+for (var i = 0; i < 5; i++) {
+    objects.push(new Wide(i));
+    objects.push(new Narrow(i));
+}
+WScript.Echo(Object.keys(objects[8]).join());
+WScript.Echo(Object.keys(objects[9]).join());
@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Large string keyed maps on dictionary type handlers: lookups, deletes and re-adds.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function testLargeMap(o, count) {
+    var i;
+    for (i = 0; i < count; i++) {
+        o["key" + i] = i;
+    }
+    for (i = 0; i < count; i++) {
+        assert.areEqual(i, o["key" + i], "lookup key" + i);
+    }
+    assert.areEqual(undefined, o["key" + count], "missing key");
+
+    for (i = 0; i < count; i += 3) {
+        delete o["key" + i];
+    }
+    for (i = 0; i < count; i++) {
+        assert.areEqual(i % 3 === 0 ? undefined : i, o["key" + i], "lookup after delete key" + i);
+    }
+
+    var keys = Object.keys(o);
+    assert.areEqual(count - Math.ceil(count / 3), keys.length, "key count after delete");
+    assert.areEqual("key1", keys[0], "first key after delete");
+    assert.areEqual("key" + (count - 1 - ((count - 1) % 3 === 0 ? 1 : 0)), keys[keys.length - 1], "last key after delete");
+
+    for (i = 0; i < count; i += 3) {
+        o["key" + i] = -i;
+    }
+    for (i = 0; i < count; i++) {
+        assert.areEqual(i % 3 === 0 ? -i : i, o["key" + i], "lookup after re-add key" + i);
+    }
+    keys = Object.keys(o);
+    assert.areEqual(count, keys.length, "key count after re-add");
+    assert.areEqual("key1", keys[0], "first key after re-add");
+}
+
+var tests = [
+    {
+        name: "Simple dictionary type handler",
+        body: function () {
+            testLargeMap({}, 5000);
+        }
+    },
+    {
+        name: "Dictionary type handler with an accessor",
+        body: function () {
+            var o = {};
+            Object.defineProperty(o, "accessor", { get: function () { return 1; }, configurable: true, enumerable: false });
+            testLargeMap(o, 5000);
+            assert.areEqual(1, o.accessor, "accessor");
+        }
+    },
+    {
+        name: "Small maps around the size where the index is built",
+        body: function () {
+            for (var count = 3; count <= 20; count++) {
+                testLargeMap({}, count);
+
+                var o = {};
+                Object.defineProperty(o, "accessor", { get: function () { return 1; }, configurable: true, enumerable: false });
+                testLargeMap(o, count);
+                assert.areEqual(1, o.accessor, "accessor");
+            }
+        }
+    },
+    {
+        name: "Symbols and string keys share the map",
+        body: function () {
+            var o = {};
+            var symbols = [];
+            for (var i = 0; i < 300; i++) {
+                symbols.push(Symbol("s" + i));
+                o[symbols[i]] = i;
+                o["name" + i] = -i;
+            }
+            for (var i = 0; i < 300; i += 2) {
+                delete o[symbols[i]];
+            }
+            for (var i = 0; i < 300; i++) {
+                assert.areEqual(i % 2 === 0 ? undefined : i, o[symbols[i]], "symbol s" + i);
+                assert.areEqual(-i, o["name" + i], "name" + i);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Object.keys, Object.values, Object.entries and Object.assign on objects with a path type.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function describe(o) {
+    return Reflect.ownKeys(o).map(function (key) { return String(key) + "=" + String(o[key]); }).join();
+}
+
+var sym = Symbol("sym");
+
+function makePoint(i) {
+    var o = {};
+    o.x = i;
+    o.y = i * 2;
+    o[sym] = "s" + i;
+    o.z = "z" + i;
+    return o;
+}
+
+var tests = [
+    {
+        name: "Keys, values and entries with and without for-in filling the cache first",
+        body: function () {
+            for (var i = 0; i < 5; i++) {
+                var p = makePoint(i);
+                if (i % 2 == 0) {
+                    var forIn = [];
+                    for (var key in p) {
+                        forIn.push(key);
+                    }
+                    assert.areEqual("x,y,z", forIn.join(), "for-in");
+                }
+                assert.areEqual("x,y,z", Object.keys(p).join(), "Object.keys");
+                assert.areEqual([i, i * 2, "z" + i].join(), Object.values(p).join(), "Object.values");
+                assert.areEqual(["x", i, "y", i * 2, "z", "z" + i].join(), Object.entries(p).join(), "Object.entries");
+                assert.areEqual(3, Object.entries(p).length, "Object.entries length");
+            }
+        }
+    },
+    {
+        name: "Index, deleted and non-enumerable properties",
+        body: function () {
+            var withIndex = makePoint(7);
+            withIndex[1] = "one";
+            assert.areEqual("1,x,y,z", Object.keys(withIndex).join(), "Numeric keys come first");
+            assert.areEqual("one,7,14,z7", Object.values(withIndex).join(), "Values with an index property");
+
+            var deleted = makePoint(8);
+            delete deleted.y;
+            assert.areEqual("x,z", Object.keys(deleted).join(), "Keys after delete");
+
+            var hidden = makePoint(9);
+            Object.defineProperty(hidden, "x", { enumerable: false });
+            assert.areEqual("y,z", Object.keys(hidden).join(), "Keys with a non-enumerable property");
+            assert.areEqual("18,z9", Object.values(hidden).join(), "Values with a non-enumerable property");
+        }
+    },
+    {
+        name: "Object.assign to an empty object creates an independent copy, including symbols",
+        body: function () {
+            for (var i = 0; i < 5; i++) {
+                var source = makePoint(i);
+                var target = Object.assign({}, source);
+                assert.areEqual(describe(source), describe(target), "Copied properties");
+                target.x = "changed";
+                target.w = "added";
+                assert.areEqual(i, source.x, "Source after changing the target");
+                assert.areEqual(undefined, source.w, "Source after adding to the target");
+                assert.areEqual("x,y,z,w", Object.keys(target).join(), "Target keys after add");
+                delete target.y;
+                assert.areEqual("x,z,w", Object.keys(target).join(), "Target keys after delete");
+                assert.areEqual("x,y,z", Object.keys(source).join(), "Source keys after deleting from the target");
+            }
+        }
+    },
+    {
+        name: "Object.assign to objects that already have properties or another prototype",
+        body: function () {
+            var nonEmpty = Object.assign({ y: "kept", a: 1 }, makePoint(3));
+            assert.areEqual("y=6,a=1,x=3,z=z3,Symbol(sym)=s3", describe(nonEmpty), "Target with properties");
+
+            var proto = { protoValue: 1 };
+            var withProto = Object.assign(Object.create(proto), makePoint(4));
+            assert.areEqual("x=4,y=8,z=z4,Symbol(sym)=s4", describe(withProto), "Target with another prototype");
+            assert.areEqual(proto, Object.getPrototypeOf(withProto), "Prototype is kept");
+        }
+    },
+    {
+        name: "Object.assign runs setters and checks read-only properties on the target's prototype chain",
+        body: function () {
+            var log = [];
+            var setterProto = {
+                set x(value) { log.push("x=" + value); }
+            };
+            Object.defineProperty(setterProto, "y", { value: "read-only", writable: false });
+
+            var setterSource = Object.create(setterProto);
+            Object.defineProperty(setterSource, "x", { value: 1, enumerable: true, writable: true, configurable: true });
+            Object.assign(Object.create(setterProto), setterSource);
+            assert.areEqual("x=1", log.join(), "Setter on the prototype");
+
+            var readOnlySource = Object.create(setterProto);
+            Object.defineProperty(readOnlySource, "y", { value: 2, enumerable: true, writable: true, configurable: true });
+            assert.throws(function () { Object.assign(Object.create(setterProto), readOnlySource); }, TypeError, "Read-only property on the prototype");
+        }
+    },
+    {
+        name: "Object.assign with an own __proto__ data property sets the target's prototype",
+        body: function () {
+            var protoTarget = Object.assign({}, JSON.parse('{"a":3,"__proto__":{"b":4}}'));
+            assert.areEqual("a", Object.keys(protoTarget).join(), "Keys");
+            assert.areEqual(4, protoTarget.b, "Property from the new prototype");
+            assert.isFalse(protoTarget.hasOwnProperty("__proto__"), "No own __proto__ property");
+        }
+    },
+    {
+        name: "Object.assign with setters on the target that change the source",
+        body: function () {
+            var changing = makePoint(5);
+            var changingTarget = {
+                set x(value) {
+                    changing.other = "other";
+                    changing.y = "changed";
+                }
+            };
+            Object.assign(changingTarget, changing);
+            assert.areEqual("changed", changingTarget.y, "Value read after the source changed");
+            assert.areEqual("z5", changingTarget.z, "Value after the source changed");
+            assert.areEqual(undefined, changingTarget.other, "Property added to the source while copying");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
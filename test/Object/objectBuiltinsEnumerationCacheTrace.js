@@ -0,0 +1,24 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function makePoint(i) {
+    var o = {};
+    o.x = i;
+    o.y = i * 2;
+    return o;
+}
+
+var a = makePoint(1);
+var b = makePoint(2);
+
+WScript.Echo("keys");
+WScript.Echo(Object.keys(a).join());
+WScript.Echo("assign");
+var c = Object.assign({}, b);
+WScript.Echo("values");
+WScript.Echo(Object.values(c).join());
+WScript.Echo("assign again");
+Object.assign({}, a);
+WScript.Echo(Object.entries(a).join());
@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Deleting properties of path type objects, with and without moving back along the type path.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+Point.prototype.z = "proto";
+
+function readZ(o) { return o.z; }
+function readY(o) { return o.y; }
+function writeZ(o, value) { o.z = value; }
+
+var tests = [
+    {
+        name: "Deleting the property added last",
+        body: function () {
+            var points = [];
+            for (var i = 0; i < 10; i++) {
+                points.push(new Point(i, i * 2));
+            }
+
+            for (var i = 0; i < 10; i++) {
+                var p = points[i];
+                writeZ(p, i * 3);
+                assert.areEqual(i * 3, readZ(p), "own z " + i);
+                assert.isTrue(delete p.z, "delete z " + i);
+                assert.areEqual("proto", readZ(p), "prototype z after delete " + i);
+                assert.isFalse(p.hasOwnProperty("z"), "hasOwnProperty z " + i);
+                assert.areEqual("x,y", Object.keys(p).join(), "keys after delete " + i);
+                assert.areEqual(i * 2, readY(p), "y after delete " + i);
+            }
+
+            // Re-adding the property goes forward along the path again.
+            writeZ(points[0], "again");
+            assert.areEqual("again", readZ(points[0]), "re-added z");
+            assert.areEqual("x,y,z", Object.keys(points[0]).join(), "keys after re-add");
+            assert.areEqual("proto", readZ(points[1]), "other instance z");
+        }
+    },
+    {
+        name: "Deleting back to the root of the path",
+        body: function () {
+            var q = new Point(1, 2);
+            delete q.y;
+            delete q.x;
+            assert.areEqual("", Object.keys(q).join(), "keys after deleting all");
+            assert.areEqual(undefined, q.x, "x after deleting all");
+            q.y = 5;
+            q.x = 6;
+            assert.areEqual("y,x", Object.keys(q).join(), "keys after adding in a different order");
+            assert.areEqual(5, readY(q), "y after adding in a different order");
+        }
+    },
+    {
+        name: "Deleting a property that isn't the last one, or isn't there",
+        body: function () {
+            var r = new Point(1, 2);
+            assert.isTrue(delete r.w, "delete missing property");
+            assert.areEqual("x,y", Object.keys(r).join(), "keys after deleting missing property");
+            delete r.x;
+            assert.areEqual("y", Object.keys(r).join(), "keys after deleting first property");
+            assert.areEqual(2, readY(r), "y after deleting first property");
+            r.x = 3;
+            assert.areEqual("y,x", Object.keys(r).join(), "keys after re-adding first property");
+        }
+    },
+    {
+        name: "Object literals and prototypes",
+        body: function () {
+            var literals = [];
+            for (var i = 0; i < 3; i++) {
+                var o = { a: i, b: i + 1 };
+                o.c = i + 2;
+                delete o.c;
+                literals.push(o);
+            }
+            for (var i = 0; i < 3; i++) {
+                assert.areEqual("a,b", Object.keys(literals[i]).join(), "literal keys " + i);
+                assert.areEqual(i + 1, literals[i].b, "literal b " + i);
+                assert.areEqual(undefined, literals[i].c, "literal c " + i);
+            }
+
+            var proto = { m: 1 };
+            proto.n = 2;
+            var child = Object.create(proto);
+            assert.areEqual(2, child.n, "inherited n");
+            delete proto.n;
+            assert.areEqual(undefined, child.n, "inherited n after delete");
+            assert.areEqual(1, child.m, "inherited m after delete");
+        }
+    },
+    {
+        name: "Deleting while enumerating",
+        body: function () {
+            var s = new Point(1, 2);
+            s.w = 3;
+            var seen = [];
+            for (var key in s) {
+                seen.push(key);
+                if (key === "x") {
+                    delete s.w;
+                }
+            }
+            assert.areEqual("x,y,z", seen.join(), "keys seen while deleting");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
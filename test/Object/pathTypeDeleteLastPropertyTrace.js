@@ -0,0 +1,24 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+var points = [];
+for (var i = 0; i < 5; i++) {
+    points.push(new Point(i, i * 2));
+}
+
+WScript.Echo("delete last");
+delete points[3].y;
+WScript.Echo(Object.keys(points[3]).join());
+points[3].y = 10;
+WScript.Echo(Object.keys(points[3]).join());
+
+WScript.Echo("delete first");
+delete points[4].x;
+WScript.Echo(Object.keys(points[4]).join());
@@ -0,0 +1,122 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String searches with short search strings, compared against a plain search.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function matchesAt(input, search, i) {
+    for (var j = 0; j < search.length; j++) {
+        if (input.charCodeAt(i + j) !== search.charCodeAt(j)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+function plainIndexOf(input, search, position) {
+    for (var i = position; i + search.length <= input.length; i++) {
+        if (matchesAt(input, search, i)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function plainLastIndexOf(input, search, position) {
+    for (var i = Math.min(position, input.length - search.length); i >= 0; i--) {
+        if (matchesAt(input, search, i)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function plainSplit(input, search) {
+    var parts = [];
+    var start = 0;
+    var i;
+    while ((i = plainIndexOf(input, search, start)) != -1) {
+        parts.push(input.substring(start, i));
+        start = i + search.length;
+    }
+    parts.push(input.substring(start));
+    return parts;
+}
+
+function testSearch(input, search, name) {
+    assert.areEqual(plainIndexOf(input, search, 0), input.indexOf(search), name + " indexOf");
+    assert.areEqual(plainLastIndexOf(input, search, input.length), input.lastIndexOf(search), name + " lastIndexOf");
+    assert.areEqual(plainIndexOf(input, search, 0) != -1, input.includes(search), name + " includes");
+    for (var position = 0; position <= input.length; position += 7) {
+        assert.areEqual(plainIndexOf(input, search, position), input.indexOf(search, position), name + " indexOf from " + position);
+        assert.areEqual(plainLastIndexOf(input, search, position), input.lastIndexOf(search, position), name + " lastIndexOf from " + position);
+    }
+    assert.areEqual(plainSplit(input, search).join("|"), input.split(search).join("|"), name + " split");
+    var index = plainIndexOf(input, search, 0);
+    var replaced = index == -1 ? input : input.substring(0, index) + "#" + input.substring(index + search.length);
+    assert.areEqual(replaced, input.replace(search, "#"), name + " replace");
+    assert.areEqual(replaced, input.replace(search, function () { return "#"; }), name + " replace with function");
+}
+
+var tests = [
+    {
+        name: "Inputs with many near matches, searched for substrings and variations that don't occur in them",
+        body: function () {
+            var inputs = [];
+            var text = "";
+            for (var i = 0; i < 150; i++) {
+                text += (i % 17 == 0) ? "b" : (i % 29 == 0) ? "ā" : "a";
+            }
+            inputs.push(text);
+            inputs.push(text.substring(3, 70));
+            inputs.push("abc");
+            inputs.push("");
+            var mixed = "";
+            for (var i = 0; i < 120; i++) {
+                mixed += String.fromCharCode(0x61 + (i * 7) % 5) + ((i % 31 == 0) ? "😀" : "");
+            }
+            inputs.push(mixed);
+
+            for (var n = 0; n < inputs.length; n++) {
+                var input = inputs[n];
+                for (var length = 1; length <= 34; length++) {
+                    for (var start = 0; start + length <= input.length; start += 13) {
+                        var search = input.substring(start, start + length);
+                        testSearch(input, search, "input " + n + " [" + start + ", " + length + "]");
+                        testSearch(input, search.substring(0, length - 1) + "z", "input " + n + " last changed [" + start + ", " + length + "]");
+                        testSearch(input, "z" + search.substring(1), "input " + n + " first changed [" + start + ", " + length + "]");
+                    }
+                    if (length <= input.length) {
+                        testSearch(input, input.substring(input.length - length), "input " + n + " suffix " + length);
+                    }
+                }
+                testSearch(input, input + "a", "input " + n + " longer");
+            }
+        }
+    },
+    {
+        name: "Matches that end at or right before the end of the input",
+        body: function () {
+            for (var length = 1; length <= 33; length++) {
+                var search = "x";
+                while (search.length < length) {
+                    search += "y";
+                }
+                for (var before = 0; before < 20; before++) {
+                    var input = "";
+                    while (input.length < before) {
+                        input += "y";
+                    }
+                    input += search;
+                    testSearch(input, search, "end " + length + " " + before);
+                    testSearch(input + "yy", search, "end+2 " + length + " " + before);
+                }
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Arrays used as queues: push at the back and shift from the front, with a hundred thousand elements waiting.
+// Each shift used to move the whole head segment; a large head is now split so that only its front moves.
+
+var queueLength = 100000;
+var operationCount = 200000;
+
+function run(makeValue) {
+    var queue = [];
+    for (var i = 0; i < queueLength; i++) {
+        queue.push(makeValue(i));
+    }
+
+    var sum = 0;
+    for (var i = 0; i < operationCount; i++) {
+        queue.push(makeValue(queueLength + i));
+        sum += queue.shift() === makeValue(i) ? 1 : 0;
+        if (i % 1000 == 0) {
+            queue.unshift(makeValue(i + 1));
+            queue.shift();
+        }
+    }
+    return sum == operationCount && queue.length == queueLength;
+}
+
+var startDate = new Date();
+var passed = run(function (i) { return i; }) &&
+    run(function (i) { return i + 0.5; }) &&
+    run(function (i) { return i & 1 ? i : "s"; });
+var interval = new Date() - startDate;
+
+if (!passed) {
+    WScript.Echo("FAILED");
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Random reads, writes and deletes on arrays filled out of order with holes, so that each one ends up with
+// thousands of segments. Lookups go through the array's segment map once it is built; run with
+// -DisableArrayBTree to compare against walking the segment list.
+
+var segmentCount = 4096;
+var stride = 1024;
+var operationCount = 1000000;
+
+function fill(array) {
+    // Visit the segments in a scrambled order so they can't be appended one after the other.
+    for (var i = 0; i < segmentCount; i++) {
+        var segment = (i * 2621) % segmentCount;
+        array[segment * stride] = segment;
+        array[segment * stride + 1] = segment;
+    }
+    return array;
+}
+
+var sum = 0;
+var seed = 1;
+function nextIndex() {
+    seed = (seed * 16807) % 2147483647;
+    return (seed % segmentCount) * stride;
+}
+
+var startDate = new Date();
+var arrays = [fill([]), fill([]), fill([])];
+for (var i = 0; i < operationCount; i++) {
+    var array = arrays[i % arrays.length];
+    var index = nextIndex();
+    switch (i % 4) {
+        case 0:
+        case 1:
+            sum += array[index + 1] | 0;
+            break;
+        case 2:
+            array[index + 1] = i;
+            break;
+        case 3:
+            delete array[index];
+            break;
+    }
+}
+var interval = new Date() - startDate;
+
+if (sum <= 0) {
+    WScript.Echo("FAILED: " + sum);
+}
+WScript.Echo("### TIME:", interval, "ms");
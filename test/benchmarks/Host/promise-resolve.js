@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// 1M promise resolutions: 1000 chains of 1000 then() each, all in flight at once, so the host's job queue holds
+// about a thousand jobs at any time.
+
+var chainCount = 1000;
+var chainLength = 1000;
+var pending = chainCount;
+var sum = 0;
+
+function step(value) {
+    return value + 1;
+}
+
+function done(value) {
+    sum += value;
+    if (--pending == 0) {
+        var interval = new Date() - startDate;
+        if (sum != chainCount * chainLength) {
+            WScript.Echo("FAILED: " + sum);
+        }
+        WScript.Echo("### TIME:", interval, "ms");
+    }
+}
+
+var startDate = new Date();
+for (var i = 0; i < chainCount; i++) {
+    var promise = Promise.resolve(0);
+    for (var j = 0; j < chainLength; j++) {
+        promise = promise.then(step);
+    }
+    promise.then(done);
+}
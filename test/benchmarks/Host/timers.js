@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// 100K timers with delays spread over 0 to 99ms, queued out of order, a tenth of them cleared before they fire.
+
+var timerCount = 100000;
+var pending = 0;
+var fired = 0;
+
+function tick() {
+    fired++;
+    if (--pending == 0) {
+        var interval = new Date() - startDate;
+        if (fired != timerCount - timerCount / 10) {
+            WScript.Echo("FAILED: " + fired);
+        }
+        WScript.Echo("### TIME:", interval, "ms");
+    }
+}
+
+var startDate = new Date();
+for (var i = 0; i < timerCount; i++) {
+    var id = WScript.SetTimeout(tick, (i * 7919) % 100);
+    if (i % 10 == 0) {
+        WScript.ClearTimeout(id);
+    } else {
+        pending++;
+    }
+}
@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects parsed from JSON with thousands of keys, used as string-keyed maps: hits, misses, deletes and re-adds.
+// The objects are past the path type handler length, so every lookup goes through the property map of a
+// dictionary type handler.
+
+var keyCount = 4096;
+var operationCount = 2000000;
+
+var keys = [];
+var missingKeys = [];
+for (var i = 0; i < keyCount; i++) {
+    keys.push("id_" + ((i * 2654435761) >>> 0).toString(36));
+    missingKeys.push("missing_" + i);
+}
+
+function parseMap(offset) {
+    var parts = [];
+    for (var i = 0; i < keyCount; i++) {
+        parts.push(JSON.stringify(keys[i]) + ":" + (i + offset));
+    }
+    return JSON.parse("{" + parts.join(",") + "}");
+}
+
+var sum = 0;
+var seed = 1;
+function nextKey() {
+    seed = (seed * 16807) % 2147483647;
+    return seed % keyCount;
+}
+
+var startDate = new Date();
+var maps = [parseMap(1), parseMap(2), parseMap(3)];
+for (var i = 0; i < operationCount; i++) {
+    var map = maps[i % maps.length];
+    var k = nextKey();
+    switch (i % 8) {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+            sum += map[keys[k]] | 0;
+            break;
+        case 4:
+        case 5:
+            if (map[missingKeys[k]] !== undefined) {
+                sum = -1;
+            }
+            break;
+        case 6:
+            delete map[keys[k]];
+            break;
+        case 7:
+            map[keys[k]] = i;
+            break;
+    }
+}
+var interval = new Date() - startDate;
+
+if (sum <= 0) {
+    WScript.Echo("FAILED: " + sum);
+}
+WScript.Echo("### TIME:", interval, "ms");
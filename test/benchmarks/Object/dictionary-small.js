@@ -0,0 +1,46 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Many small objects in dictionary mode, kept alive, each with a handful of properties. This measures the
+// memory a small property map costs more than lookup speed: run with ch -Benchmark=<iterations> to see
+// peak_memory_bytes next to the time.
+
+var objectCount = 100000;
+var lookupRounds = 20;
+var names = ["a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l"];
+
+function makeObject(i) {
+    var o = { removed: i };
+    var propertyCount = 2 + i % 11;
+    for (var j = 0; j < propertyCount; j++) {
+        o[names[j]] = i + j;
+    }
+    // A delete leaves the path type handler, so every object has a dictionary type handler of its own.
+    delete o.removed;
+    return o;
+}
+
+var startDate = new Date();
+var objects = [];
+for (var i = 0; i < objectCount; i++) {
+    objects.push(makeObject(i));
+}
+
+var sum = 0;
+for (var round = 0; round < lookupRounds; round++) {
+    for (var i = 0; i < objectCount; i++) {
+        var o = objects[i];
+        sum += o[names[round % 2]];
+        if (o.removed !== undefined) {
+            sum = -1;
+        }
+    }
+}
+var interval = new Date() - startDate;
+
+if (sum <= 0 || objects.length !== objectCount) {
+    WScript.Echo("FAILED: " + sum);
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -35,4 +35,24 @@ else
     {
        exit(1);
     }
+
+    if (system("perl perftest.pl -asmjs @ARGV"))
+    {
+       exit(1);
+    }
+
+    if (system("perl perftest.pl -host @ARGV"))
+    {
+       exit(1);
+    }
+
+    if (system("perl perftest.pl -array @ARGV"))
+    {
+       exit(1);
+    }
+
+    if (system("perl perftest.pl -object @ARGV"))
+    {
+       exit(1);
+    }
 }
@@ -577,6 +577,10 @@ sub usage
     print "  -kraken                Run the kraken benchmark\n";
     print "  -octane                Run the Octane 2.0 benchmark\n";
     print "  -jetstream             Run the JetStream benchmark (only non octane and sunspider tests)\n";
+    print "  -asmjs                 Run the asm.js JetStream tests (float-mm, gcc-loops) in the asm.js interpreter\n";
+    print "  -host                  Run the ch host event loop tests (promise jobs, timers)\n";
+    print "  -array                 Run the array tests (many segments, queues)\n";
+    print "  -object                Run the object tests (dictionary mode lookups, small dictionaries)\n";
     print "  -file:<file>           Run the specified js file\n";
     print "  -args:<other args>     Other arguments to ch.exe\n";
     print "  -score                 Test output scores\n";
@@ -686,6 +690,60 @@ sub parse_args
             $basefile = "perfbase$dir.txt";
             $is_dynamicProfileRun = 0; # Currently  dyna-pogo info is not avialable in the browser - remove this when it is.
         }
+        elsif($ARGV[$i] =~ /[-\/]asmjs/)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 5;
+            }
+            # asm.js modules from JetStream, run through the asm.js interpreter (no native code)
+            @testlist = ("float-mm.c", "gcc-loops.cpp");
+            @variants = ("interpreted");
+            $testDescription = "asm.js interpreter benchmark";
+            $parse_time = 0;
+            $parse_scores = 1;
+            $parse_latency = 0;
+            $dir = "jetstream";
+            $basefile = "perfbaseasmjs.txt";
+            $is_dynamicProfileRun = 0;
+        }
+        elsif($ARGV[$i] =~ /^[-\/]host$/)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 5;
+            }
+            # Stress the ch message queue rather than the engine
+            @testlist = ("promise-resolve", "timers");
+            $testDescription = "host event loop benchmark";
+            $dir = "host";
+            $basefile = "perfbase$dir.txt";
+            $is_dynamicProfileRun = 0;
+        }
+        elsif($ARGV[$i] =~ /^[-\/]array$/)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 5;
+            }
+            @testlist = ("sparse-segments", "queue");
+            $testDescription = "array benchmark";
+            $dir = "array";
+            $basefile = "perfbase$dir.txt";
+            $is_dynamicProfileRun = 0;
+        }
+        elsif($ARGV[$i] =~ /^[-\/]object$/)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 5;
+            }
+            @testlist = ("dictionary-lookup", "dictionary-small");
+            $testDescription = "object benchmark";
+            $dir = "object";
+            $basefile = "perfbase$dir.txt";
+            $is_dynamicProfileRun = 0;
+        }
         elsif($ARGV[$i] =~ /[-\/]kraken/i)
         {
             if($iter == $defaultIter)
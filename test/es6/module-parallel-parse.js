@@ -0,0 +1,13 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Imports parsed on job threads; the one with a regex literal is parsed again on the main thread
+WScript.LoadModule(
+    `import { ModuleSimpleExport_foo } from 'ModuleSimpleExport.js';
+    import { ModuleParallelParseRegex_digits } from 'ModuleParallelParseRegex.js';
+    import { ModuleParallelParseNested_sum } from 'ModuleParallelParseNested.js';
+    WScript.Echo(ModuleSimpleExport_foo());
+    WScript.Echo(ModuleParallelParseRegex_digits('a12b345'));
+    WScript.Echo(ModuleParallelParseNested_sum());`, 'samethread');
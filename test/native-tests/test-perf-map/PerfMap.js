@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -PerfMap or -PerfJitDump; test_native.sh checks that both functions are listed under their names.
+function innerPerfMap(n) {
+    if (n == 0) {
+        throw new Error("SUCCESS");
+    }
+    return innerPerfMap(n - 1);
+}
+
+function outerPerfMap() {
+    // The exception unwinds through the interpreted frames and their perf map thunks.
+    return innerPerfMap(3);
+}
+
+try {
+    outerPerfMap();
+} catch (e) {
+    print(e.message);
+}
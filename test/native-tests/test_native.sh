@@ -63,3 +63,33 @@ else
     SAFE_RUN `rm -rf ./sample.o`
 fi
 SAFE_RUN `rm -rf Makefile`
+
+# test-perf-map: the interpreter thunks -PerfMap and -PerfJitDump describe only exist on Linux
+if [[ $(uname) == "Linux" ]]; then
+    TEST_PATH="test-perf-map"
+    SCRIPT_PATH="$(pwd)/${TEST_PATH}/PerfMap.js"
+    WORK_DIR=$(mktemp -d)
+
+    ${CH_DIR} -PerfMap ${SCRIPT_PATH} > ${WORK_DIR}/out.txt 2>&1 &
+    PID=$!
+    wait $PID
+    RES=$(cat ${WORK_DIR}/out.txt)
+    TEST "SUCCESS"
+    RES=$(cat /tmp/perf-${PID}.map)
+    TEST "[0-9a-f]+ 30 JS:innerPerfMap [^ ]*PerfMap.js:7"
+    TEST "[0-9a-f]+ 30 JS:outerPerfMap [^ ]*PerfMap.js:14"
+    rm -f /tmp/perf-${PID}.map
+
+    # The jit dump is written to the current directory.
+    (cd ${WORK_DIR}; ${CH_DIR} -PerfJitDump ${SCRIPT_PATH} > out.txt 2>&1 & echo $! > pid.txt; wait)
+    PID=$(cat ${WORK_DIR}/pid.txt)
+    RES=$(cat ${WORK_DIR}/out.txt)
+    TEST "SUCCESS"
+    RES=$(head -c 4 ${WORK_DIR}/jit-${PID}.dump)
+    TEST "^DTiJ"
+    RES=$(grep -a -o "JS:[a-zA-Z]*PerfMap [^ ]*PerfMap.js:[0-9]*" ${WORK_DIR}/jit-${PID}.dump)
+    TEST "JS:innerPerfMap [^ ]*PerfMap.js:7"
+    TEST "JS:outerPerfMap [^ ]*PerfMap.js:14"
+
+    rm -rf ${WORK_DIR}
+fi
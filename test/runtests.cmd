@@ -464,6 +464,7 @@ goto :main
   set _rlArgs=%_rlArgs% -nottags:fails_%_TESTCONFIG%
   set _rlArgs=%_rlArgs% -nottags:exclude_%_TESTCONFIG%
   set _rlArgs=%_rlArgs% -nottags:exclude_%TARGET_OS%
+  set _rlArgs=%_rlArgs% -nottags:exclude_windows
   set _rlArgs=%_rlArgs% -nottags:exclude_%_BuildArchMapped%
   set _rlArgs=%_rlArgs% -nottags:exclude_%_BuildTypeMapped%
   set _rlArgs=%_rlArgs% %_exclude_serialized%
@@ -58,6 +58,7 @@ parser.add_argument('--timeout', type=int, default=DEFAULT_TIMEOUT,
 parser.add_argument('-l', '--logfile', metavar='logfile', help='file to log results to', default=None)
 parser.add_argument('--x86', action='store_true', help='use x86 build')
 parser.add_argument('--x64', action='store_true', help='use x64 build')
+parser.add_argument('--simdjs', action='store_true', help='run -simdjs tests (build.sh --simdjs)')
 args = parser.parse_args()
 
 
@@ -118,8 +119,13 @@ if sys.platform != 'win32':
     not_tags.add('require_debugger')
 if sys.platform == 'darwin':
     not_tags.add('exclude_mac')
+if sys.platform == 'win32':
+    not_tags.add('exclude_windows')
+# xplat: SIMD.js is only built with build.sh --simdjs
+if sys.platform != 'win32' and not args.simdjs:
+    not_tags.add('require_simdjs')
 not_compile_flags = set(['-simdjs']) \
-    if sys.platform != 'win32' else None
+    if sys.platform != 'win32' and not args.simdjs else None
 
 # use tags/not_tags/not_compile_flags as case-insensitive
 def lower_set(s):
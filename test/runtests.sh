@@ -7,7 +7,7 @@
 
 test_path=`dirname "$0"`
 
-build_type=$1
+# Arguments are passed on to runtests.py, e.g. --simdjs for builds configured with build.sh --simdjs
 binary_path=
 release_build=0
 
@@ -29,7 +29,7 @@ else
 fi
 
 if [[ $release_build != 1 ]]; then
-    "$test_path/runtests.py" $build_type --not-tag exclude_jenkins
+    "$test_path/runtests.py" $build_type --not-tag exclude_jenkins "$@"
     if [[ $? != 0 ]]; then
         exit 1
     fi
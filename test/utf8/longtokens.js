@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The scanner skips plain ASCII in comments, strings, identifiers and whitespace a block at a time.
+// Put every kind of character it has to stop for at each offset of a run longer than a block and check
+// that the result matches what is built up one character at a time.
+// For this test case to work, please save this file with UTF-8 encoding
+
+var failed = 0;
+function check(actual, expected, what)
+{
+    if (actual !== expected)
+    {
+        failed++;
+        WScript.Echo("FAIL: " + what + ": " + JSON.stringify(actual) + " !== " + JSON.stringify(expected));
+    }
+}
+
+var filler = "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOP";
+var specials = ["\"", "'", "`", "$", "\\\\", "\\n", "\\u2028", "é", "𐌲", " ", "*", "/"];
+
+for (var offset = 0; offset < 40; offset++)
+{
+    var head = filler.substring(0, offset);
+    var tail = filler.substring(offset);
+
+    for (var i = 0; i < specials.length; i++)
+    {
+        var special = specials[i];
+        var inString = special === "\"" ? "\\\"" : special;
+        var expected = eval("'" + head + (special === "'" ? "\\'" : inString) + tail + "'");
+
+        check(eval("\"" + head + inString + tail + "\""), expected, "string at " + offset + " with " + special);
+        if (special !== "`" && special !== "$")
+        {
+            check(eval("`" + head + inString + tail + "`"), expected, "template at " + offset + " with " + special);
+        }
+
+        if (special !== "\\n" && special !== "\\u2028" && special !== " ")
+        {
+            var commentText = head + special.replace("*", "* ") + tail;
+            check(eval("1 /* " + commentText + " */ + 2"), 3, "block comment at " + offset + " with " + special);
+            check(eval("3 // " + commentText + "\n + 4"), 7, "line comment at " + offset + " with " + special);
+        }
+    }
+
+    check(eval("1 /*" + head + "\n" + tail + "*/ + 1"), 2, "block comment line break at " + offset);
+    check(eval("1 //" + head + "\u2028 + 1"), 2, "line comment LS at " + offset);
+
+    var id = "x" + head + "é" + tail;
+    check(eval("var " + id + " = " + offset + "; " + id), offset, "identifier at " + offset);
+    var idEscaped = "x" + head + "\\u0065" + tail;
+    check(eval("var " + idEscaped + " = " + offset + "; x" + head + "e" + tail), offset, "escaped identifier at " + offset);
+
+    var spaces = new Array(offset + 1).join(" ") + "\t" + new Array(offset + 1).join(" ");
+    check(eval(spaces + "5" + spaces + "+" + spaces + "6" + spaces), 11, "whitespace at " + offset);
+}
+
+var x = "a string literal long enough to span several blocks, with a non-ASCII character at the end: é";
+check(x.length, 93, "literal length");
+check(x.charCodeAt(x.length - 1), 0xE9, "literal last character");
+var anIdentifierThatIsLongerThanOneBlockOfSixteenBytes_$0123456789 = 1;
+check(anIdentifierThatIsLongerThanOneBlockOfSixteenBytes_$0123456789, 1, "long identifier");
+/* a block comment that is longer than one block and has a * and a / but no terminator until here */
+check(eval("'" + filler + filler + filler + "'").length, filler.length * 3, "long string");
+
+WScript.Echo(failed === 0 ? "PASS" : "FAILED");